@@ -0,0 +1,179 @@
+/***********************************************************************
+* benchmark.h - Shared helpers of the benchmark programs               *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2023 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <initializer_list>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench
+{
+
+//----------------------------------------------------------------------
+inline auto isHelpRequested ( int argc, char* argv[]
+                            , const char* description ) -> bool
+{
+  // Prints the usage for -h or --help
+
+  if ( argc < 2 || ( std::strcmp(argv[1], "--help") != 0
+                  && std::strcmp(argv[1], "-h") != 0 ) )
+    return false;
+
+  std::cout << "Usage: " << argv[0] << "\n\n" << description << "\n";
+  return true;
+}
+
+//----------------------------------------------------------------------
+template <typename FuncT>
+inline auto measure (FuncT&& func) -> double
+{
+  // Returns the run time of func in nanoseconds
+
+  using std::chrono::duration_cast;
+  using std::chrono::nanoseconds;
+  const auto start = std::chrono::steady_clock::now();
+  func();
+  const auto end = std::chrono::steady_clock::now();
+  return double(duration_cast<nanoseconds>(end - start).count());
+}
+
+//----------------------------------------------------------------------
+struct Statistics
+{
+  double mean{0.0};
+  double median{0.0};
+  double percentile_99{0.0};
+  double maximum{0.0};
+};
+
+//----------------------------------------------------------------------
+inline auto getStatistics (std::vector<double> samples) -> Statistics
+{
+  Statistics stats{};
+
+  if ( samples.empty() )
+    return stats;
+
+  std::sort (samples.begin(), samples.end());
+  const auto sum = std::accumulate(samples.begin(), samples.end(), 0.0);
+  stats.mean = sum / double(samples.size());
+  stats.median = samples[samples.size() / 2];
+  stats.percentile_99 = samples[samples.size() * 99 / 100];
+  stats.maximum = samples.back();
+  return stats;
+}
+
+
+//----------------------------------------------------------------------
+// class Table
+//----------------------------------------------------------------------
+
+class Table
+{
+  public:
+    // Using-declaration
+    using Column = std::pair<std::string, int>;  // Title and width
+
+    // Constructor
+    explicit Table (std::initializer_list<Column> column_list)
+    {
+      for (const auto& column : column_list)
+      {
+        widths.push_back(column.second);
+        line_width += column.second;
+      }
+
+      rule();
+
+      for (const auto& column : column_list)
+        output << std::left << std::setw(column.second) << column.first;
+
+      output << "\n";
+      rule();
+    }
+
+    // Accessor
+    auto getString() const -> std::string
+    {
+      return output.str();
+    }
+
+    // Methods
+    template <typename... Args>
+    void addRow (const Args&... args)
+    {
+      column = 0;
+      output << std::left << std::fixed << std::setprecision(precision);
+      addCells(args...);
+      output << "\n";
+    }
+
+    void setPrecision (int digits)
+    {
+      precision = digits;
+    }
+
+    void rule()
+    {
+      output << std::string(std::size_t(line_width), '-') << "\n";
+    }
+
+    void addNote (const std::string& note)
+    {
+      output << note << "\n";
+    }
+
+  private:
+    // Methods
+    void addCells()
+    { }
+
+    template <typename T, typename... Args>
+    void addCells (const T& value, const Args&... args)
+    {
+      const auto width = column < widths.size() ? widths[column] : 0;
+      output << std::setw(width) << value;
+      column++;
+      addCells(args...);
+    }
+
+    // Data members
+    std::ostringstream output{};
+    std::vector<int>   widths{};
+    std::size_t        column{0};
+    int                line_width{0};
+    int                precision{3};
+};
+
+}  // namespace bench
+
+#endif  // BENCHMARK_H
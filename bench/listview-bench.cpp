@@ -0,0 +1,116 @@
+/***********************************************************************
+* listview-bench.cpp - Measures the insertion of FListView items       *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2023 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <final/final.h>
+
+#include "benchmark.h"
+
+//----------------------------------------------------------------------
+auto measureInsert ( finalcut::FWidget* parent, int count
+                   , bool sorted, bool batched ) -> double
+{
+  // Returns the time in seconds to insert count items
+
+  auto listview = std::make_unique<finalcut::FListView>(parent);
+  listview->addColumn ("Name");
+  listview->addColumn ("Number");
+  listview->setColumnSortType (2, finalcut::SortType::Number);
+
+  if ( sorted )
+    listview->setColumnSort (1, finalcut::SortOrder::Ascending);
+
+  const auto ns = bench::measure ( [&listview, count, batched] ()
+  {
+    if ( batched )
+      listview->beginUpdate();
+
+    for (auto i{0}; i < count; i++)
+    {
+      // Scrambled order for the sorting
+      const auto n = (std::size_t(i) * 7919u) % std::size_t(count);
+      const finalcut::FStringList line{ "Item " + std::to_string(n)
+                                      , std::to_string(i) };
+      listview->insert (line);
+    }
+
+    if ( batched )
+      listview->endUpdate();
+  } );
+
+  return ns / 1'000'000'000;
+}
+
+//----------------------------------------------------------------------
+auto benchmark (finalcut::FWidget* parent) -> std::string
+{
+  bench::Table table{{"Items", 10}, {"Sorted", 8}, {"Batched", 9}, {"Time", 11}};
+
+  auto add_row = [&table, parent] (int count, bool sorted, bool batched)
+  {
+    const auto seconds = measureInsert (parent, count, sorted, batched);
+    table.addRow ( count, sorted ? "yes" : "no", batched ? "yes" : "no"
+                 , std::to_string(seconds) + " s" );
+  };
+
+  // Without batching, each insert() sorts and counts the whole list
+  add_row (10'000, false, false);
+  add_row (1'000, true, false);
+
+  for (const auto count : {10'000, 100'000, 1'000'000})
+  {
+    add_row (count, false, true);
+    add_row (count, true, true);
+  }
+
+  table.rule();
+  return table.getString();
+}
+
+
+//----------------------------------------------------------------------
+//                               main part
+//----------------------------------------------------------------------
+
+auto main (int argc, char* argv[]) -> int
+{
+  if ( bench::isHelpRequested ( argc, argv
+                              , "Measures FListView::insert() with and "
+                                "without beginUpdate()/endUpdate()" ) )
+    return 0;
+
+  // Disable terminal data requests
+  auto& start_options = finalcut::FStartOptions::getInstance();
+  start_options.terminal_data_request = false;
+  std::string report{};
+
+  {  // Create the application object in this scope
+    finalcut::FApplication app(argc, argv);
+    report = benchmark(&app);
+  }  // Hide and destroy the application object
+
+  std::cout << "FListView insert benchmark:\n" << report;
+  return 0;
+}
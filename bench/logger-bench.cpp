@@ -0,0 +1,98 @@
+/***********************************************************************
+* logger-bench.cpp - Measures the latency of FLogger calls             *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2023 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <final/final.h>
+
+#include "benchmark.h"
+
+//----------------------------------------------------------------------
+auto measureLogCalls (std::ostream& file, bool async) -> std::vector<double>
+{
+  // Returns the latency of each logging call in microseconds
+  // as seen by the caller
+
+  constexpr std::size_t count{100000};
+  std::vector<double> latency{};
+  latency.reserve(count);
+  finalcut::FLogger log{};
+  log.setLineEnding (finalcut::FLog::LineEnding::LF);
+  log.enableTimestamp();
+  log.setOutputStream(file);
+
+  if ( async )
+    log.enableAsync (4096, finalcut::FLogger::OverflowPolicy::Block);
+
+  const std::string message{"Mouse button pressed at (12, 34)"};
+
+  for (std::size_t i{0}; i < count; i++)
+  {
+    const auto ns = bench::measure ([&log, &message] () { log.debug(message); });
+    latency.push_back(ns / 1000);
+  }
+
+  log.flush();
+  return latency;
+}
+
+//----------------------------------------------------------------------
+auto benchmark() -> std::string
+{
+  const std::string filename{"/tmp/finalcut-logger-bench.log"};
+  std::ofstream file(filename, std::ofstream::out);
+  bench::Table table{ {"Mode", 8}, {"Mean", 10}, {"Median", 10}
+                    , {"99th perc.", 12}, {"Maximum", 10} };
+
+  for (const auto async : {false, true})
+  {
+    const auto stats = bench::getStatistics(measureLogCalls(file, async));
+    table.addRow ( async ? "async" : "sync", stats.mean, stats.median
+                 , stats.percentile_99, stats.maximum );
+  }
+
+  table.rule();
+  table.addNote ("Latency per logging call in microseconds");
+  file.close();
+  std::remove(filename.c_str());
+  return table.getString();
+}
+
+
+//----------------------------------------------------------------------
+//                               main part
+//----------------------------------------------------------------------
+
+auto main (int argc, char* argv[]) -> int
+{
+  if ( bench::isHelpRequested ( argc, argv
+                              , "Measures the latency of synchronous "
+                                "and asynchronous FLogger calls" ) )
+    return 0;
+
+  std::cout << "FLogger benchmark:\n" << benchmark();
+  return 0;
+}
@@ -0,0 +1,115 @@
+/***********************************************************************
+* optimove-bench.cpp - Measures the cursor motion calculation          *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2023 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <final/final.h>
+
+#include "benchmark.h"
+
+//----------------------------------------------------------------------
+void setXtermCapabilities (finalcut::FOptiMove& om, int xmax, int ymax)
+{
+  // The cursor capabilities of xterm
+
+  om.setTermSize (std::size_t(xmax + 1), std::size_t(ymax + 1));
+  om.setBaudRate (38400);
+  om.setTabStop (8);
+  om.set_eat_newline_glitch (true);
+  om.set_tabular ("\t");
+  om.set_back_tab (CSI "Z");
+  om.set_cursor_home (CSI "H");
+  om.set_cursor_to_ll (nullptr);
+  om.set_carriage_return ("\r");
+  om.set_cursor_up (CSI "A");
+  om.set_cursor_down ("\n");
+  om.set_cursor_right (CSI "C");
+  om.set_cursor_left ("\b");
+  om.set_cursor_address (CSI "%i%p1%d;%p2%dH");
+  om.set_column_address (CSI "%i%p1%dG");
+  om.set_row_address (CSI "%i%p1%dd");
+  om.set_parm_up_cursor (CSI "%p1%dA");
+  om.set_parm_down_cursor (CSI "%p1%dB");
+  om.set_parm_right_cursor (CSI "%p1%dC");
+  om.set_parm_left_cursor (CSI "%p1%dD");
+}
+
+//----------------------------------------------------------------------
+auto benchmark (int xmax, int ymax) -> std::string
+{
+  // Measures the time for calculating the cursor move sequences
+  // of the movements demonstrated in the opti-move example
+
+  using Move = std::array<int, 4>;
+  const std::vector<Move> moves =
+  {
+    {{5, 12, 0, 0}},    {{5, ymax, 5, 0}},  {{xmax, 1, 0, 1}},
+    {{xmax, 1, 0, 2}},  {{9, 4, 10, 4}},    {{10, 4, 9, 4}},
+    {{9, 4, 11, 4}},    {{11, 4, 9, 4}},    {{1, 0, 8, 0}},
+    {{16, 0, 16, 1}},   {{16, 1, 16, 0}},   {{16, 0, 16, 2}},
+    {{16, 2, 16, 0}},   {{3, 2, xmax, 2}},  {{5, 5, xmax - 5, ymax - 5}}
+  };
+  constexpr int rounds{100000};
+  finalcut::FOptiMove om;
+  setXtermCapabilities (om, xmax, ymax);
+  std::size_t bytes{0};
+
+  const auto ns = bench::measure ( [&om, &moves, &bytes] ()
+  {
+    for (int n{0}; n < rounds; n++)
+    {
+      for (const auto& m : moves)
+        bytes += om.moveCursor(m[0], m[1], m[2], m[3]).length();
+    }
+  } );
+
+  const auto calls = double(rounds) * double(moves.size());
+  bench::Table table{{"Moves", 12}, {"Time/move", 14}, {"Bytes/move", 12}};
+  table.setPrecision (1);
+  table.addRow ( std::size_t(calls)
+               , std::to_string(int(ns / calls + 0.5)) + " ns"
+               , double(bytes) / calls );
+  table.rule();
+  return table.getString();
+}
+
+
+//----------------------------------------------------------------------
+//                               main part
+//----------------------------------------------------------------------
+
+auto main (int argc, char* argv[]) -> int
+{
+  if ( bench::isHelpRequested ( argc, argv
+                              , "Measures FOptiMove::moveCursor() with "
+                                "the xterm capabilities" ) )
+    return 0;
+
+  // FOptiMove needs an initialized termcap library
+  finalcut::FTermcap::init();
+  std::cout << "FOptiMove cursor motion benchmark (80x25):\n"
+            << benchmark(79, 24);
+  return 0;
+}
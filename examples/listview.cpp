@@ -168,11 +168,16 @@ void Listview::populate()
     {{ "Zurich", "Mostly Cloudy", "23°C", "44%", "1023.7 mb" }}
   }};
 
+  // Sort only once after the last insert()
+  listview.beginUpdate();
+
   for (const auto& place : weather)
   {
     const finalcut::FStringList line (place.cbegin(), place.cend());
     listview.insert (line);
   }
+
+  listview.endUpdate();
 }
 
 //----------------------------------------------------------------------
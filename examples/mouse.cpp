@@ -513,6 +513,9 @@ void MouseDraw::drawCanvas()
       line_changes.xmax = uInt(ax + x_end - 1);
   }
 
+  if ( y_end > 0 )
+    printarea->addChangedLines (ay, ay + y_end - 1);
+
   printarea->has_changes = true;
   forceTerminalUpdate();
 }
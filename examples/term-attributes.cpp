@@ -111,10 +111,14 @@ void AttribDlg::onWheel (finalcut::FWheelEvent* ev)
 {
   const finalcut::MouseWheel wheel = ev->getWheel();
 
-  if ( wheel == finalcut::MouseWheel::Up )
-    cb_next();
-  else if ( wheel == finalcut::MouseWheel::Down )
-    cb_back();
+  // One event can contain several wheel steps
+  for (int n{0}; n < ev->getDelta(); n++)
+  {
+    if ( wheel == finalcut::MouseWheel::Up )
+      cb_next();
+    else if ( wheel == finalcut::MouseWheel::Down )
+      cb_back();
+  }
 }
 
 //----------------------------------------------------------------------
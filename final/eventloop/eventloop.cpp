@@ -22,18 +22,49 @@
 
 #include <unistd.h>
 
+#include <algorithm>
+#include <cerrno>
 #include <iostream>
 #include <thread>
 
 #include "final/eventloop/eventloop.h"
+#include "final/ftypes.h"
 
 namespace finalcut
 {
 
+#if defined(USE_EPOLL)
+// The epoll event flags are passed on as poll() return events
+static_assert ( POLLIN == EPOLLIN && POLLPRI == EPOLLPRI
+             && POLLOUT == EPOLLOUT && POLLERR == EPOLLERR
+             && POLLHUP == EPOLLHUP
+              , "The poll and epoll event flags have different values" );
+#endif
+
 //----------------------------------------------------------------------
 // class EventLoop
 //----------------------------------------------------------------------
 
+// constructors and destructor
+//----------------------------------------------------------------------
+EventLoop::EventLoop()
+{
+#if defined(USE_EPOLL)
+  // Without an epoll instance, all monitors are watched by poll()
+  epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+#endif
+}
+
+//----------------------------------------------------------------------
+EventLoop::~EventLoop() noexcept  // destructor
+{
+#if defined(USE_EPOLL)
+  if ( epoll_fd != NO_FILE_DESCRIPTOR )
+    (void)::close(epoll_fd);
+#endif
+}
+
+
 // public methods of EventLoop
 //----------------------------------------------------------------------
 auto EventLoop::run() -> int
@@ -61,21 +92,23 @@ inline void EventLoop::nonPollWaiting() const
 //----------------------------------------------------------------------
 inline auto EventLoop::processNextEvents() -> bool
 {
-  nfds_t fd_count = 0;
   monitors_changed = false;
 
-  for (Monitor* monitor : monitors)
-  {
-    if ( monitor->isActive() )
-    {
-      fds[fd_count] = { monitor->getFileDescriptor(), monitor->getEvents(), 0 };
-      lookup_table[fd_count] = monitor;
-      fd_count++;
-    }
+#if defined(USE_EPOLL)
+  if ( poll_monitors.empty() )
+    return processEpollEvents(WAIT_INDEFINITELY);
+#endif
 
-    if ( fd_count >= MAX_MONITORS )
-      break;
-  }
+  return processPollEvents();
+}
+
+//----------------------------------------------------------------------
+auto EventLoop::processPollEvents() -> bool
+{
+  if ( poll_list_changed )
+    rebuildPollList();
+
+  const auto fd_count = nfds_t(fds.size());
 
   if ( fd_count == 0 )
     return false;
@@ -108,12 +141,25 @@ inline void EventLoop::dispatcher (int poll_result, nfds_t fd_count)
   {
     const pollfd& current_fd = fds[index];
 
-    if ( current_fd.revents == 0
-      || ! (current_fd.revents & current_fd.events) )
+    if ( current_fd.revents == 0 )
       continue;
 
-    // Call the event handler for current_fd
-    lookup_table[index]->trigger(current_fd.revents);
+    if ( auto monitor = lookup_table[index] )
+    {
+      if ( ! (current_fd.revents & current_fd.events) )
+        continue;
+
+      // Call the event handler for current_fd
+      monitor->trigger(current_fd.revents);
+    }
+#if defined(USE_EPOLL)
+    else
+    {
+      // The epoll instance has pending events
+      processEpollEvents(0);
+    }
+#endif
+
     ++processed_fds;
 
     if ( monitors_changed || ! running
@@ -123,17 +169,178 @@ inline void EventLoop::dispatcher (int poll_result, nfds_t fd_count)
 }
 
 //----------------------------------------------------------------------
-void EventLoop::addMonitor (Monitor* monitor)
+void EventLoop::rebuildPollList()
 {
-  monitors.push_back(monitor);
+  fds.clear();
+  lookup_table.clear();
+
+  for (auto&& monitor : poll_monitors)
+  {
+    fds.push_back({ monitor->getFileDescriptor(), monitor->getEvents(), 0 });
+    lookup_table.push_back(monitor);
+  }
+
+#if defined(USE_EPOLL)
+  if ( ! epoll_monitors.empty() )
+  {
+    // A readable epoll file descriptor signals events of epoll monitors
+    fds.push_back({ epoll_fd, POLLIN, 0 });
+    lookup_table.push_back(nullptr);
+  }
+#endif
+
+  poll_list_changed = false;
+}
+
+#if defined(USE_EPOLL)
+//----------------------------------------------------------------------
+auto EventLoop::processEpollEvents (int timeout) -> bool
+{
+  if ( epoll_monitors.empty() )
+    return false;
+
+  if ( epoll_events.size() < epoll_monitors.size() )
+    epoll_events.resize(epoll_monitors.size());
+
+  int epoll_result{};
+
+  while ( true )
+  {
+    epoll_result = ::epoll_wait ( epoll_fd, epoll_events.data()
+                                , int(epoll_events.size()), timeout );
+
+    if ( epoll_result != -1 || errno != EINTR )
+      break;
+  }
+
+  if ( epoll_result <= 0 )
+    return false;
+
+  for (std::size_t index{0}; index < std::size_t(epoll_result); index++)
+  {
+    const auto& event = epoll_events[index];
+    const auto iter = epoll_monitors.find(event.data.fd);
+
+    if ( iter == epoll_monitors.end() )  // Unregistered in the meantime
+      continue;
+
+    auto monitor = iter->second;
+    const auto return_events = short(event.events);
+
+    if ( ! (return_events & monitor->getEvents()) )
+      continue;
+
+    // Call the event handler for the monitor
+    monitor->trigger(return_events);
+
+    if ( monitors_changed || ! running )
+      break;
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+inline auto EventLoop::isEpollMonitor (const Monitor* monitor) const -> bool
+{
+  const auto iter = epoll_monitors.find(monitor->registered_fd);
+  return iter != epoll_monitors.end() && iter->second == monitor;
+}
+#endif  // defined(USE_EPOLL)
+
+//----------------------------------------------------------------------
+void EventLoop::addMonitor (Monitor*)
+{
+  // A monitor is registered as soon as it becomes active
   monitors_changed = true;
 }
 
 //----------------------------------------------------------------------
 void EventLoop::removeMonitor (Monitor* monitor)
 {
-  monitors.remove(monitor);
+  unregisterMonitor(monitor);
   monitors_changed = true;
 }
 
+//----------------------------------------------------------------------
+void EventLoop::updateMonitor (Monitor* monitor)
+{
+  // Keeps the registration in sync with the monitor state
+
+  const int fd = monitor->getFileDescriptor();
+  const bool watch = monitor->isActive() && fd >= 0;
+
+#if defined(USE_EPOLL)
+  if ( watch && fd == monitor->registered_fd && isEpollMonitor(monitor) )
+  {
+    // Only the event mask has changed
+    struct epoll_event event{};
+    event.events = uInt32(uInt16(monitor->getEvents()));
+    event.data.fd = fd;
+
+    if ( ::epoll_ctl(epoll_fd, EPOLL_CTL_MOD, fd, &event) == 0 )
+      return;
+  }
+#endif
+
+  unregisterMonitor(monitor);
+
+  if ( watch )
+    registerMonitor(monitor);
+}
+
+//----------------------------------------------------------------------
+void EventLoop::registerMonitor (Monitor* monitor)
+{
+  const int fd = monitor->getFileDescriptor();
+  monitor->registered_fd = fd;
+  poll_list_changed = true;
+
+#if defined(USE_EPOLL)
+  if ( epoll_fd != NO_FILE_DESCRIPTOR
+    && epoll_monitors.find(fd) == epoll_monitors.end() )
+  {
+    struct epoll_event event{};
+    event.events = uInt32(uInt16(monitor->getEvents()));
+    event.data.fd = fd;
+
+    if ( ::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0 )
+    {
+      epoll_monitors[fd] = monitor;
+      return;
+    }
+  }
+#endif
+
+  // Without epoll support, for regular files (not supported by epoll)
+  // and for a file descriptor that is used by several monitors
+  poll_monitors.push_back(monitor);
+}
+
+//----------------------------------------------------------------------
+void EventLoop::unregisterMonitor (Monitor* monitor)
+{
+  if ( monitor->registered_fd == NO_FILE_DESCRIPTOR )
+    return;
+
+#if defined(USE_EPOLL)
+  if ( isEpollMonitor(monitor) )
+  {
+    // Fails harmlessly if the file descriptor has already been closed
+    struct epoll_event event{};
+    (void)::epoll_ctl(epoll_fd, EPOLL_CTL_DEL, monitor->registered_fd, &event);
+    epoll_monitors.erase(monitor->registered_fd);
+  }
+#endif
+
+  const auto iter = std::find ( poll_monitors.cbegin()
+                              , poll_monitors.cend(), monitor );
+
+  if ( iter != poll_monitors.cend() )
+    poll_monitors.erase(iter);
+
+  monitor->registered_fd = NO_FILE_DESCRIPTOR;
+  poll_list_changed = true;
+}
+
 }  // namespace finalcut
@@ -31,9 +31,15 @@
 #ifndef EVENTLOOP_H
 #define EVENTLOOP_H
 
-#include <list>
+#if defined(__linux__)
+  #define USE_EPOLL
+  #include <sys/epoll.h>
+#endif
+
 #include <poll.h>
-#include <array>
+
+#include <unordered_map>
+#include <vector>
 
 #include "final/eventloop/monitor.h"
 #include "final/util/fstring.h"
@@ -49,7 +55,22 @@ class EventLoop
 {
   public:
     // Constructor
-    EventLoop() = default;
+    EventLoop();
+
+    // Disable copy constructor
+    EventLoop (const EventLoop&) = delete;
+
+    // Disable move constructor
+    EventLoop (EventLoop&&) noexcept = delete;
+
+    // Destructor
+    ~EventLoop() noexcept;
+
+    // Disable copy assignment operator (=)
+    auto operator = (const EventLoop&) -> EventLoop& = delete;
+
+    // Disable move assignment operator (=)
+    auto operator = (EventLoop&&) noexcept -> EventLoop& = delete;
 
     // Accessor
     auto getClassName() const -> FString;
@@ -60,22 +81,37 @@ class EventLoop
 
   private:
     // Constants
-    static constexpr nfds_t MAX_MONITORS{50};
     static constexpr int WAIT_INDEFINITELY{-1};
+    static constexpr int NO_FILE_DESCRIPTOR{-1};
 
     // Methods
     void nonPollWaiting() const;
     auto processNextEvents() -> bool;
+    auto processPollEvents() -> bool;
     void dispatcher (int, nfds_t);
+    void rebuildPollList();
     void addMonitor (Monitor*);
     void removeMonitor (Monitor*);
+    void updateMonitor (Monitor*);
+    void registerMonitor (Monitor*);
+    void unregisterMonitor (Monitor*);
+#if defined(USE_EPOLL)
+    auto processEpollEvents (int) -> bool;
+    auto isEpollMonitor (const Monitor*) const -> bool;
+#endif
 
     // Data members
     bool running{false};
     bool monitors_changed{false};
-    std::list<Monitor*>  monitors{};
-    std::array<struct pollfd, MAX_MONITORS> fds{};
-    std::array<Monitor*, MAX_MONITORS>      lookup_table{};
+    bool poll_list_changed{false};
+    std::vector<Monitor*>      poll_monitors{};  // Monitors watched by poll()
+    std::vector<struct pollfd> fds{};
+    std::vector<Monitor*>      lookup_table{};
+#if defined(USE_EPOLL)
+    int epoll_fd{NO_FILE_DESCRIPTOR};
+    std::unordered_map<int, Monitor*> epoll_monitors{};  // fd -> monitor
+    std::vector<struct epoll_event>   epoll_events{};
+#endif
 
     // Friend classes
     friend class Monitor;
@@ -61,4 +61,14 @@ void drainPipe (int fd)
   }
 }
 
+//----------------------------------------------------------------------
+auto durationToTimespec (std::chrono::nanoseconds duration) -> timespec
+{
+  const auto seconds{std::chrono::duration_cast<std::chrono::seconds>(duration)};
+  duration -= seconds;
+
+  return timespec{ static_cast<time_t>(seconds.count())
+                 , static_cast<long>(duration.count()) };
+}
+
 }  // namespace finalcut
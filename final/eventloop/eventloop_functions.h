@@ -27,11 +27,16 @@
   #error "Only <final/final.h> can be included directly."
 #endif
 
+#include <time.h>
+
+#include <chrono>
+
 namespace finalcut
 {
 
 // non-member function forward declarations
 void drainPipe (int);
+auto durationToTimespec (std::chrono::nanoseconds) -> timespec;
 
 }  // namespace finalcut
 
@@ -52,4 +52,60 @@ Monitor::~Monitor()  // destructor
     eventloop->removeMonitor(this);
 }
 
+
+// public methods of Monitor
+//----------------------------------------------------------------------
+void Monitor::resume()
+{
+  if ( active )
+    return;
+
+  active = true;
+  updateEventLoop();
+}
+
+//----------------------------------------------------------------------
+void Monitor::suspend()
+{
+  if ( ! active )
+    return;
+
+  active = false;
+  updateEventLoop();
+}
+
+
+// protected methods of Monitor
+//----------------------------------------------------------------------
+void Monitor::setFileDescriptor (int file_descriptor)
+{
+  if ( fd == file_descriptor )
+    return;
+
+  fd = file_descriptor;
+  updateEventLoop();
+}
+
+//----------------------------------------------------------------------
+void Monitor::setEvents (short ev)
+{
+  if ( events == ev )
+    return;
+
+  events = ev;
+  updateEventLoop();
+}
+
+
+// private methods of Monitor
+//----------------------------------------------------------------------
+inline void Monitor::updateEventLoop()
+{
+  // Passes a changed file descriptor, event mask or
+  // activity state to the event loop registration
+
+  if ( eventloop )
+    eventloop->updateMonitor(this);
+}
+
 }  // namespace finalcut
@@ -136,6 +136,9 @@ class Monitor
     // Using-declaration
     using FDataAccessPtr = std::shared_ptr<FDataAccess>;
 
+    // Method
+    void updateEventLoop();
+
     // Data member
     bool           active{false};
     EventLoop*     eventloop{};
@@ -144,6 +147,7 @@ class Monitor
     handler_t      handler{};
     FDataAccessPtr user_context{nullptr};
     bool           monitor_initialized{false};
+    int            registered_fd{NO_FILE_DESCRIPTOR};  // EventLoop backend
 
     // Friend classes
     friend class EventLoop;
@@ -176,14 +180,6 @@ auto Monitor::getUserContext() const -> clean_fdata_t<T>&
 inline auto Monitor::isActive() const -> bool
 { return active; }
 
-//----------------------------------------------------------------------
-inline void Monitor::resume()
-{ active = true; }
-
-//----------------------------------------------------------------------
-inline void Monitor::suspend()
-{ active = false; }
-
 //----------------------------------------------------------------------
 inline void Monitor::trigger (short return_events)
 {
@@ -191,14 +187,6 @@ inline void Monitor::trigger (short return_events)
     handler (this, return_events);
 }
 
-//----------------------------------------------------------------------
-inline void Monitor::setFileDescriptor (int file_descriptor)
-{ fd = file_descriptor; }
-
-//----------------------------------------------------------------------
-inline void Monitor::setEvents (short ev)
-{ events = ev; }
-
 //----------------------------------------------------------------------
 inline void Monitor::setHandler (handler_t&& hdl)
 { handler = std::move(hdl); }
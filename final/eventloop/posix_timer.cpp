@@ -63,20 +63,6 @@ struct TimerNode;
 using TimerNodesList = std::list<TimerNode>;
 
 
-//----------------------------------------------------------------------
-#if __cplusplus > 1 && __cplusplus >= 201703L
-  constexpr auto durationToTimespec (std::chrono::nanoseconds duration) -> timespec
-#else
-  static auto durationToTimespec (std::chrono::nanoseconds duration) -> timespec
-#endif
-{
-  const auto seconds{std::chrono::duration_cast<std::chrono::seconds>(duration)};
-  duration -= seconds;
-
-  return timespec{ static_cast<time_t>(seconds.count())
-                 , static_cast<long>(duration.count()) };
-}
-
 //----------------------------------------------------------------------
 static auto getTimerNodes() -> TimerNodesList&
 {
@@ -23,24 +23,26 @@
 /*  Inheritance diagram
  *  ═══════════════════
  *
- *                          ▕▔▔▔▔▔▔▔▔▔▏
- *                          ▕ Monitor ▏
- *                          ▕▁▁▁▁▁▁▁▁▁▏
- *                               ▲
- *                               │
- *                      ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
- *                      ▕ TimerMonitorImpl ▏
- *                      ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
- *                        ▲              ▲
- *                        │              │
- * ▕▔▔▔▔▔▔▔▔▔▔▏1   1▕▔▔▔▔▔▔▔▔▔▔▔▔▏ ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▏
- * ▕ PipeData ▏- - -▕ PosixTimer ▏ ▕ KqueueTimer ▏ (platform-specific)
- * ▕▁▁▁▁▁▁▁▁▁▁▏     ▕▁▁▁▁▁▁▁▁▁▁▁▁▏ ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▏
- *                           ▲         ▲
- *                           │         │
- *                         ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
- *                         ▕ TimerMonitor ▏
- *                         ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ *                                    ▕▔▔▔▔▔▔▔▔▔▏
+ *                                    ▕ Monitor ▏
+ *                                    ▕▁▁▁▁▁▁▁▁▁▏
+ *                                         ▲
+ *                                         │
+ *                               ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ *                               ▕ TimerMonitorImpl ▏
+ *                               ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ *                                         ▲
+ *                         ┌───────────────┴───────────────┐
+ *                         │               │               │
+ * ▕▔▔▔▔▔▔▔▔▔▔▏1   1▕▔▔▔▔▔▔▔▔▔▔▔▔▏ ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏ ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ PipeData ▏- - -▕ PosixTimer ▏ ▕ TimerfdTimer ▏ ▕ KqueueTimer ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▏     ▕▁▁▁▁▁▁▁▁▁▁▁▁▏ ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏ ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ *                         ▲               ▲               ▲
+ *                         └───────────────┬───────────────┘  (platform-specific)
+ *                                         │
+ *                                 ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ *                                 ▕ TimerMonitor ▏
+ *                                 ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
  */
 
 #ifndef TIMER_MONITOR_H
@@ -149,6 +151,60 @@ inline void PosixTimer::init (handler_t hdl, T&& uc)
 #endif  // defined(USE_POSIX_TIMER)
 
 
+//----------------------------------------------------------------------
+// class TimerfdTimer
+//----------------------------------------------------------------------
+
+class TimerfdTimer : public TimerMonitorImpl
+{
+  public:
+    // Using-declaration
+    using TimerMonitorImpl::TimerMonitorImpl;
+
+    // Constructor
+    explicit TimerfdTimer (EventLoop*);
+
+    // Disable copy constructor
+    TimerfdTimer (const TimerfdTimer&) = delete;
+
+    // Disable move constructor
+    TimerfdTimer (TimerfdTimer&&) noexcept = delete;
+
+    // Destructor
+    ~TimerfdTimer() noexcept override;
+
+    // Disable copy assignment operator (=)
+    auto operator = (const TimerfdTimer&) -> TimerfdTimer& = delete;
+
+    // Disable move assignment operator (=)
+    auto operator = (TimerfdTimer&&) noexcept -> TimerfdTimer& = delete;
+
+    // Methods
+    template <typename T>
+    void init (handler_t, T&&);
+    void setInterval ( std::chrono::nanoseconds
+                     , std::chrono::nanoseconds ) override;
+    void trigger(short) override;
+
+  private:
+    void init();
+};
+
+#if defined(USE_TIMERFD_TIMER)
+//----------------------------------------------------------------------
+template <typename T>
+inline void TimerfdTimer::init (handler_t hdl, T&& uc)
+{
+  if ( isInitialized() )
+    throw monitor_error{"This instance has already been initialised."};
+
+  setHandler (std::move(hdl));
+  setUserContext (std::forward<T>(uc));
+  init();
+}
+#endif  // defined(USE_TIMERFD_TIMER)
+
+
 //----------------------------------------------------------------------
 // class KqueueTimer
 //----------------------------------------------------------------------
@@ -234,6 +290,8 @@ struct TimerClass
     using type = KqueueTimer;
   #elif defined(__OpenBSD__)
     using type = KqueueTimer;
+  #elif defined(__linux__)
+    using type = TimerfdTimer;
   #else
     using type = PosixTimer;
   #endif
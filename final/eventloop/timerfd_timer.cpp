@@ -0,0 +1,109 @@
+/***********************************************************************
+* timerfd_timer.cpp - Time monitoring object with a Linux timerfd      *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2023 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include "final/ftypes.h"
+
+#if defined(USE_TIMERFD_TIMER)
+
+#include <sys/timerfd.h>
+
+#include <cstring>
+#include <system_error>
+#include <utility>
+
+#include "final/eventloop/eventloop_functions.h"
+#include "final/eventloop/eventloop.h"
+#include "final/eventloop/timer_monitor.h"
+#include "final/util/fsystem.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class TimerfdTimer
+//----------------------------------------------------------------------
+
+// constructors and destructor
+//----------------------------------------------------------------------
+TimerfdTimer::TimerfdTimer (EventLoop* eloop)
+  : TimerMonitorImpl(eloop)
+{ }
+
+//----------------------------------------------------------------------
+TimerfdTimer::~TimerfdTimer() noexcept  // destructor
+{
+  if ( getFileDescriptor() == NO_FILE_DESCRIPTOR )
+    return;
+
+  static const auto& fsystem = FSystem::getInstance();
+  (void)fsystem->close(getFileDescriptor());
+}
+
+
+// public methods of TimerfdTimer
+//----------------------------------------------------------------------
+void TimerfdTimer::setInterval ( std::chrono::nanoseconds first,
+                                 std::chrono::nanoseconds periodic )
+{
+  static const auto& fsystem = FSystem::getInstance();
+  struct itimerspec timer_spec { durationToTimespec(periodic)
+                               , durationToTimespec(first) };
+
+  if ( fsystem->timerfd_settime(getFileDescriptor(), 0, &timer_spec, nullptr) != -1 )
+    return;
+
+  const int error = errno;
+  std::error_code err_code{error, std::generic_category()};
+  std::system_error sys_err{err_code, strerror(error)};
+  throw sys_err;
+}
+
+//----------------------------------------------------------------------
+void TimerfdTimer::trigger (short return_events)
+{
+  // Reading the 8-byte expiration counter resets the readability
+  drainPipe(getFileDescriptor());
+  Monitor::trigger(return_events);
+}
+
+
+// private methods of TimerfdTimer
+//----------------------------------------------------------------------
+void TimerfdTimer::init()
+{
+  // The expirations are read directly from the file descriptor,
+  // so no signal handler and no pipe are required
+  static const auto& fsystem = FSystem::getInstance();
+  setEvents (POLLIN);
+  const int timer_fd = fsystem->timerfd_create ( CLOCK_MONOTONIC
+                                               , TFD_NONBLOCK | TFD_CLOEXEC );
+
+  if ( timer_fd < 0 )
+    throw monitor_error{"No timerfd timer could be reserved."};
+
+  setFileDescriptor(timer_fd);
+  setInitialized();
+}
+
+}  // namespace finalcut
+
+#endif  // defined(USE_TIMERFD_TIMER)
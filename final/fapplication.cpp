@@ -20,7 +20,10 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <sys/select.h>
+
 #include <chrono>
+#include <csignal>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -73,6 +76,7 @@ int       FApplication::loop_level      {0};        // event loop level
 int       FApplication::quit_code       {EXIT_SUCCESS};
 bool      FApplication::quit_now        {false};
 uInt64    FApplication::next_event_wait {5000};     // 5 ms (200 Hz)
+uInt64    FApplication::max_idle_wait   {0};        // No limit
 TimeValue FApplication::time_last_event {};
 
 // FEvent friend function forward declaration
@@ -160,6 +164,16 @@ void FApplication::setLog (const FLogPtr& log)
   std::clog.rdbuf(logger.get());
 }
 
+//----------------------------------------------------------------------
+void FApplication::setMaxIdleWait (uInt64 wait_time)
+{
+  // Limits the sleep time of an idle event loop (wait_time in µs).
+  // 0 = sleep until an input, a signal or a timer event arrives
+  // (processExternalUserEvent() is then only called after a wakeup)
+
+  max_idle_wait = wait_time;
+}
+
 //----------------------------------------------------------------------
 auto FApplication::isQuit() -> bool
 {
@@ -483,8 +497,10 @@ inline auto FApplication::getLongOptions() -> const std::vector<CmdOption>&
     {"no-mouse",                 no_argument,       nullptr,  'm' },
     {"no-optimized-cursor",      no_argument,       nullptr,  'o' },
     {"no-terminal-detection",    no_argument,       nullptr,  'd' },
+    {"terminal-detection-cache", no_argument,       nullptr,  'D' },
     {"no-terminal-data-request", no_argument,       nullptr,  'r' },
     {"no-terminal-focus-events", no_argument,       nullptr,  'f' },
+    {"no-bracketed-paste",       no_argument,       nullptr,  'p' },
     {"no-color-change",          no_argument,       nullptr,  'c' },
     {"no-sgr-optimizer",         no_argument,       nullptr,  's' },
     {"vgafont",                  no_argument,       nullptr,  'v' },
@@ -520,10 +536,14 @@ inline void FApplication::setCmdOptionsMap (CmdMap& cmd_map)
   cmd_map['o'] = [opt] (const auto&) { opt().cursor_optimisation = false; };
   // --no-terminal-detection
   cmd_map['d'] = [opt] (const auto&) { opt().terminal_detection = false; };
+  // --terminal-detection-cache
+  cmd_map['D'] = [opt] (const auto&) { opt().terminal_detection_cache = true; };
   // --no-terminal-data-request
   cmd_map['r'] = [opt] (const auto&) { opt().terminal_data_request = false; };
   // --no-terminal-focus-events
   cmd_map['f'] = [opt] (const auto&) { opt().terminal_focus_events = false; };
+  // --no-bracketed-paste
+  cmd_map['p'] = [opt] (const auto&) { opt().bracketed_paste = false; };
   // --no-color-change
   cmd_map['c'] = [opt] (const auto&) { opt().color_change = false; };
   // --no-sgr-optimizer
@@ -612,10 +632,14 @@ void FApplication::showParameterUsage()
     << "    Disable cursor optimization\n"
     << "  --no-terminal-detection   "
     << "    Disable terminal detection\n"
+    << "  --terminal-detection-cache"
+    << "    Reuse the terminal replies of earlier starts\n"
     << "  --no-terminal-data-request"
     << "    Do not determine terminal font and title\n"
     << "  --no-terminal-focus-events"
     << "    Do not send focus-in and focus-out events\n"
+    << "  --no-bracketed-paste      "
+    << "    Deliver pasted text as single key presses\n"
     << "  --no-color-change         "
     << "    Do not redefine the color palette\n"
     << "  --no-sgr-optimizer        "
@@ -689,6 +713,84 @@ inline auto FApplication::isKeyPressed (uInt64 ms) const -> bool
   return (keyboard.isKeyPressed(blocking_time) || keyboard.hasPendingInput());
 }
 
+//----------------------------------------------------------------------
+inline auto FApplication::isIdle() const -> bool
+{
+  // Nothing is left to do until the next input or timer event
+
+  static const auto& keyboard = FKeyboard::getInstance();
+  static auto& mouse = FMouseControl::getInstance();
+  const auto& close_list = getWidgetCloseList();
+
+  return ! ( mouse.isGpmMouseEnabled()
+          || keyboard.hasUnprocessedInput()
+          || keyboard.hasPendingInput()
+          || eventInQueue()
+          || FVTerm::hasPendingTerminalUpdates()
+          || FVTerm::hasPendingAreaUpdates()
+          || FVTerm::getFOutput()->hasPendingOutput()
+          || (close_list && ! close_list->empty()) );
+}
+
+//----------------------------------------------------------------------
+inline auto FApplication::getIdleWaitTime() const -> uInt64
+{
+  // Returns the time in µs until the next timer expires
+  // (UINT64_MAX = no limit)
+
+  auto wait_time = std::numeric_limits<uInt64>::max();
+  const auto next_timeout = FObjectTimer::getNextTimeout();
+
+  if ( next_timeout != TimeValue::max() )
+  {
+    const auto now = FObjectTimer::getCurrentTime();
+    const auto diff = next_timeout - now;
+    // Round up to avoid an early wakeup before the timer expires
+    wait_time = ( next_timeout > now )
+              ? uInt64(duration_cast<microseconds>(diff).count()) + 1
+              : 0;
+  }
+
+  if ( max_idle_wait > 0 )
+    wait_time = std::min(wait_time, max_idle_wait);
+
+  return wait_time;
+}
+
+//----------------------------------------------------------------------
+void FApplication::waitForEvent (uInt64 wait_time) const
+{
+  // Sleeps until keyboard input is available, a signal arrives
+  // or the wait time (in µs) has elapsed
+
+  const int stdin_no = FTermios::getStdIn();
+  fd_set ifds{};
+  FD_ZERO(&ifds);
+  FD_SET(stdin_no, &ifds);
+  struct timespec ts{};
+  struct timespec* timeout{nullptr};
+
+  if ( wait_time != std::numeric_limits<uInt64>::max() )
+  {
+    ts.tv_sec = time_t(wait_time / 1'000'000);
+    ts.tv_nsec = long(wait_time % 1'000'000) * 1000;
+    timeout = &ts;
+  }
+
+  // SIGWINCH is blocked until pselect() waits, so that a
+  // terminal resize cannot get lost between check and wait
+  sigset_t winch_mask{};
+  sigset_t old_mask{};
+  sigemptyset (&winch_mask);
+  sigaddset (&winch_mask, SIGWINCH);
+  sigprocmask (SIG_BLOCK, &winch_mask, &old_mask);
+
+  if ( ! FVTerm::getFOutput()->hasTerminalResized() )
+    pselect (stdin_no + 1, &ifds, nullptr, nullptr, timeout, &old_mask);
+
+  sigprocmask (SIG_SETMASK, &old_mask, nullptr);
+}
+
 //----------------------------------------------------------------------
 void FApplication::keyPressed()
 {
@@ -727,6 +829,10 @@ inline void FApplication::performKeyboardAction()
   {
     processTerminalFocus (keyboard.getKey());  // Term focus-in/focus-out
   }
+  else if ( keyboard.getKey() == FKey::Bracketed_paste )
+  {
+    sendPasteEvent();
+  }
   else
   {
     const bool acceptKeyDown = sendKeyDownEvent (keyboard_widget);
@@ -808,6 +914,35 @@ inline auto FApplication::sendKeyUpEvent (FWidget* widget) const -> bool
   return k_up_ev.isAccepted();
 }
 
+//----------------------------------------------------------------------
+inline void FApplication::sendPasteEvent() const
+{
+  // Send the pasted text in one piece
+  static const auto& keyboard = FKeyboard::getInstance();
+  FPasteEvent paste_ev (Event::Paste, keyboard.getPasteText());
+  sendEvent (keyboard_widget, &paste_ev);
+
+  if ( paste_ev.isAccepted() )
+    return;
+
+  // Fall back to single key press events if the widget
+  // does not handle paste events
+  wchar_t prev_char{L'\0'};
+
+  for (const auto& ch : paste_ev.getText())
+  {
+    const bool is_crlf = ( ch == L'\n' && prev_char == L'\r' );
+    prev_char = ch;
+
+    if ( is_crlf )
+      continue;  // Send only one return key for CR + LF
+
+    const auto key = ( ch == L'\r' || ch == L'\n' ) ? FKey::Return : FKey(ch);
+    FKeyEvent k_press_ev (Event::KeyPress, key);
+    sendEvent (keyboard_widget, &k_press_ev);
+  }
+}
+
 //----------------------------------------------------------------------
 inline void FApplication::sendKeyboardAccelerator()
 {
@@ -852,7 +987,11 @@ void FApplication::queuingKeyboardInput() const
   keyboard.escapeKeyHandling();  // special case: Esc key
   keyboard.clearKeyBufferOnTimeout();
 
-  if ( isKeyPressed() )
+  // Only a short input check, because an idle
+  // event loop waits in waitForEvent()
+  constexpr uInt64 min_blocking_time{1};  // 1 µs
+
+  if ( isKeyPressed(min_blocking_time) )
     keyboard.fetchKeyCode();
 }
 
@@ -1239,7 +1378,8 @@ void FApplication::sendWheelEvent ( const FMouseData& md
   FWheelEvent wheel_ev ( Event::MouseWheel
                        , widgetMousePos
                        , mouse_position
-                       , mouse_wheel );
+                       , mouse_wheel
+                       , md.getWheelDelta() );
   auto scroll_over_widget = clicked_widget;
   setClickedWidget(nullptr);
   sendEvent (scroll_over_widget, &wheel_ev);
@@ -1334,9 +1474,15 @@ auto FApplication::processNextEvent() -> bool
     flush();  // Flush output buffer (via an instance of FOutput)
     processLogger();
   }
-  else if ( isKeyPressed(next_event_wait) )
+  else if ( ! isIdle() )
+  {
+    if ( isKeyPressed(next_event_wait) )
+      time_last_event = TimeValue{};
+  }
+  else
   {
-    time_last_event = TimeValue{};
+    waitForEvent (getIdleWaitTime());
+    time_last_event = TimeValue{};  // Process the event after the wakeup
   }
 
   processExternalUserEvent();
@@ -1377,11 +1523,12 @@ auto FApplication::isEventProcessable ( FObject* receiver
       && ! window->getFlags().visibility.modal
       && ! window->isMenuWidget() )
     {
-      constexpr std::array<const Event, 13> blocked_events
+      constexpr std::array<const Event, 14> blocked_events
       {{
         Event::KeyPress,
         Event::KeyUp,
         Event::KeyDown,
+        Event::Paste,
         Event::MouseDown,
         Event::MouseUp,
         Event::MouseDoubleClick,
@@ -126,8 +126,9 @@ class FApplication : public FWidget
     static auto  getKeyboardWidget() -> FWidget*;
     static auto  getLog() -> FLogPtr&;
 
-    // Mutator
+    // Mutators
     static void  setLog (const FLogPtr&);
+    static void  setMaxIdleWait (uInt64);
 
     // Inquiry
     static auto  isQuit() -> bool;
@@ -179,6 +180,9 @@ class FApplication : public FWidget
     void         destroyLog();
     void         findKeyboardWidget() const;
     auto         isKeyPressed (uInt64 = 0U) const -> bool;
+    auto         isIdle() const -> bool;
+    auto         getIdleWaitTime() const -> uInt64;
+    void         waitForEvent (uInt64) const;
     void         keyPressed();
     void         keyReleased() const;
     void         escapeKeyPressed() const;
@@ -190,6 +194,7 @@ class FApplication : public FWidget
     auto         sendKeyDownEvent (FWidget*) const -> bool;
     auto         sendKeyPressEvent (FWidget*) const -> bool;
     auto         sendKeyUpEvent (FWidget*) const -> bool;
+    void         sendPasteEvent() const;
     void         sendKeyboardAccelerator();
     auto         hasDataInQueue() const -> bool;
     void         queuingKeyboardInput() const;
@@ -242,6 +247,7 @@ class FApplication : public FWidget
     FMouseHandlerList mouse_handler_list{};
     bool              has_terminal_resized{false};
     static uInt64     next_event_wait;
+    static uInt64     max_idle_wait;
     static TimeValue  time_last_event;
     static int        loop_level;
     static int        quit_code;
@@ -57,6 +57,7 @@ enum class Event
   KeyPress,          // key pressed
   KeyUp,             // key released
   KeyDown,           // key pressed
+  Paste,             // bracketed paste
   MouseDown,         // mouse button pressed
   MouseUp,           // mouse button released
   MouseDoubleClick,  // mouse button double click
@@ -701,6 +702,8 @@ enum class FKey : uInt32
   Shift_Ctrl_Meta_menu       = 0x01600007,  // shifted control-M-menu
   Term_Focus_In              = 0x01900000,  // Terminal focus-in event
   Term_Focus_Out             = 0x01900001,  // Terminal focus-out event
+  Bracketed_paste_start      = 0x01900002,  // Bracketed paste start
+  Bracketed_paste            = 0x01900003,  // Bracketed paste data
   Escape_mintty              = 0x0200001b,  // mintty Esc
   X11mouse                   = 0x02000020,  // xterm mouse
   Extended_mouse             = 0x02000021,  // SGR extended mouse
@@ -1543,6 +1546,11 @@ enum class Termcap
   t_cursor_style,
   t_scroll_forward,
   t_scroll_reverse,
+  t_change_scroll_region,
+  t_insert_line,
+  t_delete_line,
+  t_parm_insert_line,
+  t_parm_delete_line,
   t_enter_ca_mode,
   t_exit_ca_mode,
   t_enable_acs,
@@ -73,6 +73,32 @@ void FKeyEvent::ignore()
 { accpt = false; }
 
 
+//----------------------------------------------------------------------
+// class FPasteEvent
+//----------------------------------------------------------------------
+
+FPasteEvent::FPasteEvent (Event ev_type, FString str)  // constructor
+  : FEvent{ev_type}
+  , text{std::move(str)}
+{ }
+
+//----------------------------------------------------------------------
+auto FPasteEvent::getText() const & -> const FString&
+{ return text; }
+
+//----------------------------------------------------------------------
+auto FPasteEvent::isAccepted() const -> bool
+{ return accpt; }
+
+//----------------------------------------------------------------------
+void FPasteEvent::accept()
+{ accpt = true; }
+
+//----------------------------------------------------------------------
+void FPasteEvent::ignore()
+{ accpt = false; }
+
+
 //----------------------------------------------------------------------
 // class FMouseEvent
 //----------------------------------------------------------------------
@@ -138,18 +164,21 @@ void FMouseEvent::setTermPos (const FPoint& termPos)
 FWheelEvent::FWheelEvent ( Event ev_type  // constructor
                          , const FPoint& pos
                          , const FPoint& termPos
-                         , MouseWheel wheel )
+                         , MouseWheel wheel
+                         , int delta )
   : FEvent{ev_type}
   , p{pos}
   , tp{termPos}
   , w{wheel}
+  , d{delta}
 { }
 
 //----------------------------------------------------------------------
 FWheelEvent::FWheelEvent ( Event ev_type  // constructor
                          , const FPoint& pos
-                         , MouseWheel wheel )
-  : FWheelEvent{ev_type, pos, FPoint{}, wheel}
+                         , MouseWheel wheel
+                         , int delta )
+  : FWheelEvent{ev_type, pos, FPoint{}, wheel, delta}
 { }
 
 //----------------------------------------------------------------------
@@ -180,6 +209,10 @@ auto FWheelEvent::getTermY() const -> int
 auto FWheelEvent::getWheel() const -> MouseWheel
 { return w; }
 
+//----------------------------------------------------------------------
+auto FWheelEvent::getDelta() const -> int
+{ return d; }
+
 
 //----------------------------------------------------------------------
 // class FFocusEvent
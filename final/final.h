@@ -57,6 +57,7 @@
 #include <final/output/fcolorpalette.h>
 #include <final/output/foutput.h>
 #include <final/output/tty/fcharmap.h>
+#include <final/output/tty/fcharwidth.h>
 #include <final/output/tty/foptiattr.h>
 #include <final/output/tty/foptimove.h>
 #include <final/output/tty/ftermcap.h>
@@ -74,11 +75,13 @@
 #include <final/util/fdata.h>
 #include <final/util/flogger.h>
 #include <final/util/flog.h>
+#include <final/util/fmappedtextfile.h>
 #include <final/util/fpoint.h>
 #include <final/util/frect.h>
 #include <final/util/fsize.h>
 #include <final/util/fstring.h>
 #include <final/util/fsystem.h>
+#include <final/vterm/fchar_functions.h>
 #include <final/vterm/fcolorpair.h>
 #include <final/vterm/fstyle.h>
 #include <final/vterm/fvtermbuffer.h>
@@ -21,7 +21,9 @@
 ***********************************************************************/
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
+#include <utility>
 
 #include "final/fc.h"
 #include "final/fevent.h"
@@ -51,7 +53,10 @@ FObject::~FObject()  // destructor
   // Delete children objects
   if ( hasChildren() )
   {
-    auto delete_list = children_list;
+    // The children find an empty list when they detach themselves,
+    // so there is no linear search per child
+    FObjectList delete_list{};
+    std::swap (delete_list, children_list);
 
     for (auto&& obj : delete_list)
       delete obj;
@@ -134,9 +139,12 @@ void FObject::delChild (FObject* obj) &
 
   obj->parent_obj = nullptr;
   obj->has_parent = false;
-  auto list_end = children_list.end();
-  auto last = std::remove (children_list.begin(), list_end, obj);
-  children_list.erase(last, list_end);
+  // An object is only listed once. Searching from the back
+  // makes the removal of the last child constant.
+  const auto iter = std::find (children_list.rbegin(), children_list.rend(), obj);
+
+  if ( iter != children_list.rend() )
+    children_list.erase(std::next(iter).base());
 }
 
 //----------------------------------------------------------------------
@@ -52,6 +52,8 @@ FStartOptions::FStartOptions()
 #endif
   , dark_theme{false}
   , color_change{true}
+  , bracketed_paste{true}
+  , terminal_detection_cache{false}
 { }
 
 
@@ -75,6 +77,8 @@ void FStartOptions::setDefault()
   encoding = Encoding::Unknown;
   dark_theme = false;
   terminal_focus_events = true;
+  bracketed_paste = true;
+  terminal_detection_cache = false;
 
 #if defined(__FreeBSD__) || defined(__DragonFly__) || defined(UNIT_TEST)
   meta_sends_escape = true;
@@ -63,27 +63,29 @@ class FStartOptions final
     void setDefault();
 
     // Data members
-    uInt8 cursor_optimisation   : 1;
-    uInt8 mouse_support         : 1;
-    uInt8 terminal_detection    : 1;
-    uInt8 terminal_data_request : 1;
-    uInt8 terminal_focus_events : 1;
-    uInt8 sgr_optimizer         : 1;
-    uInt8 vgafont               : 1;
-    uInt8 newfont               : 1;
+    uInt8 cursor_optimisation       : 1;
+    uInt8 mouse_support             : 1;
+    uInt8 terminal_detection        : 1;
+    uInt8 terminal_data_request     : 1;
+    uInt8 terminal_focus_events     : 1;
+    uInt8 sgr_optimizer             : 1;
+    uInt8 vgafont                   : 1;
+    uInt8 newfont                   : 1;
 
 #if defined(__FreeBSD__) || defined(__DragonFly__) || defined(UNIT_TEST)
-    uInt8 meta_sends_escape     : 1;
-    uInt8 change_cursorstyle    : 1;
-    uInt8                       : 6;  // padding bits
+    uInt8 meta_sends_escape         : 1;
+    uInt8 change_cursorstyle        : 1;
+    uInt8                           : 6;  // padding bits
 #elif defined(__NetBSD__) || defined(__OpenBSD__)
-    uInt8 meta_sends_escape     : 1;
-    uInt8                       : 7;  // padding bits
+    uInt8 meta_sends_escape         : 1;
+    uInt8                           : 7;  // padding bits
 #endif
 
-    uInt16 dark_theme           : 1;
-    uInt16 color_change         : 1;
-    uInt16                      : 14;  // padding bits
+    uInt16 dark_theme               : 1;
+    uInt16 color_change             : 1;
+    uInt16 bracketed_paste          : 1;
+    uInt16 terminal_detection_cache : 1;
+    uInt16                          : 12;  // padding bits
 
     Encoding      encoding{Encoding::Unknown};
     std::ofstream logfile_stream{};
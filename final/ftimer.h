@@ -39,7 +39,9 @@
 #include <algorithm>
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "final/fevent.h"
@@ -90,6 +92,8 @@ class FTimer
       return system_clock::now();  // Get the current time
     }
 
+    auto  getNextTimeout() const -> TimeValue;
+
     // Inquiries
     auto  isTimeout (const TimeValue&, uInt64) -> bool;
 
@@ -108,8 +112,39 @@ class FTimer
       ObjectT*     object;
     };
 
+    // Timer queue as a binary min-heap ordered by timeout with an
+    // index from the timer id to the heap position
+    class FTimerList
+    {
+      public:
+        // Accessors
+        auto size() const noexcept -> std::size_t;
+        auto front() const -> const FTimerData&;
+
+        // Inquiries
+        auto empty() const noexcept -> bool;
+        auto contains (int) const -> bool;
+
+        // Methods
+        void push (const FTimerData&);
+        void pop();
+        auto remove (int) -> bool;
+        template <typename PredicateT>
+        void removeIf (PredicateT);
+        void clear();
+
+      private:
+        // Methods
+        void siftUp (std::size_t);
+        void siftDown (std::size_t);
+        void swapEntries (std::size_t, std::size_t);
+
+        // Data members
+        std::vector<FTimerData>              heap{};
+        std::unordered_map<int, std::size_t> position{};
+    };
+
     // Using-declaration
-    using FTimerList = std::vector<FTimerData>;
     using FTimerListUniquePtr = std::unique_ptr<FTimerList>;
 
     // Accessor
@@ -135,6 +170,28 @@ class FTimer
 auto getNextId() -> int;
 
 // public methods of FTimer
+//----------------------------------------------------------------------
+template <typename ObjectT>
+auto FTimer<ObjectT>::getNextTimeout() const -> TimeValue
+{
+  // Returns the expiry time of the next active timer
+  // or TimeValue::max() if no timer is active
+
+  auto next_timeout = TimeValue::max();
+  std::shared_lock<std::shared_timed_mutex> lock ( internal::timer_var::mutex
+                                                 , std::defer_lock );
+
+  if ( ! lock.try_lock() )
+    return getCurrentTime();  // The timer list is being modified
+
+  const auto& timer_list = globalTimerList();
+
+  if ( timer_list && ! timer_list->empty() )
+    next_timeout = timer_list->front().timeout;
+
+  return next_timeout;
+}
+
 //----------------------------------------------------------------------
 template <typename ObjectT>
 inline auto FTimer<ObjectT>::isTimeout (const TimeValue& time, uInt64 timeout) -> bool
@@ -163,18 +220,7 @@ auto FTimer<ObjectT>::addTimer (ObjectT* object, int interval) & -> int
   int id = getNextId();
   const auto time_interval = milliseconds(interval);
   const auto timeout = getCurrentTime() + time_interval;
-  FTimerData timedata{ id, time_interval, timeout, object };
-
-  // Insert in list sorted by timeout
-  timer_list->insert( std::lower_bound( timer_list->cbegin()
-                                      , timer_list->cend()
-                                      , timedata
-                                      , [] (const auto& a, const auto& b)
-                                        {
-                                          return a.timeout < b.timeout;
-                                        }
-                                      )
-                    , timedata);
+  timer_list->push({ id, time_interval, timeout, object });
   return id;
 }
 
@@ -193,19 +239,7 @@ auto FTimer<ObjectT>::delTimer (int id) const & -> bool
   if ( ! timer_list || timer_list->empty() )
     return false;
 
-  auto iter = std::find_if ( timer_list->cbegin()
-                           , timer_list->cend()
-                           , [id] (const auto& timer)
-                             {
-                               return timer.id == id;
-                             }
-                           );
-
-  if ( iter == timer_list->cend() )
-    return false;
-
-  timer_list->erase(iter);
-  return true;
+  return timer_list->remove(id);
 }
 
 //----------------------------------------------------------------------
@@ -220,14 +254,11 @@ auto FTimer<ObjectT>::delOwnTimers(const ObjectT* object) const & -> bool
   if ( ! timer_list || timer_list->empty() )
     return false;
 
-  timer_list->erase ( std::remove_if( timer_list->begin()
-                                    , timer_list->end()
-                                    , [&object] (const auto& timer)
-                                      {
-                                        return timer.object == object;
-                                      }
-                                    )
-                    , timer_list->end() );
+  timer_list->removeIf ( [&object] (const auto& timer)
+                         {
+                           return timer.object == object;
+                         }
+                       );
   return true;
 }
 
@@ -244,7 +275,6 @@ auto FTimer<ObjectT>::delAllTimers() const & -> bool
     return false;
 
   timer_list->clear();
-  timer_list->shrink_to_fit();
   return true;
 }
 
@@ -255,7 +285,7 @@ template <typename CallbackT>
 auto FTimer<ObjectT>::processTimerEvent (CallbackT callback) -> uInt
 {
   uInt activated{0};
-  std::shared_lock<std::shared_timed_mutex> lock ( internal::timer_var::mutex
+  std::unique_lock<std::shared_timed_mutex> lock ( internal::timer_var::mutex
                                                  , std::defer_lock );
 
   if ( ! lock.try_lock() )
@@ -267,19 +297,34 @@ auto FTimer<ObjectT>::processTimerEvent (CallbackT callback) -> uInt
     return 0;
 
   const auto& currentTime = getCurrentTime();
+  std::vector<FTimerData> expired_timers{};
 
-  for (auto&& timer : *timer_list)
+  // Only the expired timers at the front of the heap are visited
+  while ( ! timer_list->empty()
+       && ! (currentTime < timer_list->front().timeout) )
   {
-    if ( ! timer.id
-      || ! timer.object
-      || currentTime < timer.timeout )  // Timer not expired
-      continue;
+    expired_timers.push_back(timer_list->front());
+    timer_list->pop();
+  }
 
+  for (auto&& timer : expired_timers)  // Reschedule each timer once
+  {
     timer.timeout += timer.interval;
 
     if ( timer.timeout < currentTime )
       timer.timeout = currentTime + timer.interval;
 
+    timer_list->push(timer);
+  }
+
+  for (const auto& timer : expired_timers)
+  {
+    // Skip timers deleted by a previous callback
+    if ( ! timer.id
+      || ! timer.object
+      || ! timer_list->contains(timer.id) )
+      continue;
+
     if ( timer.interval > microseconds(0) )
       ++activated;
 
@@ -301,6 +346,151 @@ auto FTimer<ObjectT>::globalTimerList() -> const FTimerListUniquePtr&
   return timer_list;
 }
 
+
+// FTimer<ObjectT>::FTimerList inline functions
+//----------------------------------------------------------------------
+template <typename ObjectT>
+inline auto FTimer<ObjectT>::FTimerList::size() const noexcept -> std::size_t
+{ return heap.size(); }
+
+//----------------------------------------------------------------------
+template <typename ObjectT>
+inline auto FTimer<ObjectT>::FTimerList::front() const -> const FTimerData&
+{ return heap.front(); }
+
+//----------------------------------------------------------------------
+template <typename ObjectT>
+inline auto FTimer<ObjectT>::FTimerList::empty() const noexcept -> bool
+{ return heap.empty(); }
+
+//----------------------------------------------------------------------
+template <typename ObjectT>
+inline auto FTimer<ObjectT>::FTimerList::contains (int id) const -> bool
+{ return position.find(id) != position.end(); }
+
+//----------------------------------------------------------------------
+template <typename ObjectT>
+void FTimer<ObjectT>::FTimerList::push (const FTimerData& timer)
+{
+  heap.push_back(timer);
+  position[timer.id] = heap.size() - 1;
+  siftUp (heap.size() - 1);
+}
+
+//----------------------------------------------------------------------
+template <typename ObjectT>
+inline void FTimer<ObjectT>::FTimerList::pop()
+{
+  if ( ! heap.empty() )
+    remove (heap.front().id);
+}
+
+//----------------------------------------------------------------------
+template <typename ObjectT>
+auto FTimer<ObjectT>::FTimerList::remove (int id) -> bool
+{
+  // Removes a timer in O(log n) via the position index
+
+  const auto iter = position.find(id);
+
+  if ( iter == position.end() )
+    return false;
+
+  const auto pos = iter->second;
+  const auto last = heap.size() - 1;
+
+  if ( pos != last )
+    swapEntries (pos, last);
+
+  heap.pop_back();
+  position.erase(id);
+
+  if ( pos < heap.size() )
+  {
+    siftDown (pos);
+    siftUp (pos);
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+template <typename ObjectT>
+template <typename PredicateT>
+void FTimer<ObjectT>::FTimerList::removeIf (PredicateT predicate)
+{
+  heap.erase ( std::remove_if(heap.begin(), heap.end(), predicate)
+             , heap.end() );
+  position.clear();
+
+  for (std::size_t pos{0}; pos < heap.size(); pos++)
+    position[heap[pos].id] = pos;
+
+  // Restore the heap order
+  for (auto pos = heap.size() / 2; pos > 0; pos--)
+    siftDown (pos - 1);
+}
+
+//----------------------------------------------------------------------
+template <typename ObjectT>
+inline void FTimer<ObjectT>::FTimerList::clear()
+{
+  heap.clear();
+  heap.shrink_to_fit();
+  position.clear();
+}
+
+//----------------------------------------------------------------------
+template <typename ObjectT>
+void FTimer<ObjectT>::FTimerList::siftUp (std::size_t pos)
+{
+  while ( pos > 0 )
+  {
+    const auto parent = (pos - 1) / 2;
+
+    if ( ! (heap[pos].timeout < heap[parent].timeout) )
+      return;
+
+    swapEntries (pos, parent);
+    pos = parent;
+  }
+}
+
+//----------------------------------------------------------------------
+template <typename ObjectT>
+void FTimer<ObjectT>::FTimerList::siftDown (std::size_t pos)
+{
+  const auto count = heap.size();
+
+  while ( true )
+  {
+    auto smallest = pos;
+    const auto left = 2 * pos + 1;
+    const auto right = left + 1;
+
+    if ( left < count && heap[left].timeout < heap[smallest].timeout )
+      smallest = left;
+
+    if ( right < count && heap[right].timeout < heap[smallest].timeout )
+      smallest = right;
+
+    if ( smallest == pos )
+      return;
+
+    swapEntries (pos, smallest);
+    pos = smallest;
+  }
+}
+
+//----------------------------------------------------------------------
+template <typename ObjectT>
+inline void FTimer<ObjectT>::FTimerList::swapEntries (std::size_t a, std::size_t b)
+{
+  std::swap (heap[a], heap[b]);
+  position[heap[a].id] = a;
+  position[heap[b].id] = b;
+}
+
 // class forward declaration
 class FObject;
 
@@ -331,6 +521,11 @@ class FObjectTimer
       return timer->getCurrentTime();
     }
 
+    static inline auto getNextTimeout() -> TimeValue
+    {
+      return timer->getNextTimeout();
+    }
+
     // Inquiries
     static auto isTimeout (const TimeValue& time, uInt64 timeout) -> bool
     {
@@ -51,6 +51,10 @@
   #define USE_POSIX_TIMER
 #endif
 
+#if defined(__linux__)
+  #define USE_TIMERFD_TIMER
+#endif
+
 #define null nullptr
 
 #define badAllocOutput(object_name)              \
@@ -329,11 +333,10 @@ enum class FColor : uInt16;   // forward declaration
 
 struct FChar
 {
-  FUnicode   ch{};            // Character code
-  FUnicode   encoded_char{};  // Encoded output character
-  FColor     fg_color{};      // Foreground color
-  FColor     bg_color{};      // Background color
-  FAttribute attr{};          // Attributes
+  FUnicode   ch{};        // Character code
+  FColor     fg_color{};  // Foreground color
+  FColor     bg_color{};  // Background color
+  FAttribute attr{};      // Attributes
 };
 
 // FChar operator functions
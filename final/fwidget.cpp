@@ -1401,6 +1401,13 @@ void FWidget::onKeyDown (FKeyEvent*)
   // to receive key down events for the widget
 }
 
+//----------------------------------------------------------------------
+void FWidget::onPaste (FPasteEvent*)
+{
+  // This event handler can be reimplemented in a subclass
+  // to receive bracketed paste events for the widget
+}
+
 //----------------------------------------------------------------------
 void FWidget::onMouseDown (FMouseEvent*)
 {
@@ -1577,6 +1584,12 @@ inline void FWidget::mapKeyEvents()
       {
         KeyDownEvent(static_cast<FKeyEvent*>(ev));
       }
+    },
+    { Event::Paste,
+      [this] (FEvent* ev)
+      {
+        onPaste (static_cast<FPasteEvent*>(ev));
+      }
     }
   } );
 }
@@ -1902,10 +1915,13 @@ void FWidget::emitWheelCallback (const FWheelEvent* ev) const
 {
   const auto& wheel = ev->getWheel();
 
-  if ( wheel == MouseWheel::Up )
-    emitCallback("mouse-wheel-up");
-  else if ( wheel == MouseWheel::Down )
-    emitCallback("mouse-wheel-down");
+  for (auto i{0}; i < ev->getDelta(); i++)
+  {
+    if ( wheel == MouseWheel::Up )
+      emitCallback("mouse-wheel-up");
+    else if ( wheel == MouseWheel::Down )
+      emitCallback("mouse-wheel-down");
+  }
 }
 
 //----------------------------------------------------------------------
@@ -281,6 +281,7 @@ class FWidget : public FVTerm
     template <typename... Args>
     void  delCallback (Args&&...) & noexcept;
     void  emitCallback (const FString&) const &;
+    void  emitCallback (FSignalId) const &;
     void  addAccelerator (FKey) &;
     virtual void addAccelerator (FKey, FWidget*) &;
     void  delAccelerator () &;
@@ -335,6 +336,7 @@ class FWidget : public FVTerm
     virtual void onKeyPress (FKeyEvent*);
     virtual void onKeyUp (FKeyEvent*);
     virtual void onKeyDown (FKeyEvent*);
+    virtual void onPaste (FPasteEvent*);
     virtual void onMouseDown (FMouseEvent*);
     virtual void onMouseUp (FMouseEvent*);
     virtual void onMouseDoubleClick (FMouseEvent*);
@@ -954,6 +956,12 @@ inline void FWidget::emitCallback (const FString& emit_signal) const &
   callback_impl.emitCallback(emit_signal);
 }
 
+//----------------------------------------------------------------------
+inline void FWidget::emitCallback (FSignalId emit_signal) const &
+{
+  callback_impl.emitCallback(emit_signal);
+}
+
 //----------------------------------------------------------------------
 inline void FWidget::addAccelerator (FKey key) &
 { addAccelerator (key, this); }
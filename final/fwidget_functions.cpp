@@ -362,7 +362,6 @@ void drawTransparentShadow (FWidget* w)
   const FChar transparent_char
   {
     { { L'\0',  L'\0', L'\0', L'\0', L'\0' } },
-    { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
     FColor::Default,
     FColor::Default,
     { { 0x00, 0x20, 0x00, 0x00} }  // byte 0..3 (byte 1 = 0x32 = transparent)
@@ -370,18 +369,17 @@ void drawTransparentShadow (FWidget* w)
 
   const FChar color_overlay_char
   {
-    { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
     { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
     wc->shadow.fg,
     wc->shadow.bg,
     { { 0x00, 0x40, 0x00, 0x00} }  // byte 0..3 (byte 1 = 0x64 = color_overlay)
   };
 
-  auto* area_pos = &area.getFChar(int(width), 0);
   auto& area_changes = area.changes;
 
   if ( shadow_width > 0 )  // Draw right shadow
   {
+    auto* area_pos = &area.getFChar(int(width), 0);
     std::fill (area_pos, area_pos + shadow_width, transparent_char);
     area_changes[0].xmin = std::min(area_changes[0].xmin, width);
     area_changes[0].xmax = width + shadow_width - 1;
@@ -389,27 +387,28 @@ void drawTransparentShadow (FWidget* w)
 
     for (std::size_t y{1}; y < height; y++)
     {
-      area_pos += shadow_width + width;
+      area_pos = &area.getFChar(int(width), int(y));
       area_changes[y].xmin = std::min(area_changes[y].xmin, width);
       area_changes[y].xmax = width + shadow_width - 1;
       area_changes[y].trans_count += shadow_width;
       std::fill (area_pos, area_pos + shadow_width, color_overlay_char);
     }
-
-    area_pos += shadow_width;
   }
 
   for (std::size_t y{height}; y < height + shadow_height; y++)  // Draw bottom shadow
   {
+    auto* area_pos = &area.getFChar(0, int(y));
     area_changes[y].xmin = 0;
     area_changes[y].xmax = width + shadow_width - 1;
     area_changes[y].trans_count += width + shadow_width;
     std::fill (area_pos, area_pos + shadow_width, transparent_char);
     area_pos += shadow_width;
     std::fill (area_pos, area_pos + width, color_overlay_char);
-    area_pos += width;
   }
 
+  if ( height + shadow_height > 0 )
+    area.addChangedLines (0, int(height + shadow_height) - 1);
+
   area.has_changes = true;
 
   if ( FVTerm::getFOutput()->isMonochron() )
@@ -430,28 +429,24 @@ void drawBlockShadow (FWidget* w)
   {{
     {
       { { wchar_t(UniChar::LowerHalfBlock),  L'\0', L'\0', L'\0', L'\0' } },  // ▄
-      { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
       wc->shadow.bg,
       FColor::Default,
       { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3 (byte 2 = 0x08 = char_width 1)
     },
     {
       { { wchar_t(UniChar::FullBlock),  L'\0', L'\0', L'\0', L'\0' } },  // █
-      { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
       wc->shadow.bg,
       FColor::Default,
       { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3 (byte 2 = 0x08 = char_width 1)
     },
     {
       { { L' ',  L'\0', L'\0', L'\0', L'\0' } },  // ' '
-      { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
       FColor::Default,
       FColor::Default,
       { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3 (byte 2 = 0x08 = char_width 1)
     },
     {
       { { wchar_t(UniChar::UpperHalfBlock),  L'\0', L'\0', L'\0', L'\0' } },  // ▄
-      { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
       wc->shadow.bg,
       FColor::Default,
       { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3 (byte 2 = 0x08 = char_width 1)
@@ -485,7 +480,6 @@ void clearBlockShadow (FWidget* w)
   FChar spacer_char
   {
     { { L' ',  L'\0', L'\0', L'\0', L'\0' } },  // ' '
-    { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
     FColor::Default,
     FColor::Default,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3 (byte 2 = 0x08 = char_width 1)
@@ -549,6 +543,7 @@ void drawGenericBlockShadow ( FWidget* w
   area_changes[y].xmin = std::min(area_changes[y].xmin, uInt(x_offset));
   area_changes[y].xmax = std::max(area_changes[y].xmax, x_offset + width);
   area_changes[y].trans_count += width + 1;
+  area.addChangedLines (int(y_offset), int(y));
 }
 
 //----------------------------------------------------------------------
@@ -864,6 +859,7 @@ void drawGenericBox ( FWidget* w, const FRect& r
   area_changes[y].xmin = std::min(area_changes[y].xmin, x_offset + uInt(box.getX1()));
   area_changes[y].xmax = std::max(area_changes[y].xmax, x_offset + uInt(box.getX2()));
   area_changes[y].trans_count += uInt(is_transparent) * box.getWidth();
+  area.addChangedLines (int(y_offset) + box.getY1(), int(y));
   area.has_changes = true;
 }
 
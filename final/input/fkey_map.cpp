@@ -392,6 +392,7 @@ FKeyMap::KeyMapType FKeyMap::fkey_table =
   { FKey::Shift_Ctrl_Meta_menu      , {"\033[29;8~"}  , 7},  // Shift-Ctrl-M-Menu
   { FKey::Term_Focus_In             , {"\033[I"}      , 3},  // Terminal focus-in event
   { FKey::Term_Focus_Out            , {"\033[O"}      , 3},  // Terminal focus-out event
+  { FKey::Bracketed_paste_start     , {"\033[200~"}   , 6},  // Bracketed paste start
   { FKey::Escape_mintty             , {"\033O["}, 3},  // Mintty Esc
   { FKey::Meta_tab                  , {"\033\t"}, 2},  // M-Tab
   { FKey::Meta_enter                , {"\033\n"}, 2},  // M-Enter
@@ -785,6 +786,8 @@ constexpr FKeyMap::KeyNameType FKeyMap::fkeyname =
   { FKey::Shift_Ctrl_Meta_menu      , {"Shift+Ctrl+Meta+Menu"} },
   { FKey::Term_Focus_In             , {"terminal focus-in"} },
   { FKey::Term_Focus_Out            , {"terminal focus-out"} },
+  { FKey::Bracketed_paste_start     , {"bracketed paste start"} },
+  { FKey::Bracketed_paste           , {"bracketed paste"} },
   { FKey::Meta_tab                  , {"Meta+Tab"} },
   { FKey::Meta_enter                , {"Meta+Enter"} },
   { FKey::Meta_space                , {"Meta+Space"} },
@@ -72,12 +72,12 @@ FKeyboard::FKeyboard()
 
   // Sort the known key map by string length
   auto& key_map = FKeyMap::getKeyMap();
-  std::sort ( key_map.begin(), key_map.end()
-            , [] (const auto& lhs, const auto& rhs)
-              {
-                return lhs.length < rhs.length;
-              }
-            );
+  std::stable_sort ( key_map.begin(), key_map.end()
+                   , [] (const auto& lhs, const auto& rhs)
+                     {
+                       return lhs.length < rhs.length;
+                     }
+                   );
 }
 
 
@@ -144,7 +144,7 @@ void FKeyboard::setNonBlockingInput (bool enable)
 //----------------------------------------------------------------------
 auto FKeyboard::hasUnprocessedInput() const noexcept -> bool
 {
-  return fifo_buf.hasData();
+  return fifo_buf.hasData() || hasBufferedInput();
 }
 
 //----------------------------------------------------------------------
@@ -153,6 +153,9 @@ auto FKeyboard::isKeyPressed (uInt64 blocking_time) -> bool
   if ( has_pending_input )
     return false;
 
+  if ( hasBufferedInput() )  // Bytes already read but not yet parsed
+    return (has_pending_input = true);
+
   fd_set ifds{};
   struct timeval tv{};
   const int stdin_no = FTermios::getStdIn();
@@ -229,6 +232,12 @@ void FKeyboard::processQueuedInput()
     key = fkey_queue.front();
     fkey_queue.pop();
 
+    if ( key == FKey::Bracketed_paste && ! paste_queue.empty() )
+    {
+      paste_text = std::move(paste_queue.front());
+      paste_queue.pop();
+    }
+
     if ( key > FKey::None )
     {
       keyPressedCommand();
@@ -440,10 +449,26 @@ auto FKeyboard::UTF8decode (const std::size_t len) const noexcept -> FKey
 //----------------------------------------------------------------------
 inline auto FKeyboard::readKey() -> ssize_t
 {
-  setNonBlockingInput();
-  const ssize_t bytes = read(FTermios::getStdIn(), &read_character, 1);
-  unsetNonBlockingInput();
-  return bytes;
+  // Returns the next byte from the read buffer. When the buffer
+  // is exhausted, it is refilled with a single non-blocking read
+  // of up to READ_BUF_SIZE bytes.
+
+  if ( ! hasBufferedInput() )
+  {
+    setNonBlockingInput();
+    const ssize_t bytes = read(FTermios::getStdIn(), read_buf.data(), READ_BUF_SIZE);
+    unsetNonBlockingInput();
+
+    if ( bytes <= 0 )
+      return bytes;
+
+    read_buf_pos = 0;
+    read_buf_len = std::size_t(bytes);
+  }
+
+  read_character = read_buf[read_buf_pos];
+  read_buf_pos++;
+  return 1;
 }
 
 //----------------------------------------------------------------------
@@ -454,6 +479,17 @@ void FKeyboard::parseKeyBuffer()
     time_keypressed = FObjectTimer::getCurrentTime();
     has_pending_input = false;
 
+    if ( bracketed_paste )
+    {
+      // Pasted text bypasses the key string parser
+      parsePasteText();
+
+      if ( fkey_queue.isFull() )
+        break;
+
+      continue;
+    }
+
     if ( ! fifo_buf.isFull() )
       fifo_buf.push(read_character);
 
@@ -472,6 +508,12 @@ void FKeyboard::parseKeyBuffer()
         break;
       }
 
+      if ( fkey == FKey::Bracketed_paste_start )
+      {
+        bracketed_paste = true;
+        break;
+      }
+
       if ( fkey != FKey::Incomplete )
         fkey_queue.emplace(fkey);
     }
@@ -483,6 +525,35 @@ void FKeyboard::parseKeyBuffer()
   }
 }
 
+//----------------------------------------------------------------------
+void FKeyboard::parsePasteText()
+{
+  // Collects the pasted text up to the bracketed paste end sequence
+  // and queues it as a single FKey::Bracketed_paste key
+
+  static constexpr char paste_end[] = CSI "201~";
+  constexpr std::size_t end_len = sizeof(paste_end) - 1;
+  const auto search_pos = ( paste_buffer.length() >= end_len )
+                          ? paste_buffer.length() - end_len + 1
+                          : 0;
+  // Take the current and all other already read characters at once
+  paste_buffer.push_back(read_character);
+  paste_buffer.append (read_buf.data() + read_buf_pos, read_buf_len - read_buf_pos);
+  read_buf_pos = read_buf_len;
+  const auto found = paste_buffer.find(paste_end, search_pos, end_len);
+
+  if ( found == std::string::npos )
+    return;
+
+  // Give the characters behind the end sequence back to the read buffer
+  read_buf_pos -= paste_buffer.length() - found - end_len;
+  paste_buffer.resize(found);
+  paste_queue.emplace(paste_buffer);
+  paste_buffer.clear();
+  bracketed_paste = false;
+  fkey_queue.emplace(FKey::Bracketed_paste);
+}
+
 //----------------------------------------------------------------------
 auto FKeyboard::parseKeyString() -> FKey
 {
@@ -41,6 +41,7 @@
 #include <array>
 #include <functional>
 #include <memory>
+#include <queue>
 #include <string>
 #include <utility>
 
@@ -91,6 +92,7 @@ class FKeyboard final
   public:
     // Constants
     static constexpr std::size_t FIFO_BUF_SIZE{512};
+    static constexpr std::size_t READ_BUF_SIZE{4096};
 
     // Using-declaration
     using keybuffer = CharRingBuffer<FIFO_BUF_SIZE>;
@@ -116,6 +118,7 @@ class FKeyboard final
     auto  getKey() const noexcept -> FKey;
     auto  getKeyName (const FKey) const -> FString;
     auto  getKeyBuffer() & noexcept -> keybuffer&;
+    auto  getPasteText() const & noexcept -> const FString&;
     auto  getKeyPressedTime() const noexcept -> TimeValue;
     static auto  getKeypressTimeout() noexcept -> uInt64;
     static auto  getReadBlockingTime() noexcept -> uInt64;
@@ -160,6 +163,7 @@ class FKeyboard final
     using FKeyMapPtr = std::shared_ptr<FKeyMap::KeyCapMapType>;
     using KeyMapEnd = FKeyMap::KeyCapMapType::const_iterator;
     using KeyQueue = FRingBuffer<FKey, MAX_QUEUE_SIZE>;
+    using ReadBuffer = std::array<char, READ_BUF_SIZE>;
 
     // Accessors
     auto  getMouseProtocolKey() const -> FKey;
@@ -170,12 +174,14 @@ class FKeyboard final
     // Inquiry
     static auto isKeypressTimeout() -> bool;
     static auto isIntervalTimeout() -> bool;
+    auto  hasBufferedInput() const noexcept -> bool;
 
     // Methods
     auto  UTF8decode (const std::size_t) const noexcept -> FKey;
     auto  readKey() -> ssize_t;
     void  parseKeyBuffer();
     auto  parseKeyString() -> FKey;
+    void  parsePasteText();
     auto  keyCorrection (const FKey&) const -> FKey;
     void  substringKeyHandling();
     void  keyPressedCommand() const;
@@ -198,6 +204,12 @@ class FKeyboard final
     KeyMapEnd         key_cap_end{};
     keybuffer         fifo_buf{};
     KeyQueue          fkey_queue{};
+    ReadBuffer        read_buf{};
+    std::size_t       read_buf_pos{0};
+    std::size_t       read_buf_len{0};
+    std::string       paste_buffer{};
+    std::queue<FString> paste_queue{};
+    FString           paste_text{};
     FKey              fkey{FKey::None};
     FKey              key{FKey::None};
     int               stdin_status_flags{0};
@@ -207,6 +219,7 @@ class FKeyboard final
     bool              utf8_input{false};
     bool              mouse_support{true};
     bool              non_blocking_stdin{false};
+    bool              bracketed_paste{false};
 };
 
 // FKeyboard inline functions
@@ -222,6 +235,10 @@ inline auto FKeyboard::getKey() const noexcept -> FKey
 inline auto FKeyboard::getKeyBuffer() & noexcept -> keybuffer&
 { return fifo_buf; }
 
+//----------------------------------------------------------------------
+inline auto FKeyboard::getPasteText() const & noexcept -> const FString&
+{ return paste_text; }
+
 //----------------------------------------------------------------------
 inline auto FKeyboard::getKeyPressedTime() const noexcept -> TimeValue
 { return time_keypressed; }
@@ -281,6 +298,10 @@ inline auto FKeyboard::hasPendingInput() const noexcept -> bool
 inline auto FKeyboard::hasDataInQueue() const -> bool
 { return ! fkey_queue.isEmpty(); }
 
+//----------------------------------------------------------------------
+inline auto FKeyboard::hasBufferedInput() const noexcept -> bool
+{ return read_buf_pos < read_buf_len; }
+
 //----------------------------------------------------------------------
 inline void FKeyboard::enableUTF8() noexcept
 { utf8_input = true; }
@@ -31,6 +31,7 @@
 #include <algorithm>
 #include <iostream>
 #include <new>
+#include <tuple>
 
 #include "final/fapplication.h"
 #include "final/fconfig.h"
@@ -97,6 +98,12 @@ auto FMouseData::getPos() const & noexcept -> const FPoint&
   return mouse;
 }
 
+//----------------------------------------------------------------------
+auto FMouseData::getWheelDelta() const noexcept -> int
+{
+  return wheel_delta;
+}
+
 //----------------------------------------------------------------------
 auto FMouseData::isLeftButtonPressed() const noexcept -> bool
 {
@@ -200,6 +207,43 @@ void FMouseData::clearButtonState() noexcept
   b_state.wheel_left     = false;
   b_state.wheel_right    = false;
   b_state.mouse_moved    = false;
+  wheel_delta            = 1;
+}
+
+//----------------------------------------------------------------------
+auto FMouseData::coalesce (const FMouseData& md) noexcept -> bool
+{
+  // Merges the following mouse event md into this event if the widgets
+  // would only see the last one: mouse moves with the same button and
+  // key state take the new position, and wheel steps in the same
+  // direction at the same position add up to one wheel delta
+
+  const auto& b = b_state;
+  const auto& mb = md.b_state;
+
+  if ( std::tie(b.left_button, b.right_button, b.middle_button)
+         != std::tie(mb.left_button, mb.right_button, mb.middle_button)
+    || std::tie(b.shift_button, b.control_button, b.meta_button)
+         != std::tie(mb.shift_button, mb.control_button, mb.meta_button)
+    || std::tie(b.wheel_up, b.wheel_down, b.wheel_left, b.wheel_right)
+         != std::tie(mb.wheel_up, mb.wheel_down, mb.wheel_left, mb.wheel_right)
+    || b.mouse_moved != mb.mouse_moved )
+    return false;
+
+  if ( b.mouse_moved )
+  {
+    mouse = md.mouse;
+    return true;
+  }
+
+  if ( (b.wheel_up || b.wheel_down || b.wheel_left || b.wheel_right)
+    && mouse == md.mouse )
+  {
+    wheel_delta += md.wheel_delta;
+    return true;
+  }
+
+  return false;
 }
 
 
@@ -1820,6 +1864,15 @@ void FMouseControl::processEvent (const TimeValue& time)
   {
     (*iter)->processEvent(time);
     auto& md = static_cast<FMouseData&>(**iter);
+
+    // Mouse moves and wheel steps that follow a not yet processed
+    // event of the same kind update it instead of being queued
+    if ( (*iter)->hasEvent()
+      && ! fmousedata_queue.isEmpty()
+      && fmousedata_queue.back()
+      && fmousedata_queue.back()->coalesce(md) )
+      return;
+
     fmousedata_queue.emplace(std::make_unique<FMouseData>(std::move(md)));
   }
 }
@@ -113,6 +113,7 @@ class FMouseData
     // Accessors
     virtual auto getClassName() const -> FString;
     auto getPos() const & noexcept -> const FPoint&;
+    auto getWheelDelta() const noexcept -> int;
 
     // Inquiries
     auto isLeftButtonPressed() const noexcept -> bool;
@@ -133,6 +134,7 @@ class FMouseData
 
     // Methods
     void clearButtonState() noexcept;
+    auto coalesce (const FMouseData&) noexcept -> bool;
 
   protected:
     // Enumerations
@@ -170,6 +172,7 @@ class FMouseData
     // Data members
     FMouseButton b_state{};
     FPoint       mouse{0, 0};  // mouse click position
+    int          wheel_delta{1};  // number of wheel steps
 };
 
 
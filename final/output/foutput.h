@@ -100,6 +100,7 @@ class FOutput : public std::enable_shared_from_this<FOutput>
     virtual auto isNewFont() const -> bool = 0;
     virtual auto isEncodable (const wchar_t&) const -> bool = 0;
     virtual auto isFlushTimeout() const -> bool = 0;
+    virtual auto hasPendingOutput() const -> bool;
     virtual auto hasTerminalResized() const -> bool = 0;
     virtual auto allowsTerminalSizeManipulation() const -> bool = 0;
     virtual auto canChangeColorPalette() const -> bool = 0;
@@ -140,6 +141,10 @@ class FOutput : public std::enable_shared_from_this<FOutput>
 inline auto FOutput::getClassName() const -> FString
 { return "FOutput"; }
 
+//----------------------------------------------------------------------
+inline auto FOutput::hasPendingOutput() const -> bool
+{ return false; }
+
 //----------------------------------------------------------------------
 inline auto FOutput::getFVTerm() const & -> const FVTerm&
 { return fvterm; }
@@ -0,0 +1,82 @@
+/***********************************************************************
+* fcharwidth.h - Unicode column width table                            *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2023 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Generated by scripts/unicode_width.py from the
+ *  Unicode 14.0.0 character database - do not edit!
+ *
+ *  Two-stage lookup table for the terminal column width
+ *  of Unicode characters:
+ *
+ *  stage1[code point / 256] → index of a 256 character block
+ *  stage2[block][offset / 4] → 4 × 2 bit column widths
+ */
+
+#ifndef FCHARWIDTH_H
+#define FCHARWIDTH_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <array>
+
+#include "final/ftypes.h"
+
+namespace finalcut
+{
+
+namespace internal
+{
+
+struct char_width_table
+{
+  // Using-declaration
+  using Stage1Type = std::array<uInt8, 4352>;
+  using Stage2Type = std::array<std::array<uInt8, 64>, 137>;
+
+  // Data members
+  static const Stage1Type stage1;
+  static const Stage2Type stage2;
+};
+
+}  // namespace internal
+
+//----------------------------------------------------------------------
+inline auto getUnicodeWidth (wchar_t wchar) noexcept -> uInt8
+{
+  // Returns the column width (0, 1 or 2) of a Unicode character
+  // without considering the terminal capabilities
+
+  using internal::char_width_table;
+  const auto ucs = uInt32(wchar);
+
+  if ( ucs > 0x10ffff )
+    return 0;
+
+  const auto block = char_width_table::stage1[ucs >> 8];
+  const auto bits = char_width_table::stage2[block][(ucs & 0xff) >> 2];
+  return uInt8((bits >> ((ucs & 0x03) << 1)) & 0x03);
+}
+
+}  // namespace finalcut
+
+#endif  // FCHARWIDTH_H
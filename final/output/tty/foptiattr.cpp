@@ -45,12 +45,14 @@ struct var
   static uInt8 b1_mask;
   static uInt8 b1_reset_mask;
   static uInt8 b2_reset_mask;
+  static uInt32 keep_mask;
 };
 
 uInt8 var::b0_reverse_mask{};
 uInt8 var::b1_mask{};
 uInt8 var::b1_reset_mask{};
 uInt8 var::b2_reset_mask{};
+uInt32 var::keep_mask{};
 
 }  // namespace internal
 
@@ -68,6 +70,9 @@ FOptiAttr::FOptiAttr()
   internal::var::b1_mask = getByte1Mask();
   internal::var::b1_reset_mask = getByte1ResetMask();
   internal::var::b2_reset_mask = getByte2ResetMask();
+  FAttribute keep{};
+  keep.byte[2] = internal::var::b2_reset_mask;
+  internal::var::keep_mask = keep.word;
 }
 
 
@@ -487,6 +492,7 @@ auto FOptiAttr::isNormal (const FChar& ch) -> bool
 //----------------------------------------------------------------------
 void FOptiAttr::initialize()
 {
+  clearTransitionCache();
   F_color.monochron = F_color.max_color < 8;
 
   if ( caused_reset_attributes(F_bold.off.cap) )
@@ -570,44 +576,39 @@ auto FOptiAttr::vga2ansi (FColor color) -> FColor
 }
 
 //----------------------------------------------------------------------
-auto FOptiAttr::changeAttribute (FChar& term, FChar& next) -> std::string
+auto FOptiAttr::changeAttribute (FChar& term, FChar& next) -> const std::string&
 {
-  const bool next_has_color = hasColor(next);
-  fake_reverse = false;
-  attr_buf.clear();
-  prevent_no_color_video_attributes (term, next_has_color);
-  prevent_no_color_video_attributes (next);
-  detectSwitchOn (term, next);
-  detectSwitchOff (term, next);
-
-  // Simulate invisible characters
-  if ( ! F_secure.on.cap && next.attr.bit.invisible )
-    next.encoded_char[0] = ' ';
+  // Returns the escape sequence for the transition from "term" to "next".
+  // Already computed transitions are taken from the transition cache.
+  // The returned reference is valid until the next call.
 
-  // Look for no changes
-  if ( ! (switchOn() || switchOff() || hasColorChanged(term, next)) )
-    return {};
+  static const auto& start_options = FStartOptions::getInstance();
 
-  if ( hasNoAttribute(next) )
-  {
-    deactivateAttributes (term, next);
-  }
-  else if ( F_attributes.on.cap
-         && (! term.attr.bit.pc_charset || alt_equal_pc_charset) )
+  if ( cache_sgr_optimizer != bool(start_options.sgr_optimizer) )
   {
-    changeAttributeSGR (term, next);
-  }
-  else
-  {
-    changeAttributeSeparately (term, next);
+    clearTransitionCache();
+    cache_sgr_optimizer = start_options.sgr_optimizer;
   }
 
-  static const auto& start_options = FStartOptions::getInstance();
+  const auto term_key = getTransitionKey(term);
+  const auto next_key = getTransitionKey(next);
+  auto& entry = getTransitionCacheEntry(term_key, next_key);
 
-  if ( start_options.sgr_optimizer )
-    sgr_optimizer.optimize();
+  if ( entry.used && entry.term_key == term_key && entry.next_key == next_key )
+  {
+    setTransitionResult (term, entry.term_result);
+    setTransitionResult (next, entry.next_result);
+    return entry.sequence;
+  }
 
-  return attr_buf;
+  createAttributeSequence (term, next);
+  entry.term_key = term_key;
+  entry.next_key = next_key;
+  entry.term_result = getTransitionKey(term);
+  entry.next_result = getTransitionKey(next);
+  entry.sequence = attr_buf;
+  entry.used = true;
+  return entry.sequence;
 }
 
 
@@ -1502,6 +1503,86 @@ inline auto FOptiAttr::switchOff() const -> bool
   return hasAttribute(changes.off);
 }
 
+//----------------------------------------------------------------------
+void FOptiAttr::createAttributeSequence (FChar& term, FChar& next)
+{
+  // Writes the escape sequence for the transition
+  // from "term" to "next" into attr_buf
+
+  const bool next_has_color = hasColor(next);
+  fake_reverse = false;
+  attr_buf.clear();
+  prevent_no_color_video_attributes (term, next_has_color);
+  prevent_no_color_video_attributes (next);
+  detectSwitchOn (term, next);
+  detectSwitchOff (term, next);
+
+  // Look for no changes
+  if ( ! (switchOn() || switchOff() || hasColorChanged(term, next)) )
+    return;
+
+  if ( hasNoAttribute(next) )
+  {
+    deactivateAttributes (term, next);
+  }
+  else if ( F_attributes.on.cap
+         && (! term.attr.bit.pc_charset || alt_equal_pc_charset) )
+  {
+    changeAttributeSGR (term, next);
+  }
+  else
+  {
+    changeAttributeSeparately (term, next);
+  }
+
+  if ( cache_sgr_optimizer )
+    sgr_optimizer.optimize();
+}
+
+//----------------------------------------------------------------------
+inline auto FOptiAttr::getTransitionKey (const FChar& fchar) -> uInt64
+{
+  // Packs colors and attributes into 64 bits. The bits "no_changes"
+  // and "printed" are not part of the key because they never
+  // influence and are never modified by an attribute change.
+
+  const auto attr = fchar.attr.word & ~internal::var::keep_mask;
+  return uInt64(fchar.fg_color)
+       | uInt64(fchar.bg_color) << 16
+       | uInt64(attr) << 32;
+}
+
+//----------------------------------------------------------------------
+inline void FOptiAttr::setTransitionResult (FChar& fchar, uInt64 result)
+{
+  fchar.fg_color = FColor(result & 0xffff);
+  fchar.bg_color = FColor((result >> 16) & 0xffff);
+  fchar.attr.word = (fchar.attr.word & internal::var::keep_mask)
+                  | uInt32(result >> 32);
+}
+
+//----------------------------------------------------------------------
+inline auto FOptiAttr::getTransitionCacheEntry ( uInt64 term_key
+                                               , uInt64 next_key )
+  -> transitionCacheEntry&
+{
+  // Direct-mapped cache: the key pair determines the only slot
+
+  if ( transition_cache.empty() )
+    transition_cache.resize(TRANSITION_CACHE_SIZE);
+
+  const uInt64 hash = term_key * 0x9e3779b97f4a7c15ULL
+                    ^ (next_key + 0x632be59bd9b4e019ULL) * 0xc2b2ae3d27d4eb4fULL;
+  return transition_cache[std::size_t(hash >> 32) & (TRANSITION_CACHE_SIZE - 1)];
+}
+
+//----------------------------------------------------------------------
+void FOptiAttr::clearTransitionCache() noexcept
+{
+  for (auto& entry : transition_cache)
+    entry.used = false;
+}
+
 //----------------------------------------------------------------------
 inline auto FOptiAttr::append_sequence (const std::string& seq) -> bool
 {
@@ -39,6 +39,7 @@
 #include <algorithm>  // need for std::swap
 #include <array>
 #include <string>
+#include <vector>
 
 #include "final/ftypes.h"
 #include "final/output/tty/sgr_optimizer.h"
@@ -144,11 +145,12 @@ class FOptiAttr final
 
     // Inquiry
     static auto isNormal (const FChar&) -> bool;
+    auto        isSimulatedInvisible (const FChar&) const noexcept -> bool;
 
     // Methods
     void        initialize();
     static auto vga2ansi (FColor) -> FColor;
-    auto        changeAttribute (FChar&, FChar&) -> std::string;
+    auto        changeAttribute (FChar&, FChar&) -> const std::string&;
 
   private:
     struct Capability
@@ -184,6 +186,16 @@ class FOptiAttr final
       FChar off{};
     };
 
+    struct transitionCacheEntry
+    {
+      uInt64      term_key{};
+      uInt64      next_key{};
+      uInt64      term_result{};
+      uInt64      next_result{};
+      std::string sequence{};
+      bool        used{false};
+    };
+
     // Using-declarations
     using SetFunctionCall = std::function<bool(FOptiAttr*, FChar&)>;
 
@@ -196,6 +208,10 @@ class FOptiAttr final
     using AttributeHandlers = std::array<AttributeHandlerEntry, 13>;
     using NoColorVideoHandler = std::function<void(FOptiAttr*, FChar&)>;
     using NoColorVideoHandlerTable = std::array<NoColorVideoHandler, 18>;
+    using TransitionCache = std::vector<transitionCacheEntry>;
+
+    // Constants
+    static constexpr std::size_t TRANSITION_CACHE_SIZE = 1024;  // 2^n
 
     // Enumerations
     enum init_reset_tests
@@ -279,6 +295,11 @@ class FOptiAttr final
     void        detectSwitchOff (const FChar&, const FChar&);
     auto        switchOn() const -> bool;
     auto        switchOff() const -> bool;
+    void        createAttributeSequence (FChar&, FChar&);
+    static auto getTransitionKey (const FChar&) -> uInt64;
+    static void setTransitionResult (FChar&, uInt64);
+    auto        getTransitionCacheEntry (uInt64, uInt64) -> transitionCacheEntry&;
+    void        clearTransitionCache() noexcept;
     template <typename CharT
             , enable_if_char_ptr_t<CharT> = nullptr>
     auto        append_sequence (CharT) -> bool;
@@ -307,8 +328,10 @@ class FOptiAttr final
     AttributeChanges changes{};
     std::string      attr_buf{};
     SGRoptimizer     sgr_optimizer{attr_buf};
+    TransitionCache  transition_cache{};
     bool             alt_equal_pc_charset{false};
     bool             fake_reverse{false};
+    bool             cache_sgr_optimizer{false};
 };
 
 
@@ -319,19 +342,35 @@ inline auto FOptiAttr::getClassName() const -> FString
 
 //----------------------------------------------------------------------
 inline void FOptiAttr::setMaxColor (const int& c) noexcept
-{ F_color.max_color = c; }
+{
+  F_color.max_color = c;
+  clearTransitionCache();
+}
 
 //----------------------------------------------------------------------
 inline void FOptiAttr::setNoColorVideo (int attr) noexcept
-{ F_color.attr_without_color = attr; }
+{
+  F_color.attr_without_color = attr;
+  clearTransitionCache();
+}
 
 //----------------------------------------------------------------------
 inline void FOptiAttr::setDefaultColorSupport() noexcept
-{ F_color.ansi_default_color = true; }
+{
+  F_color.ansi_default_color = true;
+  clearTransitionCache();
+}
 
 //----------------------------------------------------------------------
 inline void FOptiAttr::unsetDefaultColorSupport() noexcept
-{ F_color.ansi_default_color = false; }
+{
+  F_color.ansi_default_color = false;
+  clearTransitionCache();
+}
+
+//----------------------------------------------------------------------
+inline auto FOptiAttr::isSimulatedInvisible (const FChar& ch) const noexcept -> bool
+{ return ! F_secure.on.cap && ch.attr.bit.invisible; }
 
 //----------------------------------------------------------------------
 template <typename CharT
@@ -483,49 +483,49 @@ void FOptiMove::check_boundaries ( int& xold, int& yold
 }
 
 //----------------------------------------------------------------------
-auto FOptiMove::moveCursor (int xold, int yold, int xnew, int ynew) -> std::string
+auto FOptiMove::moveCursor (int xold, int yold, int xnew, int ynew) -> const std::string&
 {
-  int method{0};
+  // The methods are compared by their calculated duration.
+  // Only the escape sequence of the fastest method is generated.
+
   int move_time{LONG_DURATION};
 
   check_boundaries (xold, yold, xnew, ynew);
 
   // Method 0: direct cursor addressing
-  if ( isMethod0Faster(move_time, xnew, ynew)
+  if ( isMethod0Faster(move_time)
     && ( xold < 0
       || yold < 0
       || isWideMove (xold, yold, xnew, ynew) ) )
   {
-    return ( move_time < LONG_DURATION ) ? move_buf : std::string{};
-  }
-
-  // Method 1: local movement
-  if ( isMethod1Faster(move_time, xold, yold, xnew, ynew) )
-    method = 1;
-
-  // Method 2: carriage-return + local movement
-  if ( isMethod2Faster(move_time, yold, xnew, ynew) )
-    method = 2;
+    moveByMethod (0, xold, xnew, ynew);
 
-  // Method 3: home-cursor + local movement
-  if ( isMethod3Faster(move_time, xnew, ynew) )
-    method = 3;
+    if ( ! move_buf.empty() )
+      return move_buf;
 
-  // Method 4: home-down + local movement
-  if ( isMethod4Faster(move_time, xnew, ynew) )
-    method = 4;
+    move_time = LONG_DURATION;  // Not encodable, try the other methods
+  }
 
-  // Method 5: left margin for wrap to right-hand side
-  if ( isMethod5Faster(move_time, yold, xnew, ynew) )
-    method = 5;
+  // Methods 1 to 5: relative movements
+  auto method = getFastestRelativeMethod (move_time, xold, yold, xnew, ynew);
 
   // Copy the escape sequence for the chosen method in move_buf
-  moveByMethod (method, xold, yold, xnew, ynew);
-
   if ( move_time < LONG_DURATION )
-    return move_buf;
+    moveByMethod (method, xold, xnew, ynew);
+  else
+    move_buf.clear();
+
+  if ( method == 0 && move_time < LONG_DURATION && move_buf.empty() )
+  {
+    // The cursor address could not be encoded
+    move_time = LONG_DURATION;
+    method = getFastestRelativeMethod (move_time, xold, yold, xnew, ynew);
+
+    if ( move_time < LONG_DURATION )
+      moveByMethod (method, xold, xnew, ynew);
+  }
 
-  return {};
+  return move_buf;
 }
 
 
@@ -610,45 +610,34 @@ auto FOptiMove::capDurationToLength (int duration) const -> int
 }
 
 //----------------------------------------------------------------------
-auto FOptiMove::repeatedAppend ( std::string& dst
-                               , const Capability& o
-                               , int count ) const -> int
+auto FOptiMove::repeatedDuration ( std::size_t& length
+                                 , const Capability& o
+                                 , int count ) const -> int
 {
-  const auto& src_len = stringLength(o.cap);
-  const auto& dst_len = dst.length();
-  int total{0};
+  // Returns the duration of count times the capability o
+  // and adds its length to the sequence length
 
-  if ( (dst_len + uInt(count) * src_len) < BUF_SIZE - 1 )
-  {
-    total += count * o.duration;
-    int cnt = count;
+  const auto& cap_len = stringLength(o.cap);
 
-    while ( cnt > 0 )
-    {
-      cnt--;
-      dst.append(o.cap);
-    }
-  }
-  else
-    total = LONG_DURATION;
+  if ( length + uInt(count) * cap_len >= BUF_SIZE - 1 )
+    return LONG_DURATION;
 
-  return total;
+  length += uInt(count) * cap_len;
+  return count * o.duration;
 }
 
 //----------------------------------------------------------------------
-auto FOptiMove::relativeMove ( std::string& move
+auto FOptiMove::relativeMove ( RelativeMotion& motion
                              , int from_x, int from_y
                              , int to_x, int to_y ) const -> int
 {
   int vtime{0};
   int htime{0};
-
-  if ( ! move.empty() )
-    move.clear();
+  motion = {};
 
   if ( to_y != from_y )  // vertical move
   {
-    vtime = verticalMove (move, from_y, to_y);
+    vtime = verticalMove (motion.vertical, from_y, to_y);
 
     if ( vtime >= LONG_DURATION )
       return LONG_DURATION;
@@ -656,30 +645,24 @@ auto FOptiMove::relativeMove ( std::string& move
 
   if ( to_x != from_x )  // horizontal move
   {
-    std::string hmove{};
-    htime = horizontalMove (hmove, from_x, to_x);
+    htime = horizontalMove (motion.horizontal, from_x, to_x);
 
     if ( htime >= LONG_DURATION )
       return LONG_DURATION;
-
-    if ( ! move.empty() )
-      move.append(hmove);
-    else
-      move = hmove;
   }
 
   return vtime + htime;
 }
 
 //----------------------------------------------------------------------
-inline auto FOptiMove::verticalMove (std::string& move, int from_y, int to_y) const -> int
+inline auto FOptiMove::verticalMove (Motion& move, int from_y, int to_y) const -> int
 {
   int vtime{LONG_DURATION};
 
   if ( parm_cursor.row_address.cap )
   {
     // Move to fixed row position
-    move = FTermcap::encodeParameter(parm_cursor.row_address.cap, to_y);
+    move = {parm_cursor.row_address.cap, to_y, nullptr, 0, nullptr, 0};
     vtime = parm_cursor.row_address.duration;
   }
 
@@ -692,56 +675,54 @@ inline auto FOptiMove::verticalMove (std::string& move, int from_y, int to_y) co
 }
 
 //----------------------------------------------------------------------
-inline void FOptiMove::downMove ( std::string& move, int& vtime
+inline void FOptiMove::downMove ( Motion& move, int& vtime
                                 , int from_y, int to_y ) const
 {
   const int num = to_y - from_y;
 
   if ( parm_cursor.down.cap && parm_cursor.down.duration < vtime )
   {
-    move = FTermcap::encodeParameter(parm_cursor.down.cap, num);
+    move = {parm_cursor.down.cap, num, nullptr, 0, nullptr, 0};
     vtime = parm_cursor.down.duration;
   }
 
   if ( cursor.down.cap && (num * cursor.down.duration < vtime) )
   {
-    if ( ! move.empty() )
-      move.clear();
-
-    vtime = repeatedAppend (move, cursor.down, num);
+    std::size_t length{0};
+    move = {nullptr, 0, nullptr, 0, cursor.down.cap, num};
+    vtime = repeatedDuration (length, cursor.down, num);
   }
 }
 
 //----------------------------------------------------------------------
-inline void FOptiMove::upMove ( std::string& move, int& vtime
+inline void FOptiMove::upMove ( Motion& move, int& vtime
                               , int from_y, int to_y ) const
 {
   const int num = from_y - to_y;
 
   if ( parm_cursor.up.cap && parm_cursor.up.duration < vtime )
   {
-    move = FTermcap::encodeParameter(parm_cursor.up.cap, num);
+    move = {parm_cursor.up.cap, num, nullptr, 0, nullptr, 0};
     vtime = parm_cursor.up.duration;
   }
 
   if ( cursor.up.cap && (num * cursor.up.duration < vtime) )
   {
-    if ( ! move.empty() )
-      move.clear();
-
-    vtime = repeatedAppend (move, cursor.up, num);
+    std::size_t length{0};
+    move = {nullptr, 0, nullptr, 0, cursor.up.cap, num};
+    vtime = repeatedDuration (length, cursor.up, num);
   }
 }
 
 //----------------------------------------------------------------------
-inline auto FOptiMove::horizontalMove (std::string& hmove, int from_x, int to_x) const -> int
+inline auto FOptiMove::horizontalMove (Motion& hmove, int from_x, int to_x) const -> int
 {
   int htime{LONG_DURATION};
 
   if ( parm_cursor.column_address.cap )
   {
     // Move to fixed column position
-    hmove = FTermcap::encodeParameter(parm_cursor.column_address.cap, to_x);
+    hmove = {parm_cursor.column_address.cap, to_x, nullptr, 0, nullptr, 0};
     htime = parm_cursor.column_address.duration;
   }
 
@@ -754,19 +735,20 @@ inline auto FOptiMove::horizontalMove (std::string& hmove, int from_x, int to_x)
 }
 
 //----------------------------------------------------------------------
-inline void FOptiMove::moveWithParmRightCursor ( std::string& hmove
+inline void FOptiMove::moveWithParmRightCursor ( Motion& hmove
                                                , int& htime, int num ) const
 {
   // Use parameterized cursor right capability
-  hmove = FTermcap::encodeParameter(parm_cursor.right.cap, num);
+  hmove = {parm_cursor.right.cap, num, nullptr, 0, nullptr, 0};
   htime = parm_cursor.right.duration;
 }
 
 //----------------------------------------------------------------------
-inline void FOptiMove::moveWithRightCursor ( std::string& hmove, int& htime
+inline void FOptiMove::moveWithRightCursor ( Motion& hmove, int& htime
                                            , int num, int from_x, int to_x ) const
 {
-  std::string str{};
+  std::size_t length{0};
+  int tab_count{0};
   int htime_r{0};
 
   // try to use tab
@@ -778,11 +760,13 @@ inline void FOptiMove::moveWithRightCursor ( std::string& hmove, int& htime
         ; tab_pos <= to_x
         ; tab_pos += tabstop )
     {
-      htime_r += repeatedAppend (str, cursor.tab, 1);
+      const int tab_time = repeatedDuration (length, cursor.tab, 1);
 
-      if ( htime_r >= LONG_DURATION )
-        break;
+      if ( tab_time >= LONG_DURATION )
+        return;
 
+      htime_r += tab_time;
+      tab_count++;
       pos = tab_pos;
     }
 
@@ -790,17 +774,22 @@ inline void FOptiMove::moveWithRightCursor ( std::string& hmove, int& htime
   }
 
   // Use the cursor right capability
-  htime_r += repeatedAppend (str, cursor.right, num);
+  const int right_time = repeatedDuration (length, cursor.right, num);
+
+  if ( right_time >= LONG_DURATION )
+    return;
+
+  htime_r += right_time;
 
   if ( htime_r < htime )
   {
-    hmove = str;
+    hmove = {nullptr, 0, cursor.tab.cap, tab_count, cursor.right.cap, num};
     htime = htime_r;
   }
 }
 
 //----------------------------------------------------------------------
-inline void FOptiMove::rightMove ( std::string& hmove, int& htime
+inline void FOptiMove::rightMove ( Motion& hmove, int& htime
                                  , int from_x, int to_x ) const
 {
   int num = to_x - from_x;
@@ -816,19 +805,20 @@ inline void FOptiMove::rightMove ( std::string& hmove, int& htime
 }
 
 //----------------------------------------------------------------------
-inline void FOptiMove::moveWithParmLeftCursor ( std::string& hmove
+inline void FOptiMove::moveWithParmLeftCursor ( Motion& hmove
                                               , int& htime, int num ) const
 {
   // Use parameterized cursor right capability
-  hmove = FTermcap::encodeParameter(parm_cursor.left.cap, num);
+  hmove = {parm_cursor.left.cap, num, nullptr, 0, nullptr, 0};
   htime = parm_cursor.left.duration;
 }
 
 //----------------------------------------------------------------------
-inline void FOptiMove::moveWithLeftCursor ( std::string& hmove, int& htime
+inline void FOptiMove::moveWithLeftCursor ( Motion& hmove, int& htime
                                           , int num, int from_x, int to_x ) const
 {
-  std::string str{};
+  std::size_t length{0};
+  int tab_count{0};
   int htime_l{0};
 
   // try to use backward tab
@@ -840,11 +830,13 @@ inline void FOptiMove::moveWithLeftCursor ( std::string& hmove, int& htime
         ; tab_pos >= to_x
         ; tab_pos = ( pos > 0 ) ? ((pos - 1) / tabstop) * tabstop : -1)
     {
-      htime_l += repeatedAppend (str, cursor.back_tab, 1);
+      const int tab_time = repeatedDuration (length, cursor.back_tab, 1);
 
-      if ( htime_l >= LONG_DURATION )
-        break;
+      if ( tab_time >= LONG_DURATION )
+        return;
 
+      htime_l += tab_time;
+      tab_count++;
       pos = tab_pos;
     }
 
@@ -852,17 +844,22 @@ inline void FOptiMove::moveWithLeftCursor ( std::string& hmove, int& htime
   }
 
   // Use the cursor left capability
-  htime_l += repeatedAppend (str, cursor.left, num);
+  const int left_time = repeatedDuration (length, cursor.left, num);
+
+  if ( left_time >= LONG_DURATION )
+    return;
+
+  htime_l += left_time;
 
   if ( htime_l < htime )
   {
-    hmove = str;
+    hmove = {nullptr, 0, cursor.back_tab.cap, tab_count, cursor.left.cap, num};
     htime = htime_l;
   }
 }
 
 //----------------------------------------------------------------------
-inline void FOptiMove::leftMove ( std::string& hmove, int& htime
+inline void FOptiMove::leftMove ( Motion& hmove, int& htime
                                 , int from_x, int to_x ) const
 {
   int num = from_x - to_x;
@@ -877,6 +874,29 @@ inline void FOptiMove::leftMove ( std::string& hmove, int& htime
     moveWithLeftCursor (hmove, htime, num, from_x, to_x);
 }
 
+//----------------------------------------------------------------------
+void FOptiMove::appendMotion (std::string& dst, const Motion& move) const
+{
+  // Generates the escape sequence of a calculated motion
+
+  if ( move.parm_cap )
+    dst.append(FTermcap::encodeParameter(move.parm_cap, move.parm));
+
+  for (int n{0}; n < move.tab_count; n++)
+    dst.append(move.tab_cap);
+
+  for (int n{0}; n < move.step_count; n++)
+    dst.append(move.step_cap);
+}
+
+//----------------------------------------------------------------------
+inline void FOptiMove::appendRelativeMove ( std::string& dst
+                                          , const RelativeMotion& motion ) const
+{
+  appendMotion (dst, motion.vertical);
+  appendMotion (dst, motion.horizontal);
+}
+
 //----------------------------------------------------------------------
 inline auto FOptiMove::isWideMove ( int xold, int yold
                                   , int xnew, int ynew ) const -> bool
@@ -887,25 +907,15 @@ inline auto FOptiMove::isWideMove ( int xold, int yold
 }
 
 //----------------------------------------------------------------------
-inline auto FOptiMove::isMethod0Faster ( int& move_time
-                                       , int xnew, int ynew ) -> bool
+inline auto FOptiMove::isMethod0Faster (int& move_time) const -> bool
 {
   // Test method 0: direct cursor addressing
 
   if ( ! parm_cursor.address.cap )
     return false;
 
-  const auto move_xy = \
-    FTermcap::encodeMotionParameter(parm_cursor.address.cap, xnew, ynew);
-
-  if ( ! move_xy.empty() )
-  {
-    move_buf = move_xy;
-    move_time = parm_cursor.address.duration;
-    return true;
-  }
-
-  return false;
+  move_time = parm_cursor.address.duration;
+  return true;
 }
 
 //----------------------------------------------------------------------
@@ -917,11 +927,13 @@ inline auto FOptiMove::isMethod1Faster ( int& move_time
 
   if ( xold >= 0 && yold >= 0 )
   {
-    const int new_time = relativeMove (temp_result, xold, yold, xnew, ynew);
+    RelativeMotion motion{};
+    const int new_time = relativeMove (motion, xold, yold, xnew, ynew);
 
     if ( new_time < LONG_DURATION && new_time < move_time )
     {
       move_time = new_time;
+      relative_motion = motion;
       return true;
     }
   }
@@ -938,12 +950,14 @@ inline auto FOptiMove::isMethod2Faster ( int& move_time
 
   if ( yold >= 0 && cursor.carriage_return.cap )
   {
-    const int new_time = relativeMove (temp_result, 0, yold, xnew, ynew);
+    RelativeMotion motion{};
+    const int new_time = relativeMove (motion, 0, yold, xnew, ynew);
 
     if ( new_time < LONG_DURATION
       && cursor.carriage_return.duration + new_time < move_time )
     {
       move_time = cursor.carriage_return.duration + new_time;
+      relative_motion = motion;
       return true;
     }
   }
@@ -959,12 +973,14 @@ inline auto FOptiMove::isMethod3Faster ( int& move_time
 
   if ( cursor.home.cap )
   {
-    const int new_time = relativeMove (temp_result, 0, 0, xnew, ynew);
+    RelativeMotion motion{};
+    const int new_time = relativeMove (motion, 0, 0, xnew, ynew);
 
     if ( new_time < LONG_DURATION
       && cursor.home.duration + new_time < move_time )
     {
       move_time = cursor.home.duration + new_time;
+      relative_motion = motion;
       return true;
     }
   }
@@ -979,13 +995,15 @@ inline auto FOptiMove::isMethod4Faster ( int& move_time
   // Test method 4: home-down + local movement
   if ( cursor.to_ll.cap )
   {
+    RelativeMotion motion{};
     int down = int(screen.height) - 1;
-    const int new_time = relativeMove (temp_result, 0, down, xnew, ynew);
+    const int new_time = relativeMove (motion, 0, down, xnew, ynew);
 
     if ( new_time < LONG_DURATION
       && cursor.to_ll.duration + new_time < move_time )
     {
       move_time = cursor.to_ll.duration + new_time;
+      relative_motion = motion;
       return true;
     }
   }
@@ -1004,9 +1022,10 @@ inline auto FOptiMove::isMethod5Faster ( int& move_time
     && yold > 0
     && cursor.left.cap )
   {
+    RelativeMotion motion{};
     int x = int(screen.width) - 1;
     int y = yold - 1;
-    const int new_time = relativeMove (temp_result, x, y, xnew, ynew);
+    const int new_time = relativeMove (motion, x, y, xnew, ynew);
 
     if ( new_time < LONG_DURATION
       && cursor.carriage_return.cap
@@ -1015,6 +1034,7 @@ inline auto FOptiMove::isMethod5Faster ( int& move_time
     {
       move_time = cursor.carriage_return.duration
                 + cursor.left.duration + new_time;
+      relative_motion = motion;
       return true;
     }
   }
@@ -1023,58 +1043,79 @@ inline auto FOptiMove::isMethod5Faster ( int& move_time
 }
 
 //----------------------------------------------------------------------
-void FOptiMove::moveByMethod ( int method
-                             , int xold, int yold
+auto FOptiMove::getFastestRelativeMethod ( int& move_time
+                                         , int xold, int yold
+                                         , int xnew, int ynew ) -> int
+{
+  // Returns the fastest of the methods 1 to 5 or 0 if
+  // none of them is faster than move_time
+
+  int method{0};
+
+  // Method 1: local movement
+  if ( isMethod1Faster(move_time, xold, yold, xnew, ynew) )
+    method = 1;
+
+  // Method 2: carriage-return + local movement
+  if ( isMethod2Faster(move_time, yold, xnew, ynew) )
+    method = 2;
+
+  // Method 3: home-cursor + local movement
+  if ( isMethod3Faster(move_time, xnew, ynew) )
+    method = 3;
+
+  // Method 4: home-down + local movement
+  if ( isMethod4Faster(move_time, xnew, ynew) )
+    method = 4;
+
+  // Method 5: left margin for wrap to right-hand side
+  if ( isMethod5Faster(move_time, yold, xnew, ynew) )
+    method = 5;
+
+  return method;
+}
+
+//----------------------------------------------------------------------
+void FOptiMove::moveByMethod ( int method, int xold
                              , int xnew, int ynew )
 {
+  move_buf.clear();
+
   switch ( method )
   {
     case 0:  // direct cursor addressing
-      return;
+      move_buf.append ( FTermcap::encodeMotionParameter
+                            (parm_cursor.address.cap, xnew, ynew) );
+      break;
 
     case 1:
-      relativeMove (move_buf, xold, yold, xnew, ynew);
+      appendRelativeMove (move_buf, relative_motion);
       break;
 
     case 2:
       if ( cursor.carriage_return.cap )
       {
-        move_buf = cursor.carriage_return.cap;
-        relativeMove (temp_result, 0, yold, xnew, ynew);
-        move_buf.append(temp_result);
+        move_buf.append(cursor.carriage_return.cap);
+        appendRelativeMove (move_buf, relative_motion);
       }
       break;
 
     case 3:
-      move_buf = cursor.home.cap;
-      {
-        relativeMove (temp_result, 0, 0, xnew, ynew);
-        move_buf.append(temp_result);
-      }
+      move_buf.append(cursor.home.cap);
+      appendRelativeMove (move_buf, relative_motion);
       break;
 
     case 4:
-      move_buf = cursor.to_ll.cap;
-      {
-        int down = int(screen.height) - 1;
-        relativeMove (temp_result, 0, down, xnew, ynew);
-        move_buf.append(temp_result);
-      }
+      move_buf.append(cursor.to_ll.cap);
+      appendRelativeMove (move_buf, relative_motion);
       break;
 
     case 5:
       if ( xold >= 0 )
-        move_buf = cursor.carriage_return.cap;
-      else
-        move_buf.clear();
+        move_buf.append(cursor.carriage_return.cap);
 
       move_buf.append(cursor.left.cap);
-      {
-        int x = int(screen.width) - 1;
-        int y = yold - 1;
-        relativeMove (temp_result, x, y, xnew, ynew);
-        move_buf.append(temp_result);
-      }
+      appendRelativeMove (move_buf, relative_motion);
       break;
 
     default:
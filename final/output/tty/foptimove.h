@@ -157,7 +157,7 @@ class FOptiMove final
 
     // Methods
     void  check_boundaries (int&, int&, int&, int&) const;
-    auto  moveCursor (int, int, int, int) -> std::string;
+    auto  moveCursor (int, int, int, int) -> const std::string&;
 
   private:
     struct Capability
@@ -205,6 +205,22 @@ class FOptiMove final
       std::size_t height{};
     };
 
+    struct Motion
+    {
+      const char* parm_cap{nullptr};  // Parameterized capability
+      int         parm{0};
+      const char* tab_cap{nullptr};   // Tab or back tab
+      int         tab_count{0};
+      const char* step_cap{nullptr};  // Single step capability
+      int         step_count{0};
+    };
+
+    struct RelativeMotion
+    {
+      Motion vertical{};
+      Motion horizontal{};
+    };
+
     // Constant
     static constexpr std::string::size_type BUF_SIZE{512u};
 
@@ -218,40 +234,44 @@ class FOptiMove final
     void  calculateCharDuration();
     auto  capDuration (const char[], int) const -> int;
     auto  capDurationToLength (int) const -> int;
-    auto  repeatedAppend (std::string&, const Capability&, int) const -> int;
-    auto  relativeMove (std::string&, int, int, int, int) const -> int;
-    auto  verticalMove (std::string&, int, int) const -> int;
-    void  downMove (std::string&, int&, int, int) const;
-    void  upMove (std::string&, int&, int, int) const;
-    auto  horizontalMove (std::string&, int, int) const -> int;
-    void  moveWithParmRightCursor (std::string&, int&, int) const;
-    void  moveWithRightCursor (std::string&, int&, int, int, int) const;
-    void  rightMove (std::string&, int&, int, int) const;
-    void  moveWithParmLeftCursor (std::string&, int&, int) const;
-    void  moveWithLeftCursor (std::string&, int&, int, int, int) const;
-    void  leftMove (std::string&, int&, int, int) const;
+    auto  repeatedDuration ( std::size_t&, const Capability&
+                           , int ) const -> int;
+    auto  relativeMove (RelativeMotion&, int, int, int, int) const -> int;
+    auto  verticalMove (Motion&, int, int) const -> int;
+    void  downMove (Motion&, int&, int, int) const;
+    void  upMove (Motion&, int&, int, int) const;
+    auto  horizontalMove (Motion&, int, int) const -> int;
+    void  moveWithParmRightCursor (Motion&, int&, int) const;
+    void  moveWithRightCursor (Motion&, int&, int, int, int) const;
+    void  rightMove (Motion&, int&, int, int) const;
+    void  moveWithParmLeftCursor (Motion&, int&, int) const;
+    void  moveWithLeftCursor (Motion&, int&, int, int, int) const;
+    void  leftMove (Motion&, int&, int, int) const;
+    void  appendMotion (std::string&, const Motion&) const;
+    void  appendRelativeMove (std::string&, const RelativeMotion&) const;
 
     auto  isWideMove (int, int, int, int) const -> bool;
-    auto  isMethod0Faster (int&, int, int) -> bool;
+    auto  isMethod0Faster (int&) const -> bool;
     auto  isMethod1Faster (int&, int, int, int, int) -> bool;
     auto  isMethod2Faster (int&, int, int, int) -> bool;
     auto  isMethod3Faster (int&, int, int) -> bool;
     auto  isMethod4Faster (int&, int, int) -> bool;
     auto  isMethod5Faster (int&, int, int, int) -> bool;
-    void  moveByMethod (int, int, int, int, int);
+    auto  getFastestRelativeMethod (int&, int, int, int, int) -> int;
+    void  moveByMethod (int, int, int, int);
 
     // Data members
-    Cursor      cursor;
-    ParamCursor parm_cursor;
-    Edit        edit;
-    Dimension   screen{80, 24};
-    int         char_duration{1};
-    int         baudrate{9600};
-    int         tabstop{0};
-    std::string move_buf{};
-    std::string temp_result{};
-    bool        automatic_left_margin{false};
-    bool        eat_nl_glitch{false};
+    Cursor         cursor;
+    ParamCursor    parm_cursor;
+    Edit           edit;
+    Dimension      screen{80, 24};
+    int            char_duration{1};
+    int            baudrate{9600};
+    int            tabstop{0};
+    std::string    move_buf{};
+    RelativeMotion relative_motion{};
+    bool           automatic_left_margin{false};
+    bool           eat_nl_glitch{false};
 
     // Friend function
     friend void printDurations (const FOptiMove&);
@@ -507,9 +507,10 @@ auto FTerm::closeConsole() -> int
 }
 
 //----------------------------------------------------------------------
-auto FTerm::moveCursorString (int xold, int yold, int xnew, int ynew) -> std::string
+auto FTerm::moveCursorString (int xold, int yold, int xnew, int ynew) -> const std::string&
 {
   // Returns the cursor move string
+  // (valid until the next call)
 
   static const auto& data = FTermData::getInstance();
 
@@ -519,7 +520,8 @@ auto FTerm::moveCursorString (int xold, int yold, int xnew, int ynew) -> std::st
     return opti_move.moveCursor (xold, yold, xnew, ynew);
   }
 
-  const auto& cursor_addr = FTermcap::encodeMotionParameter(TCAP(t_cursor_address), xnew, ynew);
+  static std::string cursor_addr{};
+  cursor_addr = FTermcap::encodeMotionParameter(TCAP(t_cursor_address), xnew, ynew);
   return cursor_addr;
 }
 
@@ -924,11 +926,14 @@ void FTerm::init_global_values()
   // Initialize global values
 
   FTermData::getInstance().setNewFont(false);  // Preset to false
+  auto& term_detection = FTermDetection::getInstance();
 
   if ( ! getStartOptions().terminal_detection )
   {
-    FTermDetection::getInstance().setTerminalDetection (false);
+    term_detection.setTerminalDetection (false);
   }
+
+  term_detection.setDetectionCache (getStartOptions().terminal_detection_cache);
 }
 
 //----------------------------------------------------------------------
@@ -1759,12 +1764,16 @@ void FTerm::init()
   enableMouse();
 
   // Activate meta key sends escape + terminal focus event
+  // + bracketed paste
   if ( FTermData::getInstance().isTermType(FTermType::xterm) )
   {
     FTermXTerminal::getInstance().metaSendsESC(true);
 
     if ( getStartOptions().terminal_focus_events )
       FTermXTerminal::getInstance().setFocusSupport(true);
+
+    if ( getStartOptions().bracketed_paste )
+      FTermXTerminal::getInstance().setBracketedPaste(true);
   }
 
   // switch to application escape key mode
@@ -1968,9 +1977,13 @@ void FTerm::finish() const
   if ( getStartOptions().mouse_support )
     disableMouse();
 
-  // Deactivate terminal focus event + meta key sends escape
+  // Deactivate bracketed paste + terminal focus event
+  // + meta key sends escape
   if ( data.isTermType(FTermType::xterm) )
   {
+    if ( getStartOptions().bracketed_paste )
+      xterm.setBracketedPaste(false);
+
     if ( getStartOptions().terminal_focus_events )
       xterm.setFocusSupport(false);
 
@@ -207,7 +207,7 @@ class FTerm final
     static auto resetFont() -> bool;
     static auto openConsole() -> int;
     static auto closeConsole() -> int;
-    static auto moveCursorString (int, int, int, int) -> std::string;
+    static auto moveCursorString (int, int, int, int) -> const std::string&;
     static auto cursorsVisibilityString (bool = true) -> std::string;
     static void detectTermSize();
     static void setTermSize (const FSize&);
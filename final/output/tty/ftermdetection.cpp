@@ -24,11 +24,19 @@
   #include "final/fconfig.h"  // includes _GNU_SOURCE
 #endif
 
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
 #include <array>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
 #include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "final/fapplication.h"
 #include "final/fc.h"
@@ -55,6 +63,84 @@
 namespace finalcut
 {
 
+namespace internal
+{
+
+constexpr char detection_cache_header[] = "# FINAL CUT terminal detection cache v1";
+constexpr std::size_t max_detection_cache_entries{16};
+
+//----------------------------------------------------------------------
+auto escapeCacheField (const std::string& str) -> std::string
+{
+  // Control characters, tabs and backslashes are written as \xHH
+
+  std::string escaped{};
+
+  for (const auto& ch : str)
+  {
+    const auto c = uChar(ch);
+
+    if ( c < 0x20 || c == 0x7f || c == '\\' )
+    {
+      std::array<char, 5> hex{};
+      std::snprintf (hex.data(), hex.size(), "\\x%02x", c);
+      escaped += hex.data();
+    }
+    else
+      escaped += ch;
+  }
+
+  return escaped;
+}
+
+//----------------------------------------------------------------------
+auto unescapeCacheField (const std::string& str) -> std::string
+{
+  std::string unescaped{};
+  std::size_t i{0};
+
+  while ( i < str.length() )
+  {
+    if ( str[i] == '\\' && i + 3 < str.length() && str[i + 1] == 'x' )
+    {
+      unescaped += char(std::strtoul(str.substr(i + 2, 2).c_str(), nullptr, 16));
+      i += 4;
+    }
+    else
+    {
+      unescaped += str[i];
+      i++;
+    }
+  }
+
+  return unescaped;
+}
+
+//----------------------------------------------------------------------
+auto makeDirectory (const std::string& path) -> bool
+{
+  // Creates the directory and its missing parent directories
+
+  if ( path.empty() )
+    return false;
+
+  std::size_t pos{0};
+
+  do
+  {
+    pos = path.find('/', pos + 1);
+    const auto& dir = path.substr(0, pos);
+
+    if ( ::mkdir(dir.c_str(), 0700) == -1 && errno != EEXIST )
+      return false;
+  }
+  while ( pos != std::string::npos );
+
+  return true;
+}
+
+}  // namespace internal
+
 //----------------------------------------------------------------------
 // class FTermDetection
 //----------------------------------------------------------------------
@@ -316,6 +402,9 @@ void FTermDetection::detectTerminal()
     // Initialize 256 colors terminals
     new_termtype = init_256colorTerminal();
 
+    // Look up the replies of an earlier start
+    initDetectionCache();
+
     // Identify the terminal via the answerback-message
     new_termtype = parseAnswerbackMsg (new_termtype);
 
@@ -325,6 +414,9 @@ void FTermDetection::detectTerminal()
     // Determines the maximum number of colors
     new_termtype = determineMaxColor(new_termtype);
 
+    if ( detection_cache.active && ! detection_cache.hit )
+      writeDetectionCache();
+
     keyboard.unsetNonBlockingInput();
     FTermios::unsetCaptureSendCharacters();
   }
@@ -472,9 +564,9 @@ auto FTermDetection::determineMaxColor (const FString& current_termtype) -> FStr
                                | FTermType::tera_term
                                | FTermType::linux_con
                                | FTermType::netbsd_con )
-    && ! getXTermColorName(FColor(0)).isEmpty() )
+    && hasXTermColor(FColor(0)) )
   {
-    if ( ! getXTermColorName(FColor(255)).isEmpty() )
+    if ( hasXTermColor(FColor(255)) )
     {
       color256 = true;
 
@@ -483,11 +575,11 @@ auto FTermDetection::determineMaxColor (const FString& current_termtype) -> FStr
       else
         new_termtype = "xterm-256color";
     }
-    else if ( ! getXTermColorName(FColor(87)).isEmpty() )
+    else if ( hasXTermColor(FColor(87)) )
     {
       new_termtype = "xterm-88color";
     }
-    else if ( ! getXTermColorName(FColor(15)).isEmpty() )
+    else if ( hasXTermColor(FColor(15)) )
     {
       new_termtype = "xterm-16color";
     }
@@ -527,15 +619,39 @@ auto FTermDetection::getXTermColorName (FColor color) const -> FString
   return {};
 }
 
+//----------------------------------------------------------------------
+auto FTermDetection::hasXTermColor (FColor color) -> bool
+{
+  const auto index = uInt16(color);
+  auto& colors = detection_cache.xterm_colors;
+
+  if ( detection_cache.hit )
+    return std::find(colors.cbegin(), colors.cend(), index) != colors.cend();
+
+  const bool answered = ! getXTermColorName(color).isEmpty();
+
+  if ( answered && detection_cache.active )
+    colors.push_back(index);
+
+  return answered;
+}
+
 //----------------------------------------------------------------------
 auto FTermDetection::parseAnswerbackMsg (const FString& current_termtype) -> FString
 {
   FString new_termtype{current_termtype};
-  static auto& keyboard = FKeyboard::getInstance();
-  keyboard.setNonBlockingInput();
-  // send ENQ and read the answerback message
-  answer_back = getAnswerbackMsg();
-  keyboard.unsetNonBlockingInput();
+
+  if ( detection_cache.hit )
+    answer_back = detection_cache.answer_back;
+  else
+  {
+    static auto& keyboard = FKeyboard::getInstance();
+    keyboard.setNonBlockingInput();
+    // send ENQ and read the answerback message
+    answer_back = getAnswerbackMsg();
+    keyboard.unsetNonBlockingInput();
+    detection_cache.answer_back = answer_back;
+  }
 
   if ( answer_back == "PuTTY" )
   {
@@ -551,8 +667,11 @@ auto FTermDetection::parseAnswerbackMsg (const FString& current_termtype) -> FSt
 #if !defined(UNIT_TEST)
   // Some terminals like cygwin or the Windows terminal
   // have to delete the printed character '♣'
-  std::fprintf (stdout, "\r " BS);
-  std::fflush (stdout);
+  if ( ! detection_cache.hit )
+  {
+    std::fprintf (stdout, "\r " BS);
+    std::fflush (stdout);
+  }
 #endif  // !defined(UNIT_TEST)
 
 #if DEBUG
@@ -589,7 +708,11 @@ auto FTermDetection::parseSecDA (const FString& current_termtype) -> FString
     return current_termtype;
 
   // Secondary device attributes (SEC_DA) <- decTerminalID string
-  sec_da = getSecDA();
+  if ( ! sec_da_requested )  // Also an empty reply is not requested twice
+  {
+    sec_da = getSecDA();
+    sec_da_requested = true;
+  }
 
   if ( sec_da.getLength() < 6 )
     return current_termtype;
@@ -972,4 +1095,169 @@ inline void FTermDetection::correctFalseAssumptions (int terminal_id_type) const
     fterm_data.unsetTermType (FTermType::kde_konsole);
 }
 
+//----------------------------------------------------------------------
+void FTermDetection::initDetectionCache()
+{
+  // The SEC_DA reply serves as the fingerprint of the terminal.
+  // If the cache knows it, this single round trip replaces the
+  // answerback and the xterm color queries with their timeouts.
+
+  sec_da_requested = false;
+  detection_cache.active = false;
+  detection_cache.hit = false;
+  detection_cache.answer_back.clear();
+  detection_cache.xterm_colors.clear();
+  const auto& fterm_data = FTermData::getInstance();
+
+  // No SEC_DA request on the Linux console and older cygwin terminals
+  if ( ! detection_cache.enabled
+    || fterm_data.isTermType(FTermType::linux_con | FTermType::cygwin) )
+    return;
+
+  sec_da = getSecDA();
+  sec_da_requested = true;
+
+  if ( sec_da.isEmpty() )
+    return;
+
+  detection_cache.active = true;
+  detection_cache.key = getDetectionCacheKey();
+  readDetectionCache();
+}
+
+//----------------------------------------------------------------------
+auto FTermDetection::getDetectionCacheKey() const -> FString
+{
+  auto env = [] (const char* name)
+  {
+    const auto& value = std::getenv(name);
+    return FString{value ? value : ""};
+  };
+
+  // The tty type is the device name without its number
+  std::string tty_type{FTermData::getInstance().getTermFileName()};
+
+  while ( ! tty_type.empty() && std::isdigit(uChar(tty_type.back())) )
+    tty_type.pop_back();
+
+  return termtype + '|' + env("TERM_PROGRAM")
+                  + '|' + env("TERM_PROGRAM_VERSION")
+                  + '|' + FString{tty_type} + '|' + sec_da;
+}
+
+//----------------------------------------------------------------------
+auto FTermDetection::getDetectionCacheFileName() const -> std::string
+{
+  // $XDG_CACHE_HOME/finalcut/terminal-detection
+
+  const auto& xdg_cache_home = std::getenv("XDG_CACHE_HOME");
+  const auto& home = std::getenv("HOME");
+
+  if ( xdg_cache_home && xdg_cache_home[0] == '/' )
+    return std::string(xdg_cache_home) + "/finalcut/terminal-detection";
+
+  if ( home && home[0] == '/' )
+    return std::string(home) + "/.cache/finalcut/terminal-detection";
+
+  return {};
+}
+
+//----------------------------------------------------------------------
+void FTermDetection::readDetectionCache()
+{
+  // File format: one line per terminal with tab-separated fields
+  // <key> <answerback> <comma-separated answered xterm colors>
+
+  std::ifstream file{getDetectionCacheFileName()};
+  std::string line{};
+
+  if ( ! std::getline(file, line) || line != internal::detection_cache_header )
+    return;
+
+  const auto& key = internal::escapeCacheField(detection_cache.key.toString());
+
+  while ( std::getline(file, line) )
+  {
+    const auto& fields = FString{line}.split('\t');
+
+    if ( fields.size() != 3 || fields[0].toString() != key )
+      continue;
+
+    const auto& answer_back = fields[1].toString();
+    detection_cache.answer_back = internal::unescapeCacheField(answer_back);
+
+    for (const auto& index : fields[2].split(','))
+    {
+      if ( ! index.isEmpty() )
+        detection_cache.xterm_colors.push_back(uInt16(index.toUInt()));
+    }
+
+    detection_cache.hit = true;
+    return;
+  }
+}
+
+//----------------------------------------------------------------------
+void FTermDetection::writeDetectionCache() const
+{
+  // Puts the current terminal at the front and keeps
+  // the most recently seen terminals
+
+  const auto& filename = getDetectionCacheFileName();
+  const auto slash = filename.rfind('/');
+
+  if ( filename.empty() || ! internal::makeDirectory(filename.substr(0, slash)) )
+    return;
+
+  const auto& key = internal::escapeCacheField(detection_cache.key.toString());
+  std::string colors{};
+
+  for (const auto& index : detection_cache.xterm_colors)
+  {
+    if ( ! colors.empty() )
+      colors += ',';
+
+    colors += std::to_string(index);
+  }
+
+  std::vector<std::string> lines
+  {
+    key + '\t'
+        + internal::escapeCacheField(detection_cache.answer_back.toString())
+        + '\t' + colors
+  };
+  std::ifstream old_file{filename};
+  std::string line{};
+
+  if ( std::getline(old_file, line) && line == internal::detection_cache_header )
+  {
+    while ( std::getline(old_file, line)
+         && lines.size() < internal::max_detection_cache_entries )
+    {
+      if ( line.compare(0, key.length() + 1, key + '\t') != 0 )
+        lines.push_back(line);
+    }
+  }
+
+  old_file.close();
+
+  // Replace the file atomically so that concurrent starts
+  // never read a partially written cache
+  const auto& tmp_filename = filename + "." + std::to_string(getpid());
+  std::ofstream file{tmp_filename, std::ofstream::out | std::ofstream::trunc};
+
+  if ( ! file )
+    return;
+
+  file << internal::detection_cache_header << '\n';
+
+  for (const auto& entry : lines)
+    file << entry << '\n';
+
+  file.close();
+
+  if ( ! file || std::rename(tmp_filename.c_str(), filename.c_str()) == -1 )
+    std::remove(tmp_filename.c_str());
+}
+
 }  // namespace finalcut
@@ -39,6 +39,8 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <string>
+#include <vector>
 
 #include "final/fconfig.h"  // Supplies F_HAVE_GETTTYNAM if available
 #include "final/util/fstring.h"
@@ -72,10 +74,12 @@ class FTermDetection final
     // Inquiries
     auto  canDisplay256Colors() const noexcept -> bool;
     auto  hasTerminalDetection() const noexcept -> bool;
+    auto  hasDetectionCache() const noexcept -> bool;
     auto  hasSetCursorStyleSupport() const noexcept -> bool;
 
     // Mutators
     void  setTerminalDetection (bool = true) noexcept;
+    void  setDetectionCache (bool = true) noexcept;
     void  setTtyTypeFileName (const FString&);
 
     // Methods
@@ -101,6 +105,16 @@ class FTermDetection final
       int terminal_id_hardware{-1};
     };
 
+    struct detectionCache
+    {
+      FString             key{};           // Environment and SEC_DA
+      FString             answer_back{};
+      std::vector<uInt16> xterm_colors{};  // Answered OSC 4 queries
+      bool                enabled{false};
+      bool                active{false};
+      bool                hit{false};
+    };
+
     // Methods
     void  getSystemTermType();
     auto  getTTYtype() -> bool;
@@ -117,6 +131,7 @@ class FTermDetection final
     auto  termtype_256color_quirks() -> FString;
     auto  determineMaxColor (const FString&) -> FString;
     auto  getXTermColorName (FColor) const -> FString;
+    auto  hasXTermColor (FColor) -> bool;
     auto  parseAnswerbackMsg (const FString&) -> FString;
     auto  getAnswerbackMsg() const -> FString;
     auto  parseSecDA (const FString&) -> FString;
@@ -137,22 +152,29 @@ class FTermDetection final
     auto  secDA_Analysis_vte (const FString&) -> FString;
     auto  secDA_Analysis_kitty (const FString&) -> FString;
     void  correctFalseAssumptions (int) const;
+    void  initDetectionCache();
+    auto  getDetectionCacheKey() const -> FString;
+    auto  getDetectionCacheFileName() const -> std::string;
+    void  readDetectionCache();
+    void  writeDetectionCache() const;
 
     // Data members
 #if DEBUG
-    FString      termtype_256color{};
-    FString      termtype_Answerback{};
-    FString      termtype_SecDA{};
+    FString        termtype_256color{};
+    FString        termtype_Answerback{};
+    FString        termtype_SecDA{};
 #endif
-    FString      termtype{};
-    FString      ttytypename{"/etc/ttytype"};  // Default ttytype file
-    bool         decscusr_support{false};      // Preset to false
-    bool         terminal_detection{true};     // Preset to true
-    bool         color256{};
-    FString      answer_back{};
-    FString      sec_da{};
-    colorEnv     color_env{};
-    secondaryDA  secondary_da{};
+    FString        termtype{};
+    FString        ttytypename{"/etc/ttytype"};  // Default ttytype file
+    bool           decscusr_support{false};      // Preset to false
+    bool           terminal_detection{true};     // Preset to true
+    bool           color256{};
+    FString        answer_back{};
+    FString        sec_da{};
+    bool           sec_da_requested{false};      // SEC_DA already queried
+    colorEnv       color_env{};
+    secondaryDA    secondary_da{};
+    detectionCache detection_cache{};
 };
 
 
@@ -191,10 +213,18 @@ inline auto FTermDetection::hasSetCursorStyleSupport() const noexcept -> bool
 inline auto FTermDetection::hasTerminalDetection() const noexcept -> bool
 { return terminal_detection; }
 
+//----------------------------------------------------------------------
+inline auto FTermDetection::hasDetectionCache() const noexcept -> bool
+{ return detection_cache.enabled; }
+
 //----------------------------------------------------------------------
 inline void FTermDetection::setTerminalDetection (bool enable) noexcept
 { terminal_detection = enable; }
 
+//----------------------------------------------------------------------
+inline void FTermDetection::setDetectionCache (bool enable) noexcept
+{ detection_cache.enabled = enable; }
+
 //----------------------------------------------------------------------
 template<typename StringT>
 inline bool FTermDetection::startsWithTermType (StringT&& prefix) const
@@ -21,6 +21,7 @@
 ***********************************************************************/
 
 #include <algorithm>
+#include <cstdlib>
 #include <unistd.h>
 #include <unordered_map>
 
@@ -36,9 +37,9 @@
 #include "final/output/tty/ftermios.h"
 #include "final/output/tty/ftermoutput.h"
 #include "final/output/tty/ftermxterminal.h"
-#include "final/util/char_ringbuffer.h"
 #include "final/util/fpoint.h"
 #include "final/util/fsize.h"
+#include "final/vterm/fchar_functions.h"
 
 namespace finalcut
 {
@@ -140,6 +141,12 @@ auto FTermOutput::isFlushTimeout() const -> bool
   return FObjectTimer::isTimeout (time_last_flush, flush_wait);
 }
 
+//----------------------------------------------------------------------
+auto FTermOutput::hasPendingOutput() const -> bool
+{
+  return output_buffer && ! output_buffer->data.empty();
+}
+
 //----------------------------------------------------------------------
 auto FTermOutput::hasTerminalResized() const -> bool
 {
@@ -277,6 +284,7 @@ void FTermOutput::initTerminal (FVTerm::FTermArea* virtual_terminal)
 
   vterm         = virtual_terminal;
   output_buffer = std::make_shared<OutputBuffer>();
+  output_buffer->data.reserve(BUFFER_SIZE);
   term_pos      = std::make_shared<FPoint>(-1, -1);
 
   // Hide the input cursor
@@ -317,14 +325,23 @@ auto FTermOutput::updateTerminal() -> bool
 
   std::size_t changedlines = 0;
 
-  for (uInt y{0}; y < uInt(vterm->size.height); y++)
+  if ( vterm->hasChangedLines() )
   {
-    FVTerm::reduceTerminalLineUpdates(y);
+    // Only the damaged lines of the virtual terminal are visited
+    const auto y_min = vterm->changed_lines.ymin;
+    const auto y_max = std::min(vterm->changed_lines.ymax, uInt(vterm->size.height - 1));
+    scrollTerminalLines (y_min, y_max);
 
-    if ( updateTerminalLine(y) )
-      changedlines++;
+    for (auto y{y_min}; y <= y_max; y++)
+    {
+      FVTerm::reduceTerminalLineUpdates(y);
+
+      if ( updateTerminalLine(y) )
+        changedlines++;
+    }
   }
 
+  vterm->resetChangedLines();
   vterm->has_changes = false;
 
   // sets the new input cursor position
@@ -444,24 +461,13 @@ void FTermOutput::flush()
 
   flushTimeAdjustment();
 
-  if ( ! output_buffer || output_buffer->isEmpty()
+  if ( ! output_buffer || output_buffer->data.empty()
     || ! (isFlushTimeout() || getFVTerm().isTerminalUpdateForced()) )
     return;
 
-  while ( ! output_buffer->isEmpty() )
-  {
-    const auto& first = output_buffer->front();
-    const auto& type = first.type;
-    const auto& data = first.data;
-
-    if ( type == OutputType::String )
-      FTerm::stringPrint (data);
-    else if ( type == OutputType::Control )
-      FTerm::paddingPrint (data);
-
-    output_buffer->pop();
-  }
-
+  printOutputBuffer();
+  output_buffer->data.clear();
+  output_buffer->padding.clear();
   std::fflush(stdout);
   static auto& mouse = FMouseControl::getInstance();
   mouse.drawPointer();
@@ -474,6 +480,57 @@ void FTermOutput::beep() const
   return FTerm::beep();
 }
 
+//----------------------------------------------------------------------
+auto FTermOutput::getLineShiftSequences ( const FVTerm::FLineShift& shift
+                                        , int last_line ) -> std::vector<std::string>
+{
+  // Returns the control sequences that scroll the lines
+  // from shift.top to shift.bottom by shift.count lines
+  // on a terminal with the last line last_line
+
+  const auto top = int(shift.top);
+  const auto bottom = int(shift.bottom);
+  const auto count = std::abs(shift.count);
+  const bool scroll_up = shift.count > 0;
+  const auto& csr = TCAP(t_change_scroll_region);
+  std::vector<std::string> sequences{};
+
+  if ( csr && TCAP(t_scroll_forward) && TCAP(t_scroll_reverse) )
+  {
+    // Scrolling inside a scroll region
+    const auto& scroll = scroll_up ? TCAP(t_scroll_forward)
+                                   : TCAP(t_scroll_reverse);
+    sequences.emplace_back(FTermcap::encodeParameter(csr, top, bottom));
+    sequences.emplace_back(FTerm::moveCursorString(-1, -1, 0, scroll_up ? bottom : top));
+    sequences.emplace_back(getRepeatedSequence(scroll, nullptr, count));
+    sequences.emplace_back(FTermcap::encodeParameter(csr, 0, last_line));
+    return sequences;
+  }
+
+  // Delete lines on one side of the band and insert them on the other.
+  // Lines that leave the screen at the bottom need not be deleted.
+  const auto& delete_line = TCAP(t_delete_line);
+  const auto& parm_delete_line = TCAP(t_parm_delete_line);
+  const auto& insert_line = TCAP(t_insert_line);
+  const auto& parm_insert_line = TCAP(t_parm_insert_line);
+
+  if ( scroll_up || bottom < last_line )
+  {
+    const auto y = scroll_up ? top : bottom - count + 1;
+    sequences.emplace_back(FTerm::moveCursorString(-1, -1, 0, y));
+    sequences.emplace_back(getRepeatedSequence(delete_line, parm_delete_line, count));
+  }
+
+  if ( ! scroll_up || bottom < last_line )
+  {
+    const auto y = scroll_up ? bottom - count + 1 : top;
+    sequences.emplace_back(FTerm::moveCursorString(-1, -1, 0, y));
+    sequences.emplace_back(getRepeatedSequence(insert_line, parm_insert_line, count));
+  }
+
+  return sequences;
+}
+
 
 // private methods of FTermOutput
 //----------------------------------------------------------------------
@@ -613,20 +670,10 @@ auto FTermOutput::canClearToEOL (uInt xmin, uInt y) const -> bool
   if ( ! ce || min_char->ch[0] != L' ' )
     return false;
 
-  uInt beginning_whitespace = 1;
+  const auto beginning_whitespace = \
+      uInt(getRepetitionLength(min_char, uInt(vterm->size.width) - xmin));
   const auto& normal = FOptiAttr::isNormal(*min_char);
   const auto& ut = FTermcap::background_color_erase;
-  const auto* ch = min_char + 1;
-
-  for (int x{int(xmin) + 1}; x < vterm->size.width; x++)
-  {
-    if ( *min_char == *ch )
-      beginning_whitespace++;
-    else
-      break;
-
-    ++ch;
-  }
 
   return ( beginning_whitespace == uInt(vterm->size.width) - xmin
         && (ut || normal)
@@ -645,20 +692,10 @@ auto FTermOutput::canClearLeadingWS (uInt& xmin, uInt y) const -> bool
   if ( ! cb || first_char->ch[0] != L' ' )
     return false;
 
-  uInt leading_whitespace = 1;
+  const auto leading_whitespace = \
+      uInt(getRepetitionLength(first_char, std::size_t(vterm->size.width)));
   const auto& normal = FOptiAttr::isNormal(*first_char);
   const auto& ut = FTermcap::background_color_erase;
-  const auto* ch = first_char + 1;
-
-  for (int x{1}; x < vterm->size.width; x++)
-  {
-    if ( *first_char == *ch )
-      leading_whitespace++;
-    else
-      break;
-
-    ++ch;
-  }
 
   if ( leading_whitespace > xmin && (ut || normal)
     && clr_bol_length < leading_whitespace )
@@ -689,7 +726,7 @@ auto FTermOutput::canClearTrailingWS (uInt& xmax, uInt y) const -> bool
 
   for (int x{vterm->size.width - 1}; x > 0 ; x--)
   {
-    if ( *last_char == *ch )
+    if ( isSameFChar(*last_char, *ch) )
       trailing_whitespace++;
     else
       break;
@@ -1030,20 +1067,7 @@ auto FTermOutput::repeatCharacter (uInt& x, uInt xmax, uInt y) -> PrintState
 inline auto FTermOutput::countRepetitions ( const FChar* print_char
                                           , uInt from, uInt to ) const -> uInt
 {
-  uInt repetitions{1};
-  const auto* ch = print_char + 1;
-
-  for (uInt i{from + 1}; i <= to; i++)
-  {
-    if ( *print_char == *ch )
-      repetitions++;
-    else
-      break;
-
-    ++ch;
-  }
-
-  return repetitions;
+  return uInt(getRepetitionLength(print_char, std::size_t(to - from + 1)));
 }
 
 //----------------------------------------------------------------------
@@ -1124,6 +1148,69 @@ inline void FTermOutput::adjustCursorPosition (FPoint& p) const
     y = term_height - 1;
 }
 
+//----------------------------------------------------------------------
+inline auto FTermOutput::canScrollLines() const -> bool
+{
+  // Checks whether the terminal can move a band of lines
+
+  const bool has_scroll_region = TCAP(t_change_scroll_region)
+                              && TCAP(t_scroll_forward)
+                              && TCAP(t_scroll_reverse);
+  const bool has_insert_delete = ( TCAP(t_insert_line) || TCAP(t_parm_insert_line) )
+                              && ( TCAP(t_delete_line) || TCAP(t_parm_delete_line) );
+  return TCAP(t_cursor_address) && ( has_scroll_region || has_insert_delete );
+}
+
+//----------------------------------------------------------------------
+void FTermOutput::scrollTerminalLines (uInt ymin, uInt ymax)
+{
+  // Lets the terminal scroll lines that have moved vertically
+  // instead of printing them again
+
+  if ( ! canScrollLines() )
+    return;
+
+  const auto shift = FVTerm::findTerminalLineShift(ymin, ymax);
+
+  if ( shift.count == 0 )
+    return;
+
+  const auto last_line = int(getLineNumber()) - 1;
+  const auto sequences = getLineShiftSequences(shift, last_line);
+  std::size_t length{0};
+
+  for (const auto& sequence : sequences)
+    length += sequence.length();
+
+  if ( length >= shift.saved_output )  // Printing the lines is cheaper
+    return;
+
+  for (const auto& sequence : sequences)
+    appendOutputBuffer (FTermControl{sequence});
+
+  term_pos->setPoint(-1, -1);  // Unknown cursor position
+  FVTerm::shiftTerminalLines(shift);
+}
+
+//----------------------------------------------------------------------
+auto FTermOutput::getRepeatedSequence ( const char* single
+                                      , const char* parm
+                                      , int count ) -> std::string
+{
+  // Returns the sequence for count repetitions, preferably with
+  // the parameterized capability
+
+  if ( parm && ( count > 1 || ! single ) )
+    return FTermcap::encodeParameter(parm, count);
+
+  std::string sequence{};
+
+  for (auto i{0}; i < count; i++)
+    sequence += single;
+
+  return sequence;
+}
+
 //----------------------------------------------------------------------
 inline auto FTermOutput::updateTerminalLine (uInt y) -> bool
 {
@@ -1277,40 +1364,28 @@ inline void FTermOutput::newFontChanges (FChar& next_char) const
 }
 
 //----------------------------------------------------------------------
-inline void FTermOutput::charsetChanges (FChar& next_char) const
+inline auto FTermOutput::charsetChanges (FChar& next_char) const -> FUnicode
 {
-  auto iter_enc_ch = next_char.encoded_char.begin();
-  auto iter_ch = next_char.ch.cbegin();
-  auto end_ch = next_char.ch.cend();
-
-  while ( iter_ch < end_ch )
-  {
-    *iter_enc_ch = *iter_ch;
-
-    if ( *iter_ch == L'\0' )
-      break;
-
-    ++iter_ch;
-    ++iter_enc_ch;
-  }
+  // Returns the output character in the terminal encoding
 
+  FUnicode encoded_char{next_char.ch};
   const auto terminal_encoding = internal::var::terminal_encoding;
 
   if ( terminal_encoding == Encoding::UTF8 )
-    return;
+    return encoded_char;
 
   const auto& ch = next_char.ch[0];
   const auto& ch_enc = FTerm::charEncode(ch);
 
   if ( ch_enc == ch )
-    return;
+    return encoded_char;
 
-  auto& first_enc_char = next_char.encoded_char[0];
+  auto& first_enc_char = encoded_char[0];
 
   if ( ch_enc == 0 )
   {
     first_enc_char = wchar_t(FTerm::charEncode(ch, Encoding::ASCII));
-    return;
+    return encoded_char;
   }
 
   first_enc_char = ch_enc;
@@ -1334,6 +1409,8 @@ inline void FTermOutput::charsetChanges (FChar& next_char) const
       }
     }
   }
+
+  return encoded_char;
 }
 
 //----------------------------------------------------------------------
@@ -1361,19 +1438,24 @@ inline void FTermOutput::appendCharacter_n (FChar& next_char, uInt number)
 //----------------------------------------------------------------------
 inline void FTermOutput::appendChar (FChar& next_char)
 {
+  static const auto& opti_attr = FOptiAttr::getInstance();
   newFontChanges (next_char);
-  charsetChanges (next_char);
+  auto encoded_char = charsetChanges (next_char);
   appendAttributes (next_char);
-  characterFilter (next_char);
 
-  for (const auto& ch : next_char.encoded_char)
+  if ( opti_attr.isSimulatedInvisible(next_char) )
+    encoded_char[0] = L' ';  // Simulate invisible characters
+
+  characterFilter (encoded_char);
+
+  for (const auto& ch : encoded_char)
   {
     if ( ch != L'\0')
     {
       if ( internal::var::terminal_encoding == Encoding::UTF8 )
         appendOutputBuffer (unicode_to_utf8(ch));
       else
-        appendOutputBuffer (std::string(1, char(uChar(ch))));
+        appendOutputBuffer (char(uChar(ch)));
     }
 
     if ( ! combined_char_support )
@@ -1452,14 +1534,14 @@ void FTermOutput::appendLowerRight (FChar& last_char)
 }
 
 //----------------------------------------------------------------------
-inline void FTermOutput::characterFilter (FChar& next_char)
+inline void FTermOutput::characterFilter (FUnicode& encoded_char)
 {
   static const auto& sub_map = getFTerm().getCharSubstitutionMap();
 
   if ( sub_map.isEmpty() )
     return;
 
-  auto& first_enc_char = next_char.encoded_char[0];
+  auto& first_enc_char = encoded_char[0];
   const auto& entry = sub_map.getMappedChar(first_enc_char);
 
   if ( entry )
@@ -1486,39 +1568,73 @@ inline auto FTermOutput::moveCursorLeft() -> CursorMoved
 //----------------------------------------------------------------------
 inline void FTermOutput::checkFreeBufferSize()
 {
-  if ( output_buffer->isFull() )
+  if ( output_buffer->data.length() >= BUFFER_SIZE )
     flush();
 }
 
 //----------------------------------------------------------------------
 inline void FTermOutput::appendOutputBuffer (const FTermControl& ctrl)
 {
-  output_buffer->emplace(OutputType::Control, ctrl.string);
+  if ( ctrl.length == 0 )
+    return;
+
+  auto& buffer = output_buffer->data;
+
+  // Only control sequences with $<..> delays need the padding output
+  if ( std::strstr(ctrl.string, "$<") )
+    output_buffer->padding.emplace_back(buffer.length(), ctrl.length);
+
+  buffer.append(ctrl.string, ctrl.length);
   checkFreeBufferSize();
 }
 
 //----------------------------------------------------------------------
 inline void FTermOutput::appendOutputBuffer (const UniChar& ch)
 {
-  appendOutputBuffer(unicode_to_utf8(wchar_t(ch)));
+  appendOutputBuffer (unicode_to_utf8(wchar_t(ch)));
+}
+
+//----------------------------------------------------------------------
+inline void FTermOutput::appendOutputBuffer (const std::string& string)
+{
+  output_buffer->data.append(string);
+  checkFreeBufferSize();
+}
+
+//----------------------------------------------------------------------
+inline void FTermOutput::appendOutputBuffer (char ch)
+{
+  output_buffer->data.push_back(ch);
+  checkFreeBufferSize();
 }
 
 //----------------------------------------------------------------------
-void FTermOutput::appendOutputBuffer (std::string&& string)
+void FTermOutput::printOutputBuffer() const
 {
-  auto& last = output_buffer->back();
+  // Writes the entire buffer with a single string output. Only
+  // the control sequences with delays are sent via padding output.
 
-  if ( ! output_buffer->isEmpty() && last.type == OutputType::String )
+  const auto& buffer = output_buffer->data;
+
+  if ( output_buffer->padding.empty() )
   {
-    // Append string data to the back element
-    auto& string_buf = last.data;
-    string_buf.append(string);
+    FTerm::stringPrint (buffer);
+    return;
   }
-  else
+
+  std::size_t pos{0};
+
+  for (const auto& range : output_buffer->padding)
   {
-    output_buffer->emplace(OutputType::String, std::move(string));
-    checkFreeBufferSize();
+    if ( range.offset > pos )
+      FTerm::stringPrint (buffer.substr(pos, range.offset - pos));
+
+    FTerm::paddingPrint (buffer.substr(range.offset, range.length));
+    pos = range.offset + range.length;
   }
+
+  if ( pos < buffer.length() )
+    FTerm::stringPrint (buffer.substr(pos));
 }
 
 }  // namespace finalcut
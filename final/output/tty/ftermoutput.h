@@ -40,10 +40,12 @@
   #error "Only <final/final.h> can be included directly."
 #endif
 
+#include <cstring>
 #include <memory>
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "final/output/foutput.h"
 #include "final/output/tty/fterm.h"
@@ -54,8 +56,6 @@ namespace finalcut
 // class forward declaration
 class FStartOptions;
 class FTermData;
-template <typename T, std::size_t Capacity>
-class FRingBuffer;
 
 //----------------------------------------------------------------------
 // class FTermOutput
@@ -98,6 +98,7 @@ class FTermOutput final : public FOutput
     auto isNewFont() const -> bool override;
     auto isEncodable (const wchar_t&) const -> bool override;
     auto isFlushTimeout() const -> bool override;
+    auto hasPendingOutput() const -> bool override;
     auto hasTerminalResized() const -> bool override;
     auto allowsTerminalSizeManipulation() const -> bool override;
     auto canChangeColorPalette() const -> bool override;
@@ -119,12 +120,25 @@ class FTermOutput final : public FOutput
     auto clearTerminal (wchar_t = L' ') -> bool override;
     void flush() override;
     void beep() const override;
+    static auto getLineShiftSequences ( const FVTerm::FLineShift&
+                                      , int ) -> std::vector<std::string>;
 
   private:
     // Constants
     struct FTermControl
     {
-      std::string string;
+      explicit FTermControl (const char* s)
+        : string{s}
+        , length{s ? std::strlen(s) : 0}
+      { }
+
+      explicit FTermControl (const std::string& s)
+        : string{s.data()}
+        , length{s.length()}
+      { }
+
+      const char* string;
+      std::size_t length;
     };
 
     // Enumerations
@@ -136,25 +150,23 @@ class FTermOutput final : public FOutput
       LineCompletelyPrinted
     };
 
-    enum class OutputType : uInt8  // Output data type of the terminal
-    {
-      String,
-      Control
-    };
-
     enum class CursorMoved { No, Yes };
 
-    struct OutputData
+    struct PaddingRange  // Control sequence with $<..> delay
     {
-      OutputData() = default;
-
-      OutputData (OutputType t, std::string s)
-        : type{t}
-        , data{std::move(s)}
+      PaddingRange (std::size_t o, std::size_t n)
+        : offset{o}
+        , length{n}
       { }
 
-      OutputType  type{OutputType::String};
-      std::string data{};
+      std::size_t offset{};
+      std::size_t length{};
+    };
+
+    struct OutputBuffer
+    {
+      std::string               data{};     // Contiguous output bytes
+      std::vector<PaddingRange> padding{};  // Sections with delays
     };
 
     // Constants
@@ -164,9 +176,6 @@ class FTermOutput final : public FOutput
     //   Output buffer size
     static constexpr std::size_t BUFFER_SIZE = 32'768;  // 32 KB
 
-    // Using-declaration
-    using OutputBuffer = FRingBuffer<OutputData, BUFFER_SIZE>;
-
     // Accessors
     auto getFSetPaletteRef() const & -> const FSetPalette& override;
 
@@ -199,24 +208,29 @@ class FTermOutput final : public FOutput
     auto isFullWidthPaddingChar (const FChar&) const -> bool;
     void cursorWrap() const;
     void adjustCursorPosition (FPoint&) const;
+    auto canScrollLines() const -> bool;
+    void scrollTerminalLines (uInt, uInt);
+    static auto getRepeatedSequence (const char*, const char*, int) -> std::string;
     auto updateTerminalLine (uInt) -> bool;
     auto updateTerminalCursor() -> bool;
     void flushTimeAdjustment();
     void markAsPrinted (uInt, uInt) const;
     void markAsPrinted (uInt, uInt, uInt) const;
     void newFontChanges (FChar&) const;
-    void charsetChanges (FChar&) const;
+    auto charsetChanges (FChar&) const -> FUnicode;
     void appendCharacter (FChar&);
     void appendCharacter_n (FChar&, uInt);
     void appendChar (FChar&);
     void appendAttributes (FChar&);
     void appendLowerRight (FChar&);
-    void characterFilter (FChar&);
+    void characterFilter (FUnicode&);
     auto moveCursorLeft() -> CursorMoved;
     void checkFreeBufferSize();
     void appendOutputBuffer (const FTermControl&);
     void appendOutputBuffer (const UniChar&);
-    void appendOutputBuffer (std::string&&);
+    void appendOutputBuffer (const std::string&);
+    void appendOutputBuffer (char);
+    void printOutputBuffer() const;
 
     // Data members
     FTerm                         fterm{};
@@ -69,6 +69,8 @@ class FTermXTerminal final
     static void  unsetMouseSupport();
     void  setFocusSupport (bool enable = true);
     void  unsetFocusSupport();
+    void  setBracketedPaste (bool enable = true);
+    void  unsetBracketedPaste();
     void  metaSendsESC (bool = true);
 
     // Accessors
@@ -134,12 +136,15 @@ class FTermXTerminal final
     static void disableXTermMouse();
     void  enableXTermFocus();
     void  disableXTermFocus();
+    void  enableXTermBracketedPaste();
+    void  disableXTermBracketedPaste();
     void  enableXTermMetaSendsESC();
     void  disableXTermMetaSendsESC();
 
     // Data members
     static bool       mouse_support;
     bool              focus_support{false};
+    bool              bracketed_paste{false};
     bool              meta_sends_esc{false};
     bool              xterm_default_colors{false};
     bool              title_was_changed{false};
@@ -218,6 +223,10 @@ inline void FTermXTerminal::unsetMouseSupport()
 inline void FTermXTerminal::unsetFocusSupport()
 { setFocusSupport (false); }
 
+//----------------------------------------------------------------------
+inline void FTermXTerminal::unsetBracketedPaste()
+{ setBracketedPaste (false); }
+
 }  // namespace finalcut
 
 #endif  // FTERMXTERMINAL_H
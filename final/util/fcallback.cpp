@@ -20,33 +20,71 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <unordered_map>
+
 #include "final/util/fcallback.h"
 
 namespace finalcut
 {
 
+namespace internal
+{
+
+struct SignalRegistry
+{
+  std::unordered_map<FString, FSignalId>  ids{};
+  std::mutex                              mutex{};
+};
+
+//----------------------------------------------------------------------
+auto getSignalRegistry() -> SignalRegistry&
+{
+  static SignalRegistry registry{};
+  return registry;
+}
+
+}  // namespace internal
+
 //----------------------------------------------------------------------
 // class FCallback
 //----------------------------------------------------------------------
 
 // public methods of FCallback
+//----------------------------------------------------------------------
+auto FCallback::getSignalId (const FString& cb_signal) -> FSignalId
+{
+  // Returns the interned id of a signal name.
+  // Unknown names get the next free id.
+
+  auto& registry = internal::getSignalRegistry();
+  std::lock_guard<std::mutex> lock_guard(registry.mutex);
+  const auto iter = registry.ids.find(cb_signal);
+
+  if ( iter != registry.ids.end() )
+    return iter->second;
+
+  const auto signal_id = FSignalId(registry.ids.size());
+  registry.ids.emplace (cb_signal, signal_id);
+  return signal_id;
+}
+
 //----------------------------------------------------------------------
 void FCallback::delCallback (const FString& cb_signal)
 {
   // Deletes entries with the given signal from the callback list
 
-  if ( callback_objects.empty() )
-    return;
+  FSignalId signal_id{};
 
-  auto iter = callback_objects.cbegin();
+  if ( ! findSignalId(cb_signal, signal_id) )
+    return;
 
-  while ( iter != callback_objects.cend() )
-  {
-    if ( iter->cb_signal == cb_signal )
-      iter = callback_objects.erase(iter);
-    else
-      ++iter;
-  }
+  eraseCallbacks ( [signal_id] (const FCallbackData& cback)
+                   {
+                     return cback.cb_signal == signal_id;
+                   } );
 }
 
 //----------------------------------------------------------------------
@@ -62,18 +100,59 @@ void FCallback::emitCallback (const FString& emit_signal) const
 {
   // Initiate callback for the given signal
 
+  FSignalId signal_id{};
+
+  if ( callback_objects.empty() || ! findSignalId(emit_signal, signal_id) )
+    return;
+
+  emitCallback (signal_id);
+}
+
+//----------------------------------------------------------------------
+void FCallback::emitCallback (FSignalId emit_signal) const
+{
+  // Initiate callback for the given signal id
+
   if ( callback_objects.empty() )
     return;
 
-  for (auto&& cback : callback_objects)
+  const auto first = std::lower_bound ( callback_objects.cbegin()
+                                      , callback_objects.cend()
+                                      , emit_signal
+                                      , [] (const FCallbackData& cback, FSignalId id)
+                                        {
+                                          return cback.cb_signal < id;
+                                        } );
+  auto index = std::size_t(std::distance(callback_objects.cbegin(), first));
+
+  // Indexed access, because a callback can add further callbacks
+  while ( index < callback_objects.size()
+       && callback_objects[index].cb_signal == emit_signal )
   {
-    if ( cback.cb_signal == emit_signal )
-    {
-      // Calling the stored function pointer
-      cback.cb_function();
-    }
+    // Calling the stored function
+    callback_objects[index].cb_function();
+    index++;
   }
 }
 
+
+// private methods of FCallback
+//----------------------------------------------------------------------
+auto FCallback::findSignalId (const FString& cb_signal, FSignalId& signal_id) -> bool
+{
+  // Looks up the id of a signal name without interning it.
+  // A name that was never interned has no callbacks.
+
+  auto& registry = internal::getSignalRegistry();
+  std::lock_guard<std::mutex> lock_guard(registry.mutex);
+  const auto iter = registry.ids.find(cb_signal);
+
+  if ( iter == registry.ids.end() )
+    return false;
+
+  signal_id = iter->second;
+  return true;
+}
+
 }  // namespace finalcut
 
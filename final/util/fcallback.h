@@ -23,9 +23,9 @@
 /*  Standalone class
  *  ════════════════
  *
- * ▕▔▔▔▔▔▔▔▔▔▔▔▏1     *▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
- * ▕ FCallback ▏- - - -▕ FCallbackData ▏
- * ▕▁▁▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▏1     *▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏1     1▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FCallback ▏- - - -▕ FCallbackData ▏- - - -▕ FCallbackFunction ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏       ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
  */
 
 #ifndef FCALLBACK_H
@@ -35,6 +35,12 @@
   #error "Only <final/final.h> can be included directly."
 #endif
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -47,6 +53,240 @@ namespace finalcut
 // class forward declaration
 class FWidget;
 
+// Interned signal name
+using FSignalId = uInt32;
+
+//----------------------------------------------------------------------
+// class FCallbackFunction
+//----------------------------------------------------------------------
+
+class FCallbackFunction
+{
+  public:
+    // Using-declaration
+    template <typename T>
+    using enable_if_not_FCallbackFunction_t =
+        std::enable_if_t< ! std::is_same< std::decay_t<T>
+                                        , FCallbackFunction >::value
+                        , std::nullptr_t >;
+
+    // Constructors
+    FCallbackFunction() = default;
+
+    template <typename Function
+            , enable_if_not_FCallbackFunction_t<Function> = nullptr>
+    FCallbackFunction (Function&&);
+
+    // Copy constructor
+    FCallbackFunction (const FCallbackFunction&);
+
+    // Move constructor
+    FCallbackFunction (FCallbackFunction&&) noexcept;
+
+    // Destructor
+    ~FCallbackFunction();
+
+    // Copy assignment operator (=)
+    auto operator = (const FCallbackFunction&) -> FCallbackFunction&;
+
+    // Move assignment operator (=)
+    auto operator = (FCallbackFunction&&) noexcept -> FCallbackFunction&;
+
+    // Inquiry
+    explicit operator bool () const noexcept;
+
+    // Method
+    void operator () () const;
+
+  private:
+    struct Operations
+    {
+      void (*invoke) (void*);
+      void (*copy) (const void*, void*);
+      void (*move) (void*, void*);
+      void (*destroy) (void*);
+    };
+
+    // Constants
+    static constexpr std::size_t buffer_size = 6 * sizeof(void*);
+
+    // Using-declaration
+    using Buffer = std::aligned_storage_t<buffer_size, alignof(std::max_align_t)>;
+
+    template <typename Function>
+    using is_local_t =
+        std::integral_constant< bool
+                              , sizeof(Function) <= buffer_size
+                             && alignof(Function) <= alignof(std::max_align_t)
+                             && std::is_nothrow_move_constructible<Function>::value >;
+
+    // Accessor
+    template <typename Function>
+    static auto getOperations (std::true_type) -> const Operations*;
+    template <typename Function>
+    static auto getOperations (std::false_type) -> const Operations*;
+
+    // Methods
+    template <typename Callable
+            , typename Function>
+    void create (Function&&, std::true_type);
+    template <typename Callable
+            , typename Function>
+    void create (Function&&, std::false_type);
+
+    // Data members
+    Buffer             buffer{};
+    const Operations*  ops{nullptr};
+};
+
+// FCallbackFunction inline functions
+//----------------------------------------------------------------------
+template <typename Function
+        , FCallbackFunction::enable_if_not_FCallbackFunction_t<Function>>
+inline FCallbackFunction::FCallbackFunction (Function&& function)
+{
+  // Small callables are stored in the local buffer,
+  // larger ones on the heap
+
+  using Callable = std::decay_t<Function>;
+  using IsLocal = is_local_t<Callable>;
+  create<Callable> (std::forward<Function>(function), IsLocal{});
+  ops = getOperations<Callable>(IsLocal{});
+}
+
+//----------------------------------------------------------------------
+inline FCallbackFunction::FCallbackFunction (const FCallbackFunction& other)
+  : ops{other.ops}
+{
+  if ( ops )
+    ops->copy (&other.buffer, &buffer);
+}
+
+//----------------------------------------------------------------------
+inline FCallbackFunction::FCallbackFunction (FCallbackFunction&& other) noexcept
+  : ops{other.ops}
+{
+  if ( ops )
+    ops->move (&other.buffer, &buffer);
+
+  other.ops = nullptr;
+}
+
+//----------------------------------------------------------------------
+inline FCallbackFunction::~FCallbackFunction()  // destructor
+{
+  if ( ops )
+    ops->destroy (&buffer);
+}
+
+//----------------------------------------------------------------------
+inline auto FCallbackFunction::operator = (const FCallbackFunction& other) -> FCallbackFunction&
+{
+  if ( this != &other )
+  {
+    FCallbackFunction copy{other};
+    *this = std::move(copy);
+  }
+
+  return *this;
+}
+
+//----------------------------------------------------------------------
+inline auto FCallbackFunction::operator = (FCallbackFunction&& other) noexcept -> FCallbackFunction&
+{
+  if ( this == &other )
+    return *this;
+
+  if ( ops )
+    ops->destroy (&buffer);
+
+  ops = other.ops;
+
+  if ( ops )
+    ops->move (&other.buffer, &buffer);
+
+  other.ops = nullptr;
+  return *this;
+}
+
+//----------------------------------------------------------------------
+inline FCallbackFunction::operator bool () const noexcept
+{ return ops != nullptr; }
+
+//----------------------------------------------------------------------
+inline void FCallbackFunction::operator () () const
+{
+  if ( ! ops )
+    throw std::bad_function_call{};
+
+  ops->invoke (const_cast<Buffer*>(&buffer));
+}
+
+//----------------------------------------------------------------------
+template <typename Function>
+inline auto FCallbackFunction::getOperations (std::true_type) -> const Operations*
+{
+  // The callable lives in the local buffer
+
+  static const Operations operations
+  {
+    [] (void* obj)
+    { (*static_cast<Function*>(obj))(); },
+    [] (const void* src, void* dst)
+    { new (dst) Function(*static_cast<const Function*>(src)); },
+    [] (void* src, void* dst)
+    {
+      new (dst) Function(std::move(*static_cast<Function*>(src)));
+      static_cast<Function*>(src)->~Function();
+    },
+    [] (void* obj)
+    { static_cast<Function*>(obj)->~Function(); }
+  };
+
+  return &operations;
+}
+
+//----------------------------------------------------------------------
+template <typename Function>
+inline auto FCallbackFunction::getOperations (std::false_type) -> const Operations*
+{
+  // The local buffer holds a pointer to the callable
+
+  static const Operations operations
+  {
+    [] (void* obj)
+    { (**static_cast<Function**>(obj))(); },
+    [] (const void* src, void* dst)
+    {
+      const auto function = *static_cast<Function* const*>(src);
+      *static_cast<Function**>(dst) = new Function(*function);
+    },
+    [] (void* src, void* dst)
+    { *static_cast<Function**>(dst) = *static_cast<Function**>(src); },
+    [] (void* obj)
+    { delete *static_cast<Function**>(obj); }
+  };
+
+  return &operations;
+}
+
+//----------------------------------------------------------------------
+template <typename Callable
+        , typename Function>
+inline void FCallbackFunction::create (Function&& function, std::true_type)
+{
+  new (&buffer) Callable(std::forward<Function>(function));
+}
+
+//----------------------------------------------------------------------
+template <typename Callable
+        , typename Function>
+inline void FCallbackFunction::create (Function&& function, std::false_type)
+{
+  *reinterpret_cast<Callable**>(&buffer) = new Callable(std::forward<Function>(function));
+}
+
+
 //----------------------------------------------------------------------
 // struct FCallbackData
 //----------------------------------------------------------------------
@@ -57,8 +297,8 @@ struct FCallbackData
   FCallbackData() = default;
 
   template <typename FuncPtr>
-  FCallbackData (FString&& s, FWidget* i, FuncPtr m, FCall&& c)
-    : cb_signal(std::move(s))
+  FCallbackData (FSignalId s, FWidget* i, FuncPtr m, FCallbackFunction&& c)
+    : cb_signal(s)
     , cb_instance(i)
     , cb_function_ptr(m)
     , cb_function(std::move(c))
@@ -71,10 +311,10 @@ struct FCallbackData
   auto operator = (FCallbackData&&) noexcept -> FCallbackData& = default;
 
   // Data members
-  FString   cb_signal{};
-  FWidget*  cb_instance{};
-  void*     cb_function_ptr{};
-  FCall     cb_function{};
+  FSignalId          cb_signal{};
+  FWidget*           cb_instance{};
+  void*              cb_function_ptr{};
+  FCallbackFunction  cb_function{};
 };
 
 
@@ -147,6 +387,7 @@ class FCallback
     // Accessors
     auto getClassName() const -> FString;
     auto getCallbackCount() const -> std::size_t;
+    static auto getSignalId (const FString&) -> FSignalId;
 
     // Methods
     template <typename Object
@@ -207,13 +448,30 @@ class FCallback
     void delCallback (const Function& cb_function);
     void delCallback();
     void emitCallback (const FString& emit_signal) const;
+    void emitCallback (FSignalId emit_signal) const;
 
   private:
     // Using-declaration
     using FCallbackObjects = std::vector<FCallbackData>;
 
+    // Accessor
+    static auto findSignalId (const FString&, FSignalId&) -> bool;
+
+    // Methods
+    template <typename Function
+            , typename... Args>
+    static auto bindArguments (Function&&, Args&&...);
+    template <typename Function
+            , typename Tuple
+            , std::size_t... Index>
+    static void callFunction (Function&, Tuple&, std::index_sequence<Index...>);
+    template <typename Function>
+    void insertCallback (FString&&, FWidget*, void*, Function&&);
+    template <typename Predicate>
+    void eraseCallbacks (Predicate&&);
+
     // Data members
-    FCallbackObjects  callback_objects{};
+    FCallbackObjects  callback_objects{};  // Sorted by signal id
 };
 
 // FCallback inline functions
@@ -225,6 +483,67 @@ inline auto FCallback::getClassName() const -> FString
 inline auto FCallback::getCallbackCount() const -> std::size_t
 { return callback_objects.size(); }
 
+//----------------------------------------------------------------------
+template <typename Function
+        , typename... Args>
+inline auto FCallback::bindArguments (Function&& function, Args&&... args)
+{
+  // Stores the function with a copy of its arguments like std::bind().
+  // std::ref() and std::cref() arguments are passed as references.
+
+  return [fn = std::decay_t<Function>(std::forward<Function>(function))
+        , arguments = std::make_tuple(std::forward<Args>(args)...)] () mutable
+         {
+           callFunction (fn, arguments, std::index_sequence_for<Args...>{});
+         };
+}
+
+//----------------------------------------------------------------------
+template <typename Function
+        , typename Tuple
+        , std::size_t... Index>
+inline void FCallback::callFunction ( Function& function
+                                    , Tuple& arguments
+                                    , std::index_sequence<Index...> )
+{
+  function (std::get<Index>(arguments)...);
+}
+
+//----------------------------------------------------------------------
+template <typename Function>
+inline void FCallback::insertCallback ( FString&& cb_signal
+                                      , FWidget* cb_instance
+                                      , void* cb_function_ptr
+                                      , Function&& cb_function )
+{
+  // The entries of a signal are kept together and in the order
+  // of their registration, so emitCallback() calls one range
+
+  const auto signal_id = getSignalId(cb_signal);
+  const auto iter = std::upper_bound ( callback_objects.cbegin()
+                                     , callback_objects.cend()
+                                     , signal_id
+                                     , [] (FSignalId id, const FCallbackData& cback)
+                                       {
+                                         return id < cback.cb_signal;
+                                       } );
+  callback_objects.emplace ( iter, signal_id, cb_instance, cb_function_ptr
+                           , FCallbackFunction{std::forward<Function>(cb_function)} );
+}
+
+//----------------------------------------------------------------------
+template <typename Predicate>
+inline void FCallback::eraseCallbacks (Predicate&& predicate)
+{
+  if ( callback_objects.empty() )
+    return;
+
+  auto last = std::remove_if ( callback_objects.begin()
+                             , callback_objects.end()
+                             , std::forward<Predicate>(predicate) );
+  callback_objects.erase (last, callback_objects.end());
+}
+
 //----------------------------------------------------------------------
 template <typename Object
         , typename Function
@@ -239,10 +558,10 @@ inline void FCallback::addCallback ( FString&&  cb_signal
   // Add a member function pointer as callback
 
   Object instance = cb_instance;
-  auto fn = std::bind ( std::forward<Function>(cb_member)
-                      , std::forward<Object>(cb_instance)
-                      , std::forward<Args>(args)... );
-  callback_objects.emplace_back (std::move(cb_signal), instance, nullptr, fn);
+  auto fn = bindArguments ( std::mem_fn(std::forward<Function>(cb_member))
+                          , std::forward<Object>(cb_instance)
+                          , std::forward<Args>(args)... );
+  insertCallback (std::move(cb_signal), instance, nullptr, std::move(fn));
 }
 
 //----------------------------------------------------------------------
@@ -258,8 +577,8 @@ inline void FCallback::addCallback ( FString&&  cb_signal
 {
   // Add a function object to an instance as callback
 
-  auto fn = std::bind (std::forward<Function>(cb_function), std::forward<Args>(args)...);
-  callback_objects.emplace_back (std::move(cb_signal), cb_instance, nullptr, fn);
+  auto fn = bindArguments (std::forward<Function>(cb_function), std::forward<Args>(args)...);
+  insertCallback (std::move(cb_signal), cb_instance, nullptr, std::move(fn));
 }
 
 //----------------------------------------------------------------------
@@ -272,9 +591,9 @@ inline void FCallback::addCallback ( FString&&  cb_signal
 {
   // Add a function object as callback
 
-  auto fn = std::bind ( std::forward<Function>(cb_function)
-                      , std::forward<Args>(args)... );
-  callback_objects.emplace_back (std::move(cb_signal), nullptr, nullptr, fn);
+  auto fn = bindArguments ( std::forward<Function>(cb_function)
+                          , std::forward<Args>(args)... );
+  insertCallback (std::move(cb_signal), nullptr, nullptr, std::move(fn));
 }
 
 //----------------------------------------------------------------------
@@ -287,8 +606,8 @@ inline void FCallback::addCallback ( FString&& cb_signal
 {
   // Add a function object reference as callback
 
-  auto fn = std::bind (cb_function, std::forward<Args>(args)...);
-  callback_objects.emplace_back (std::move(cb_signal), nullptr, nullptr, fn);
+  auto fn = bindArguments (cb_function, std::forward<Args>(args)...);
+  insertCallback (std::move(cb_signal), nullptr, nullptr, std::move(fn));
 }
 
 //----------------------------------------------------------------------
@@ -302,8 +621,8 @@ inline void FCallback::addCallback ( FString&& cb_signal
   // Add a function reference as callback
 
   auto ptr = reinterpret_cast<void*>(&cb_function);
-  auto fn = std::bind (cb_function, std::forward<Args>(args)...);
-  callback_objects.emplace_back (std::move(cb_signal), nullptr, ptr, fn);
+  auto fn = bindArguments (cb_function, std::forward<Args>(args)...);
+  insertCallback (std::move(cb_signal), nullptr, ptr, std::move(fn));
 }
 
 //----------------------------------------------------------------------
@@ -317,9 +636,9 @@ inline void FCallback::addCallback ( FString&&  cb_signal
   // Add a function pointer as callback
 
   auto ptr = reinterpret_cast<void*>(cb_function);
-  auto fn = std::bind ( std::forward<Function>(cb_function)
-                      , std::forward<Args>(args)... );
-  callback_objects.emplace_back(std::move(cb_signal), nullptr, ptr, fn);
+  auto fn = bindArguments ( std::forward<Function>(cb_function)
+                          , std::forward<Args>(args)... );
+  insertCallback (std::move(cb_signal), nullptr, ptr, std::move(fn));
 }
 
 //----------------------------------------------------------------------
@@ -329,18 +648,10 @@ inline void FCallback::delCallback (Object&& cb_instance) noexcept
 {
   // Deletes entries with the given instance from the callback list
 
-  if ( callback_objects.empty() )
-    return;
-
-  auto iter = callback_objects.cbegin();
-
-  while ( iter != callback_objects.cend() )
-  {
-    if ( iter->cb_instance == cb_instance )
-      iter = callback_objects.erase(iter);
-    else
-      ++iter;
-  }
+  eraseCallbacks ( [&cb_instance] (const FCallbackData& cback)
+                   {
+                     return cback.cb_instance == cb_instance;
+                   } );
 }
 
 //----------------------------------------------------------------------
@@ -352,19 +663,16 @@ inline void FCallback::delCallback ( const FString& cb_signal
   // Deletes entries with the given signal and instance
   // from the callback list
 
-  if ( callback_objects.empty() )
-    return;
+  FSignalId signal_id{};
 
-  auto iter = callback_objects.cbegin();
+  if ( ! findSignalId(cb_signal, signal_id) )
+    return;
 
-  while ( iter != callback_objects.cend() )
-  {
-    if ( iter->cb_signal == cb_signal
-      && iter->cb_instance == cb_instance )
-      iter = callback_objects.erase(iter);
-    else
-      ++iter;
-  }
+  eraseCallbacks ( [&cb_instance, signal_id] (const FCallbackData& cback)
+                   {
+                     return cback.cb_signal == signal_id
+                         && cback.cb_instance == cb_instance;
+                   } );
 }
 
 //----------------------------------------------------------------------
@@ -375,19 +683,11 @@ inline void FCallback::delCallback (FunctionPtr&& cb_func_ptr) noexcept
   // Deletes entries with the given function pointer
   // from the callback list
 
-  if ( callback_objects.empty() )
-    return;
-
   auto ptr = reinterpret_cast<void*>(cb_func_ptr);
-  auto iter = callback_objects.cbegin();
-
-  while ( iter != callback_objects.cend() )
-  {
-    if ( iter->cb_function_ptr == ptr )
-      iter = callback_objects.erase(iter);
-    else
-      ++iter;
-  }
+  eraseCallbacks ( [ptr] (const FCallbackData& cback)
+                   {
+                     return cback.cb_function_ptr == ptr;
+                   } );
 }
 
 //----------------------------------------------------------------------
@@ -398,19 +698,11 @@ inline void FCallback::delCallback (const Function& cb_function)
   // Deletes entries with the given function reference
   // from the callback list
 
-  if ( callback_objects.empty() )
-    return;
-
   auto ptr = reinterpret_cast<void*>(&cb_function);
-  auto iter = callback_objects.cbegin();
-
-  while ( iter != callback_objects.cend() )
-  {
-    if ( iter->cb_function_ptr == ptr )
-      iter = callback_objects.erase(iter);
-    else
-      ++iter;
-  }
+  eraseCallbacks ( [ptr] (const FCallbackData& cback)
+                   {
+                     return cback.cb_function_ptr == ptr;
+                   } );
 }
 
 }  // namespace finalcut
@@ -20,21 +20,414 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <time.h>
+
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "final/util/flogger.h"
 
 namespace finalcut
 {
 
+//----------------------------------------------------------------------
+// class FLogger::AsyncWriter
+//----------------------------------------------------------------------
+
+class FLogger::AsyncWriter
+{
+  public:
+    // Constructor
+    AsyncWriter (FLogger*, std::size_t, OverflowPolicy);
+
+    // Disable copy constructor
+    AsyncWriter (const AsyncWriter&) = delete;
+
+    // Destructor
+    ~AsyncWriter() noexcept;
+
+    // Disable copy assignment operator (=)
+    auto operator = (const AsyncWriter&) -> AsyncWriter& = delete;
+
+    // Accessor
+    auto getDroppedRecords() const -> uInt64;
+
+    // Methods
+    void push (LogLevel, const std::string&);
+    void flush();
+
+  private:
+    struct Record
+    {
+      std::string message{};
+      std::time_t time{0};
+      LogLevel    level{LogLevel::Info};
+    };
+
+    struct Slot
+    {
+      std::atomic<std::size_t> sequence{0};
+      Record                   record{};
+    };
+
+    // Accessor
+    static auto getCoarseTime() -> std::time_t;
+
+    // Inquiry
+    auto isEmpty() const -> bool;
+
+    // Methods
+    auto tryPush (LogLevel, const std::string&) -> bool;
+    auto pop (Record&) -> bool;
+    void wakeUpWriter();
+    void writeBatch();
+    void run();
+
+    // Data members
+    FLogger*                 logger{nullptr};
+    OverflowPolicy           policy{OverflowPolicy::Drop};
+    std::vector<Slot>        ring;
+    std::size_t              mask{0};
+    std::atomic<std::size_t> enqueue_pos{0};
+    std::size_t              dequeue_pos{0};  // Writer thread only
+    std::atomic<std::size_t> written_pos{0};
+    std::atomic<uInt64>      dropped{0};
+    uInt64                   reported_drops{0};
+    Record                   record{};
+    std::string              batch{};
+    std::string              time_string{};
+    std::time_t              last_time{-1};
+    std::atomic<bool>        writer_waiting{false};
+    std::atomic<bool>        running{true};
+    std::mutex               wait_mutex{};
+    std::condition_variable  wakeup{};
+    std::condition_variable  written{};
+    std::thread              writer{};
+};
+
+// constructors and destructor
+//----------------------------------------------------------------------
+FLogger::AsyncWriter::AsyncWriter ( FLogger* log
+                                  , std::size_t capacity
+                                  , OverflowPolicy overflow_policy )
+  : logger{log}
+  , policy{overflow_policy}
+  , ring([capacity] ()
+         {
+           // Round up to a power of two for the index mask
+           std::size_t size{2};
+
+           while ( size < capacity )
+             size <<= 1;
+
+           return size;
+         }())
+  , mask{ring.size() - 1}
+{
+  for (std::size_t i{0}; i < ring.size(); i++)
+    ring[i].sequence.store(i, std::memory_order_relaxed);
+
+  writer = std::thread{&AsyncWriter::run, this};
+}
+
+//----------------------------------------------------------------------
+FLogger::AsyncWriter::~AsyncWriter() noexcept  // destructor
+{
+  {
+    std::lock_guard<std::mutex> lock_guard(wait_mutex);
+    running.store(false);
+  }
+
+  wakeup.notify_one();
+
+  if ( writer.joinable() )
+    writer.join();
+}
+
+
+// public methods of FLogger::AsyncWriter
+//----------------------------------------------------------------------
+inline auto FLogger::AsyncWriter::getDroppedRecords() const -> uInt64
+{
+  return dropped.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------
+void FLogger::AsyncWriter::push (LogLevel level, const std::string& msg)
+{
+  if ( tryPush(level, msg) )
+    return;
+
+  if ( policy == OverflowPolicy::Drop )
+  {
+    // The writer thread reports the number of lost records
+    dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  // OverflowPolicy::Block
+  do
+  {
+    wakeUpWriter();
+    std::this_thread::yield();
+  }
+  while ( ! tryPush(level, msg) );
+}
+
+//----------------------------------------------------------------------
+void FLogger::AsyncWriter::flush()
+{
+  // Waits until all records accepted so far have been written
+  const auto target = enqueue_pos.load();
+  std::unique_lock<std::mutex> lock(wait_mutex);
+  wakeup.notify_one();
+  written.wait ( lock
+               , [this, target] ()
+                 {
+                   return written_pos.load() >= target
+                       || ! running.load();
+                 } );
+}
+
+
+// private methods of FLogger::AsyncWriter
+//----------------------------------------------------------------------
+auto FLogger::AsyncWriter::getCoarseTime() -> std::time_t
+{
+  // The coarse clock is read without a system call (vDSO)
+  // and has a resolution far better than the logged seconds
+
+#if defined(CLOCK_REALTIME_COARSE)
+  struct timespec ts{};
+
+  if ( clock_gettime(CLOCK_REALTIME_COARSE, &ts) == 0 )
+    return ts.tv_sec;
+#endif
+
+  return std::time(nullptr);
+}
+
+//----------------------------------------------------------------------
+inline auto FLogger::AsyncWriter::isEmpty() const -> bool
+{
+  const auto& slot = ring[dequeue_pos & mask];
+  return slot.sequence.load(std::memory_order_acquire) != dequeue_pos + 1;
+}
+
+//----------------------------------------------------------------------
+auto FLogger::AsyncWriter::tryPush ( LogLevel level
+                                   , const std::string& msg ) -> bool
+{
+  // Bounded multi-producer queue: every slot carries a sequence number
+  // that tells the producers whether it is free for the current lap
+
+  auto pos = enqueue_pos.load(std::memory_order_relaxed);
+  Slot* slot{nullptr};
+
+  while ( true )
+  {
+    slot = &ring[pos & mask];
+    const auto seq = slot->sequence.load(std::memory_order_acquire);
+    const auto diff = std::ptrdiff_t(seq) - std::ptrdiff_t(pos);
+
+    if ( diff == 0 )
+    {
+      if ( enqueue_pos.compare_exchange_weak ( pos, pos + 1
+                                             , std::memory_order_relaxed ) )
+        break;
+    }
+    else if ( diff < 0 )
+      return false;  // The ring buffer is full
+    else
+      pos = enqueue_pos.load(std::memory_order_relaxed);
+  }
+
+  // The slot string keeps its capacity, so the assignment
+  // only allocates for messages longer than before
+  slot->record.message = msg;
+  slot->record.time = getCoarseTime();
+  slot->record.level = level;
+  slot->sequence.store(pos + 1, std::memory_order_release);
+
+  if ( writer_waiting.load(std::memory_order_relaxed) )
+    wakeUpWriter();
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+auto FLogger::AsyncWriter::pop (Record& rec) -> bool
+{
+  if ( isEmpty() )
+    return false;
+
+  auto& slot = ring[dequeue_pos & mask];
+  std::swap (rec.message, slot.record.message);
+  rec.time = slot.record.time;
+  rec.level = slot.record.level;
+  slot.sequence.store(dequeue_pos + mask + 1, std::memory_order_release);
+  dequeue_pos++;
+  return true;
+}
+
+//----------------------------------------------------------------------
+inline void FLogger::AsyncWriter::wakeUpWriter()
+{
+  if ( writer_waiting.exchange(false) )
+    wakeup.notify_one();
+}
+
+//----------------------------------------------------------------------
+void FLogger::AsyncWriter::writeBatch()
+{
+  bool with_timestamp{};
+  std::string eol{};
+
+  {
+    // Snapshot of the output settings for this batch
+    std::lock_guard<std::mutex> lock_guard(logger->print_mutex);
+    with_timestamp = logger->timestamp;
+    eol = logger->getEOL();
+  }
+
+  const auto drops = dropped.load(std::memory_order_relaxed);
+
+  if ( drops != reported_drops )
+  {
+    const auto msg = std::to_string(drops - reported_drops)
+                   + " log records dropped";
+    reported_drops = drops;
+    const auto now_string = with_timestamp
+                          ? logger->getTimeString(getCoarseTime())
+                          : std::string{};
+    logger->appendLogLine (batch, LogLevel::Warn, msg, now_string, eol);
+  }
+
+  std::size_t count{0};
+
+  while ( count <= mask && pop(record) )
+  {
+    if ( with_timestamp && record.time != last_time )
+    {
+      time_string = logger->getTimeString(record.time);
+      last_time = record.time;
+    }
+
+    logger->appendLogLine ( batch, record.level, record.message
+                          , with_timestamp ? time_string : std::string{}
+                          , eol );
+    count++;
+  }
+
+  if ( batch.empty() )
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock_guard(logger->output_mutex);
+    logger->output << batch;
+  }
+
+  batch.clear();
+
+  {
+    std::lock_guard<std::mutex> lock_guard(wait_mutex);
+    written_pos.store(dequeue_pos);
+  }
+
+  written.notify_all();
+}
+
+//----------------------------------------------------------------------
+void FLogger::AsyncWriter::run()
+{
+  using std::chrono::milliseconds;
+
+  while ( true )
+  {
+    writeBatch();
+
+    if ( ! isEmpty() )
+      continue;
+
+    std::unique_lock<std::mutex> lock(wait_mutex);
+
+    if ( ! running.load() )
+      break;
+
+    // A producer only notifies while this flag is set. The timeout
+    // covers a push that races with falling asleep.
+    writer_waiting.store(true);
+    wakeup.wait_for ( lock, milliseconds(100)
+                    , [this] ()
+                      {
+                        return ! isEmpty() || ! running.load();
+                      } );
+    writer_waiting.store(false);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock_guard(logger->output_mutex);
+    logger->output.flush();
+  }
+
+  written.notify_all();
+}
+
+
 //----------------------------------------------------------------------
 // class FLogger
 //----------------------------------------------------------------------
 
 // constructors and destructor
 //----------------------------------------------------------------------
-FLogger::~FLogger() noexcept = default;  // destructor
+FLogger::FLogger() = default;  // constructor
+
+//----------------------------------------------------------------------
+FLogger::~FLogger() noexcept  // destructor
+{
+  disableAsync();
+}
+
+
+// public methods of FLogger
+//----------------------------------------------------------------------
+void FLogger::flush()
+{
+  if ( async_writer )
+    async_writer->flush();
+
+  std::lock_guard<std::mutex> lock_guard(output_mutex);
+  output.flush();
+}
+
+//----------------------------------------------------------------------
+void FLogger::enableAsync (std::size_t capacity, OverflowPolicy policy)
+{
+  // Hands the output over to a writer thread. The logging methods then
+  // only copy the message into a lock-free ring buffer. Must not be
+  // called while other threads are logging.
+
+  disableAsync();
+  async_writer = std::make_unique<AsyncWriter>(this, capacity, policy);
+}
+
+//----------------------------------------------------------------------
+void FLogger::disableAsync()
+{
+  // Writes all pending records before the writer thread ends
+  async_writer.reset();
+}
+
+//----------------------------------------------------------------------
+auto FLogger::getDroppedRecords() const -> uInt64
+{
+  return async_writer ? async_writer->getDroppedRecords() : 0;
+}
 
 
 // private methods of FLogger
@@ -54,11 +447,30 @@ void FLogger::newlineReplace ( std::string& str
 }
 
 //----------------------------------------------------------------------
-auto FLogger::getTimeString() const -> std::string
+auto FLogger::getLogLevelString (LogLevel log_level) const -> std::string
+{
+  switch ( log_level )
+  {
+    case LogLevel::Info:
+      return "INFO";
+
+    case LogLevel::Warn:
+      return "WARNING";
+
+    case LogLevel::Error:
+      return "ERROR";
+
+    case LogLevel::Debug:
+      return "DEBUG";
+  }
+
+  return "";
+}
+
+//----------------------------------------------------------------------
+auto FLogger::getTimeString (std::time_t t) const -> std::string
 {
   std::array<char, 100> str{};
-  const auto& now = std::chrono::system_clock::now();
-  const auto& t = std::chrono::system_clock::to_time_t(now);
   // Print RFC 2822 date
   struct tm time{};
   localtime_r (&t, &time);
@@ -82,44 +494,41 @@ auto FLogger::getEOL() const -> std::string
 }
 
 //----------------------------------------------------------------------
-void FLogger::printLogLine (const std::string& msg)
+void FLogger::appendLogLine ( std::string& buffer
+                            , LogLevel log_level
+                            , const std::string& msg
+                            , const std::string& time_str
+                            , const std::string& eol ) const
 {
-  const auto& log_level = [this] ()
-  {
-    switch ( getLevel() )
-    {
-      case LogLevel::Info:
-        return std::string("INFO");
-
-      case LogLevel::Warn:
-        return std::string("WARNING");
-
-      case LogLevel::Error:
-        return std::string("ERROR");
-
-      case LogLevel::Debug:
-        return std::string("DEBUG");
-    }
-
-    return std::string("");
-  }();
-
-  const auto& prefix = [this, &log_level] ()
-  {
-    if ( timestamp )
-      return getTimeString() + " [" + log_level + "] ";
-
-    return "[" + log_level + "] ";
-  }();
-
+  const auto& prefix = time_str.empty()
+                     ? "[" + getLogLevelString(log_level) + "] "
+                     : time_str + " [" + getLogLevelString(log_level) + "] ";
   std::string message{msg};
-  const auto& eol = getEOL();
   const auto replace_str = eol + prefix;
   newlineReplace (message, replace_str);
-  std::lock_guard<std::mutex> lock_guard(output_mutex);
-  output << prefix << message << eol;
+  buffer += prefix;
+  buffer += message;
+  buffer += eol;
 }
 
-}  // namespace finalcut
+//----------------------------------------------------------------------
+void FLogger::printLogLine (const std::string& msg)
+{
+  const auto& now = std::chrono::system_clock::now();
+  const auto& time_str = timestamp
+                       ? getTimeString(std::chrono::system_clock::to_time_t(now))
+                       : std::string{};
+  std::string line{};
+  appendLogLine (line, getLevel(), msg, time_str, getEOL());
+  std::lock_guard<std::mutex> lock_guard(output_mutex);
+  output << line;
+}
 
+//----------------------------------------------------------------------
+void FLogger::pushLogRecord (LogLevel log_level, const std::string& msg)
+{
+  // Formatting and the time string are left to the writer thread
+  async_writer->push (log_level, msg);
+}
 
+}  // namespace finalcut
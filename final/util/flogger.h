@@ -46,9 +46,11 @@
 #endif
 
 #include <chrono>
+#include <ctime>
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <string>
 
@@ -64,8 +66,15 @@ namespace finalcut
 class FLogger : public FLog
 {
   public:
+    // Enumeration
+    enum class OverflowPolicy
+    {
+      Drop,   // Discards the record when the ring buffer is full
+      Block   // Waits until the writer thread has freed a slot
+    };
+
     // Constructor
-    FLogger() = default;
+    FLogger();
 
     // Destructor
     ~FLogger() noexcept override;
@@ -81,19 +90,31 @@ class FLogger : public FLog
     void setLineEnding (LineEnding) override;
     void enableTimestamp() override;
     void disableTimestamp() override;
+    void enableAsync (std::size_t = 4096, OverflowPolicy = OverflowPolicy::Drop);
+    void disableAsync();
+    auto isAsync() const -> bool;
+    auto getDroppedRecords() const -> uInt64;
 
   private:
+    // Forward declaration
+    class AsyncWriter;
+
     // Methods
     void newlineReplace (std::string&, const std::string&) const;
-    auto getTimeString() const -> std::string;
+    auto getLogLevelString (LogLevel) const -> std::string;
+    auto getTimeString (std::time_t) const -> std::string;
     auto getEOL() const -> std::string;
+    void appendLogLine ( std::string&, LogLevel, const std::string&
+                       , const std::string&, const std::string& ) const;
     void printLogLine (const std::string&);
+    void pushLogRecord (LogLevel, const std::string&);
 
     // Data member
     bool         timestamp{false};
     std::mutex   print_mutex{};
     std::mutex   output_mutex{};
     std::ostream output{std::cerr.rdbuf()};
+    std::unique_ptr<AsyncWriter> async_writer{};
 };
 
 // FLogger inline functions
@@ -104,6 +125,9 @@ inline auto FLogger::getClassName() const -> FString
 //----------------------------------------------------------------------
 inline void FLogger::info (const std::string& msg)
 {
+  if ( async_writer )
+    return pushLogRecord (LogLevel::Info, msg);
+
   std::lock_guard<std::mutex> lock_guard(print_mutex);
   setLevel() = LogLevel::Info;
   printLogLine (msg);
@@ -112,6 +136,9 @@ inline void FLogger::info (const std::string& msg)
 //----------------------------------------------------------------------
 inline void FLogger::warn (const std::string& msg)
 {
+  if ( async_writer )
+    return pushLogRecord (LogLevel::Warn, msg);
+
   std::lock_guard<std::mutex> lock_guard(print_mutex);
   setLevel() = LogLevel::Warn;
   printLogLine (msg);
@@ -120,6 +147,9 @@ inline void FLogger::warn (const std::string& msg)
 //----------------------------------------------------------------------
 inline void FLogger::error (const std::string& msg)
 {
+  if ( async_writer )
+    return pushLogRecord (LogLevel::Error, msg);
+
   std::lock_guard<std::mutex> lock_guard(print_mutex);
   setLevel() = LogLevel::Error;
   printLogLine (msg);
@@ -128,18 +158,14 @@ inline void FLogger::error (const std::string& msg)
 //----------------------------------------------------------------------
 inline void FLogger::debug (const std::string& msg)
 {
+  if ( async_writer )
+    return pushLogRecord (LogLevel::Debug, msg);
+
   std::lock_guard<std::mutex> lock_guard(print_mutex);
   setLevel() = LogLevel::Debug;
   printLogLine (msg);
 }
 
-//----------------------------------------------------------------------
-inline void FLogger::flush()
-{
-  std::lock_guard<std::mutex> lock_guard(output_mutex);
-  output.flush();
-}
-
 //----------------------------------------------------------------------
 inline void FLogger::setOutputStream (const std::ostream& os)
 {
@@ -168,6 +194,10 @@ inline void FLogger::disableTimestamp()
   timestamp = false;
 }
 
+//----------------------------------------------------------------------
+inline auto FLogger::isAsync() const -> bool
+{ return bool(async_writer); }
+
 }  // namespace finalcut
 
 #endif  // FLOGGER_H
@@ -0,0 +1,336 @@
+/***********************************************************************
+* fmappedtextfile.cpp - Memory-mapped UTF-8 text file with a line      *
+*                       index                                          *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2023 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <string>
+
+#include "final/util/fmappedtextfile.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FMappedTextFile
+//----------------------------------------------------------------------
+
+// destructor
+//----------------------------------------------------------------------
+FMappedTextFile::~FMappedTextFile() noexcept  // destructor
+{
+  close();
+}
+
+
+// public methods of FMappedTextFile
+//----------------------------------------------------------------------
+auto FMappedTextFile::getLine ( std::size_t line
+                              , std::size_t max_length ) const -> FString
+{
+  // Decodes a single line from the mapped file.
+  // Bytes beyond max_length are not read.
+
+  if ( line >= getLineCount() )
+    return {};
+
+  // Pages behind the end of a truncated file must not be touched
+  const auto end_pos = std::min(scan_pos, getCurrentFileSize());
+
+  // Skip forward from the nearest checkpoint
+  auto pos = checkpoints[line / CHECKPOINT_INTERVAL];
+
+  if ( pos > end_pos )
+    return {};
+
+  for (auto n = line % CHECKPOINT_INTERVAL; n > 0; n--)
+  {
+    const auto* newline = static_cast<const char*>
+        (std::memchr(data + pos, '\n', end_pos - pos));
+
+    if ( ! newline )
+      return {};
+
+    pos = std::size_t(newline - data) + 1;
+  }
+
+  const auto length = std::min(end_pos - pos, max_length);
+  const auto* newline = static_cast<const char*>
+      (std::memchr(data + pos, '\n', length));
+  auto end = ( newline ) ? std::size_t(newline - data) : pos + length;
+
+  if ( end > pos && data[end - 1] == '\r' )
+    end--;
+
+  return decodeUtf8 (data + pos, end - pos);
+}
+
+//----------------------------------------------------------------------
+auto FMappedTextFile::open (const std::string& name) -> bool
+{
+  close();
+  fd = ::open(name.c_str(), O_RDONLY);
+
+  if ( fd < 0 )
+    return false;
+
+  struct stat file_stat{};
+
+  if ( ::fstat(fd, &file_stat) != 0
+    || ! S_ISREG(file_stat.st_mode)
+    || ! map(std::size_t(file_stat.st_size)) )
+  {
+    close();
+    return false;
+  }
+
+  file_name = name;
+  resetIndex();
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFile::close()
+{
+  unmap();
+
+  if ( fd >= 0 )
+    ::close(fd);
+
+  fd = -1;
+  file_name.clear();
+  resetIndex();
+}
+
+//----------------------------------------------------------------------
+auto FMappedTextFile::buildIndex (std::size_t max_bytes) -> bool
+{
+  // Extends the line index by up to max_bytes and returns true
+  // when the whole file is indexed
+
+  if ( scan_pos < file_size && getCurrentFileSize() < file_size )
+    refresh();  // Restarts the index of a truncated file
+
+  const auto end = std::min(file_size, scan_pos + max_bytes);
+  auto pos = scan_pos;
+
+  while ( pos < end )
+  {
+    const auto* newline = static_cast<const char*>
+        (std::memchr(data + pos, '\n', end - pos));
+
+    if ( ! newline )
+    {
+      pos = end;
+      break;
+    }
+
+    const auto line_end = std::size_t(newline - data);
+    max_line_length = std::max(max_line_length, line_end - line_start);
+    line_start = line_end + 1;
+    pos = line_start;
+    full_lines++;
+
+    if ( full_lines % CHECKPOINT_INTERVAL == 0 )
+      checkpoints.push_back(line_start);
+  }
+
+  // The scanned pages are no longer needed in memory
+  releasePages (scan_pos, pos);
+  scan_pos = pos;
+  return isIndexComplete();
+}
+
+//----------------------------------------------------------------------
+auto FMappedTextFile::refresh() -> bool
+{
+  // Follows size changes of the file on disk.
+  // Returns true if the file size has changed.
+
+  if ( ! isOpen() )
+    return false;
+
+  const auto new_size = getCurrentFileSize();
+
+  if ( new_size == file_size )
+    return false;
+
+  if ( new_size < file_size )  // Truncated file
+    resetIndex();
+
+  if ( ! map(new_size) )
+    resetIndex();
+
+  // Indexing continues with the appended data
+  return true;
+}
+
+
+// private methods of FMappedTextFile
+//----------------------------------------------------------------------
+auto FMappedTextFile::getCurrentFileSize() const noexcept -> std::size_t
+{
+  // Returns the file size on disk, which can be smaller than
+  // the mapped size if the file was truncated in the meantime
+
+  struct stat file_stat{};
+
+  if ( ! isOpen() || ::fstat(fd, &file_stat) != 0 )
+    return 0;
+
+  return std::size_t(file_stat.st_size);
+}
+
+//----------------------------------------------------------------------
+auto FMappedTextFile::map (std::size_t size) -> bool
+{
+  unmap();
+
+  if ( size == 0 )
+    return true;  // Empty files cannot be mapped
+
+  void* addr = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+
+  if ( addr == MAP_FAILED )
+    return false;
+
+  data = static_cast<const char*>(addr);
+  file_size = size;
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFile::unmap()
+{
+  if ( data )
+    ::munmap (const_cast<char*>(data), file_size);
+
+  data = nullptr;
+  file_size = 0;
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFile::resetIndex()
+{
+  scan_pos = 0;
+  line_start = 0;
+  full_lines = 0;
+  max_line_length = 0;
+  checkpoints.assign(1, 0);  // The first line starts at offset 0
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFile::releasePages (std::size_t from, std::size_t to) const
+{
+  // Removes the complete pages in the range [from, to)
+  // from the resident set of the process
+
+#if defined(MADV_DONTNEED)
+  static const auto page_size = std::size_t(::sysconf(_SC_PAGESIZE));
+  const auto first = from - from % page_size;
+  const auto last = to - to % page_size;
+
+  if ( ! data || first >= last )
+    return;
+
+  ::madvise (const_cast<char*>(data) + first, last - first, MADV_DONTNEED);
+#else
+  (void)from;
+  (void)to;
+#endif
+}
+
+//----------------------------------------------------------------------
+auto FMappedTextFile::decodeUtf8 (const char* str, std::size_t length) -> FString
+{
+  // Converts UTF-8 to wide characters independent of the locale.
+  // Invalid byte sequences are replaced by U+FFFD.
+
+  static constexpr wchar_t replacement_char = L'\xfffd';
+  const auto* s = reinterpret_cast<const uChar*>(str);
+  const auto* const end = s + length;
+  std::wstring wstr{};
+  wstr.reserve(length);
+
+  while ( s < end )
+  {
+    const auto byte = *s;
+
+    if ( byte < 0x80 )  // ASCII
+    {
+      wstr.push_back(wchar_t(byte));
+      ++s;
+      continue;
+    }
+
+    std::size_t len{0};
+    uInt32 code_point{0};
+    uInt32 min_value{0};
+
+    if ( (byte & 0xe0) == 0xc0 )
+    {
+      len = 2;
+      code_point = byte & 0x1f;
+      min_value = 0x80;
+    }
+    else if ( (byte & 0xf0) == 0xe0 )
+    {
+      len = 3;
+      code_point = byte & 0x0f;
+      min_value = 0x800;
+    }
+    else if ( (byte & 0xf8) == 0xf0 )
+    {
+      len = 4;
+      code_point = byte & 0x07;
+      min_value = 0x10000;
+    }
+
+    std::size_t i{1};
+
+    while ( len > 0 && i < len && s + i < end && (s[i] & 0xc0) == 0x80 )
+    {
+      code_point = (code_point << 6) | (s[i] & 0x3f);
+      i++;
+    }
+
+    if ( len == 0 || i < len
+      || code_point < min_value || code_point > 0x10ffff
+      || (code_point >= 0xd800 && code_point <= 0xdfff) )
+    {
+      wstr.push_back(replacement_char);
+      s += i;
+      continue;
+    }
+
+    wstr.push_back(wchar_t(code_point));
+    s += len;
+  }
+
+  return {std::move(wstr)};
+}
+
+}  // namespace finalcut
@@ -0,0 +1,158 @@
+/***********************************************************************
+* fmappedtextfile.h - Memory-mapped UTF-8 text file with a line index  *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2023 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+/*  Standalone class
+ *  ════════════════
+ *
+ * ▕▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▔▏
+ * ▕ FMappedTextFile ▏
+ * ▕▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▁▏
+ */
+
+#ifndef FMAPPEDTEXTFILE_H
+#define FMAPPEDTEXTFILE_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "final/util/fstring.h"
+
+namespace finalcut
+{
+
+//----------------------------------------------------------------------
+// class FMappedTextFile
+//----------------------------------------------------------------------
+
+class FMappedTextFile final
+{
+  public:
+    // Constructor
+    FMappedTextFile() = default;
+
+    // Disable copy constructor
+    FMappedTextFile (const FMappedTextFile&) = delete;
+
+    // Destructor
+    ~FMappedTextFile() noexcept;
+
+    // Disable copy assignment operator (=)
+    auto operator = (const FMappedTextFile&) -> FMappedTextFile& = delete;
+
+    // Accessors
+    auto getClassName() const -> FString;
+    auto getFileName() const -> const std::string&;
+    auto getFileSize() const noexcept -> std::size_t;
+    auto getIndexedSize() const noexcept -> std::size_t;
+    auto getLineCount() const noexcept -> std::size_t;
+    auto getMaxLineLength() const noexcept -> std::size_t;
+    auto getLine ( std::size_t
+                 , std::size_t = std::numeric_limits<std::size_t>::max() ) const -> FString;
+
+    // Inquiries
+    auto isOpen() const noexcept -> bool;
+    auto isIndexComplete() const noexcept -> bool;
+
+    // Methods
+    auto open (const std::string&) -> bool;
+    void close();
+    auto buildIndex (std::size_t) -> bool;
+    auto refresh() -> bool;
+
+  private:
+    // Constants
+    static constexpr std::size_t CHECKPOINT_INTERVAL = 64;
+
+    // Accessor
+    auto getCurrentFileSize() const noexcept -> std::size_t;
+
+    // Methods
+    auto map (std::size_t) -> bool;
+    void unmap();
+    void resetIndex();
+    void releasePages (std::size_t, std::size_t) const;
+    static auto decodeUtf8 (const char*, std::size_t) -> FString;
+
+    // Data members
+    std::string              file_name{};
+    int                      fd{-1};
+    const char*              data{nullptr};
+    std::size_t              file_size{0};
+    std::size_t              scan_pos{0};       // End of the indexed bytes
+    std::size_t              line_start{0};     // Start of the open line
+    std::size_t              full_lines{0};     // Lines ending with '\n'
+    std::size_t              max_line_length{0};
+    std::vector<std::size_t> checkpoints{};     // Offset of every 64th line
+};
+
+// FMappedTextFile inline functions
+//----------------------------------------------------------------------
+inline auto FMappedTextFile::getClassName() const -> FString
+{ return "FMappedTextFile"; }
+
+//----------------------------------------------------------------------
+inline auto FMappedTextFile::getFileName() const -> const std::string&
+{ return file_name; }
+
+//----------------------------------------------------------------------
+inline auto FMappedTextFile::getFileSize() const noexcept -> std::size_t
+{ return file_size; }
+
+//----------------------------------------------------------------------
+inline auto FMappedTextFile::getIndexedSize() const noexcept -> std::size_t
+{ return scan_pos; }
+
+//----------------------------------------------------------------------
+inline auto FMappedTextFile::getLineCount() const noexcept -> std::size_t
+{
+  // The last line without a line break is only counted
+  // after the whole file has been indexed
+  return ( isIndexComplete() && line_start < file_size )
+         ? full_lines + 1
+         : full_lines;
+}
+
+//----------------------------------------------------------------------
+inline auto FMappedTextFile::getMaxLineLength() const noexcept -> std::size_t
+{
+  return ( isIndexComplete() )
+         ? std::max(max_line_length, file_size - line_start)
+         : max_line_length;
+}
+
+//----------------------------------------------------------------------
+inline auto FMappedTextFile::isOpen() const noexcept -> bool
+{ return fd >= 0; }
+
+//----------------------------------------------------------------------
+inline auto FMappedTextFile::isIndexComplete() const noexcept -> bool
+{ return scan_pos >= file_size; }
+
+}  // namespace finalcut
+
+#endif  // FMAPPEDTEXTFILE_H
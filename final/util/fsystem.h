@@ -86,6 +86,10 @@ class FSystem
                                  const struct itimerspec*,
                                  struct itimerspec* ) -> int = 0;
     virtual auto timer_delete (timer_t) -> int = 0;
+    virtual auto timerfd_create (int, int) -> int = 0;
+    virtual auto timerfd_settime ( int, int
+                                 , const struct itimerspec*
+                                 , struct itimerspec* ) -> int = 0;
     virtual auto kqueue() -> int = 0;
     virtual auto kevent ( int, const struct kevent*
                         , int, struct kevent*
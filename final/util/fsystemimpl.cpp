@@ -31,6 +31,10 @@
   #include <sys/time.h>
 #endif
 
+#if defined(__linux__)
+  #include <sys/timerfd.h>
+#endif
+
 #if defined(__CYGWIN__)
   #include "final/fconfig.h"  // need for getpwuid_r and realpath
 #endif
@@ -120,6 +124,44 @@ auto FSystemImpl::timer_delete (timer_t) -> int
 
 #endif
 
+//----------------------------------------------------------------------
+#if defined(USE_TIMERFD_TIMER)
+
+auto FSystemImpl::timerfd_create (int clockid, int flags) -> int
+{
+  return ::timerfd_create (clockid, flags);
+}
+
+#else
+
+auto FSystemImpl::timerfd_create (int, int) -> int
+{
+  return 0;
+}
+
+#endif
+
+//----------------------------------------------------------------------
+#if defined(USE_TIMERFD_TIMER)
+
+auto FSystemImpl::timerfd_settime ( int fd, int flags
+                                  , const struct itimerspec* new_value
+                                  , struct itimerspec* old_value ) -> int
+{
+  return ::timerfd_settime (fd, flags, new_value, old_value);
+}
+
+#else
+
+auto FSystemImpl::timerfd_settime ( int, int
+                                  , const struct itimerspec*
+                                  , struct itimerspec* ) -> int
+{
+  return 0;
+}
+
+#endif
+
 //----------------------------------------------------------------------
 
 #if defined(USE_KQUEUE_TIMER)
@@ -175,6 +175,10 @@ class FSystemImpl : public FSystem
                        , const struct itimerspec*
                        , struct itimerspec* ) -> int override;
     auto timer_delete (timer_t) -> int override;
+    auto timerfd_create (int, int) -> int override;
+    auto timerfd_settime ( int, int
+                         , const struct itimerspec*
+                         , struct itimerspec* ) -> int override;
     auto kqueue() -> int override;
     auto kevent ( int, const struct ::kevent*
                 , int, struct ::kevent*
@@ -0,0 +1,155 @@
+/***********************************************************************
+* fchar_functions.cpp - FChar comparison helper functions              *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2023 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+// The vectorised comparison expects the x86 FChar layout
+// with a 4-byte wchar_t
+#if defined(__SSE2__) && defined(__SIZEOF_WCHAR_T__) \
+    && __SIZEOF_WCHAR_T__ == 4
+  #define USE_SSE2_FCHAR_COMPARE
+  #include <emmintrin.h>
+#endif
+
+#include <cstddef>
+#include <cstring>
+
+#include "final/vterm/fchar_functions.h"
+
+namespace finalcut
+{
+
+#if defined(USE_SSE2_FCHAR_COMPARE)
+// The character code and the two colors are stored
+// without gaps in front of the attribute word
+static_assert ( sizeof(FChar) == offsetof(FChar, attr) + sizeof(FAttribute)
+              , "FChar must not contain padding bytes" );
+static_assert ( offsetof(FChar, attr) == 24
+              , "Unexpected FChar memory layout" );
+#endif
+
+namespace internal
+{
+
+//----------------------------------------------------------------------
+inline auto compareFChar (const FChar& lhs, const FChar& rhs) noexcept -> bool
+{
+  // Compares all bytes of the character code, the colors and the
+  // visible attributes at once. Only if the bytes of the character
+  // code differ, an exact comparison is required because the bytes
+  // behind the string terminator have no meaning.
+
+#if defined(USE_SSE2_FCHAR_COMPARE)
+  const auto* l = reinterpret_cast<const uInt8*>(&lhs);
+  const auto* r = reinterpret_cast<const uInt8*>(&rhs);
+  // Relevant bits of the bytes 12 to 27 (x86 bit-field order):
+  // 12-19 = character code, 20-23 = colors, 24-25 = attribute
+  // byte #0 and #1, 26 = fullwidth_padding, 27 = padding byte
+  const auto mask = _mm_set_epi8 ( 0, 0x04, -1, -1, -1, -1, -1, -1
+                                 , -1, -1, -1, -1, -1, -1, -1, -1 );
+  const auto lo_l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(l));
+  const auto lo_r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(r));
+  const auto hi_l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(l + 12));
+  const auto hi_r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(r + 12));
+  const auto zero = _mm_setzero_si128();
+  const auto lo_diff = _mm_xor_si128(lo_l, lo_r);
+  const auto hi_diff = _mm_and_si128(_mm_xor_si128(hi_l, hi_r), mask);
+  const auto lo_equal = uInt(_mm_movemask_epi8(_mm_cmpeq_epi8(lo_diff, zero)));
+  const auto hi_equal = uInt(_mm_movemask_epi8(_mm_cmpeq_epi8(hi_diff, zero)));
+
+  if ( (lo_equal & hi_equal) == 0xffff )
+    return true;
+
+  if ( (hi_equal & 0xff00) != 0xff00 )  // Colors or attributes differ
+    return false;
+
+  return isFUnicodeEqual(lhs.ch, rhs.ch);
+#else
+  if ( std::memcmp(&lhs, &rhs, offsetof(FChar, attr)) == 0 )
+  {
+    return lhs.attr.byte[0] == rhs.attr.byte[0]
+        && lhs.attr.byte[1] == rhs.attr.byte[1]
+        && lhs.attr.bit.fullwidth_padding \
+                            == rhs.attr.bit.fullwidth_padding;
+  }
+
+  return lhs == rhs;
+#endif
+}
+
+}  // namespace internal
+
+
+// FChar non-member functions
+//----------------------------------------------------------------------
+auto isSameFChar (const FChar& lhs, const FChar& rhs) noexcept -> bool
+{
+  // Same result as operator ==, but faster for equal characters
+  return internal::compareFChar(lhs, rhs);
+}
+
+//----------------------------------------------------------------------
+auto getEqualPrefixLength ( const FChar* lhs
+                          , const FChar* rhs
+                          , std::size_t length ) noexcept -> std::size_t
+{
+  // Returns the number of equal characters at the beginning of both lines
+
+  std::size_t n{0};
+
+  while ( n < length && internal::compareFChar(lhs[n], rhs[n]) )
+    n++;
+
+  return n;
+}
+
+//----------------------------------------------------------------------
+auto getEqualSuffixLength ( const FChar* lhs
+                          , const FChar* rhs
+                          , std::size_t length ) noexcept -> std::size_t
+{
+  // Returns the number of equal characters at the end of both lines
+
+  std::size_t n{0};
+
+  while ( n < length && internal::compareFChar(lhs[length - n - 1], rhs[length - n - 1]) )
+    n++;
+
+  return n;
+}
+
+//----------------------------------------------------------------------
+auto getRepetitionLength (const FChar* line, std::size_t length) noexcept -> std::size_t
+{
+  // Returns the number of consecutive characters
+  // that are equal to the first character
+
+  if ( length == 0 )
+    return 0;
+
+  std::size_t n{1};
+
+  while ( n < length && internal::compareFChar(line[0], line[n]) )
+    n++;
+
+  return n;
+}
+
+}  // namespace finalcut
@@ -0,0 +1,45 @@
+/***********************************************************************
+* fchar_functions.h - FChar comparison helper functions                *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2023 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#ifndef FCHAR_FUNCTIONS_H
+#define FCHAR_FUNCTIONS_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <cstddef>
+
+#include "final/ftypes.h"
+
+namespace finalcut
+{
+
+// non-member function forward declarations
+auto isSameFChar (const FChar&, const FChar&) noexcept -> bool;
+auto getEqualPrefixLength (const FChar*, const FChar*, std::size_t) noexcept -> std::size_t;
+auto getEqualSuffixLength (const FChar*, const FChar*, std::size_t) noexcept -> std::size_t;
+auto getRepetitionLength (const FChar*, std::size_t) noexcept -> std::size_t;
+
+}  // namespace finalcut
+
+#endif  // FCHAR_FUNCTIONS_H
@@ -20,6 +20,7 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <cstdlib>
 #include <numeric>
 #include <string>
 #include <vector>
@@ -33,6 +34,7 @@
 #include "final/util/frect.h"
 #include "final/util/fsize.h"
 #include "final/util/fsystem.h"
+#include "final/vterm/fchar_functions.h"
 #include "final/vterm/fcolorpair.h"
 #include "final/vterm/fstyle.h"
 #include "final/vterm/fvterm.h"
@@ -52,6 +54,86 @@ struct var
 bool  var::fvterm_initialized{false};
 uInt8 var::b1_transparent_mask{};
 
+//----------------------------------------------------------------------
+inline auto getLineHash (const FChar* line, std::size_t length) noexcept -> uInt64
+{
+  // FNV-1a hash over the visible properties of all line characters
+
+  uInt64 hash{0xcbf29ce484222325};
+
+  const auto add = [&hash] (uInt64 value)
+  {
+    hash = (hash ^ value) * 0x100000001b3;
+  };
+
+  for (const auto* ch = line; ch < line + length; ++ch)
+  {
+    for (const auto& code : ch->ch)
+    {
+      if ( code == L'\0' )
+        break;
+
+      add (uInt64(code));
+    }
+
+    add ( uInt64(ch->fg_color)
+        | uInt64(ch->bg_color) << 16
+        | uInt64(ch->attr.byte[0]) << 32
+        | uInt64(ch->attr.byte[1]) << 40
+        | uInt64(ch->attr.bit.fullwidth_padding) << 48 );
+  }
+
+  return hash;
+}
+
+//----------------------------------------------------------------------
+inline auto getLineUpdateCost ( const FChar* line, const FChar* line_old
+                              , std::size_t length ) noexcept -> std::size_t
+{
+  // Estimates the output length for updating line_old to line.
+  // Without line_old, the entire line must be printed.
+
+  constexpr std::size_t cursor_move_cost = 6;  // e.g. "ESC[12;1H"
+  constexpr std::size_t attribute_cost = 10;   // e.g. "ESC[30;107m"
+  constexpr std::size_t repeat_cost = 6;       // e.g. "x ESC[23b"
+  std::size_t first{0};
+  std::size_t last{length};
+
+  if ( line_old )
+  {
+    first = getEqualPrefixLength (line, line_old, length);
+
+    if ( first == length )
+      return 0;
+
+    last -= getEqualSuffixLength (line + first, line_old + first, length - first);
+  }
+
+  std::size_t cost{cursor_move_cost};
+  std::size_t run{0};
+  const FChar* prev = ( first > 0 ) ? line + first - 1 : nullptr;
+
+  for (const auto* ch = line + first; ch < line + last; ++ch)
+  {
+    if ( prev && *ch == *prev )
+    {
+      run++;
+      continue;
+    }
+
+    if ( ! prev || ch->fg_color != prev->fg_color
+      || ch->bg_color != prev->bg_color
+      || ch->attr.byte[0] != prev->attr.byte[0] )
+      cost += attribute_cost;
+
+    cost += std::min(run, repeat_cost);
+    run = 1;
+    prev = ch;
+  }
+
+  return cost + std::min(run, repeat_cost);
+}
+
 }  // namespace internal
 
 // static class attributes
@@ -151,6 +233,36 @@ void FVTerm::setNonBlockingRead (bool enable)
   init_object->foutput->setNonBlockingRead (enable);
 }
 
+//----------------------------------------------------------------------
+auto FVTerm::hasPendingAreaUpdates() -> bool
+{
+  // Checks for desktop or window changes that are not yet in the vterm
+
+  static const auto& init_object = getGlobalFVTermInstance();
+
+  if ( ! init_object )
+    return false;
+
+  if ( hasPendingUpdates(init_object->vdesktop.get()) )
+    return true;
+
+  const auto& win_list = init_object->window_list;
+
+  if ( ! win_list )
+    return false;
+
+  return std::any_of ( win_list->cbegin()
+                     , win_list->cend()
+                     , [] (const auto& window)
+                       {
+                         const auto* v_win = window->getVWin();
+                         return v_win && v_win->visible && v_win->layer > 0
+                             && ( hasPendingUpdates(v_win)
+                               || init_object->hasChildAreaChanges(v_win) );
+                       }
+                     );
+}
+
 //----------------------------------------------------------------------
 void FVTerm::clearArea (wchar_t fillchar)
 {
@@ -197,6 +309,7 @@ void FVTerm::putVTerm() const
     vterm_changes.xmax = uInt(vterm->size.width - 1);
   }
 
+  vterm->addChangedLines (0, vterm->size.height - 1);
   updateTerminal();
 }
 
@@ -228,33 +341,195 @@ void FVTerm::reduceTerminalLineUpdates (uInt y)
   if ( xmin > xmax )  // No changes
     return;
 
-  const auto* first = &vterm->getFChar(int(xmin), int(y));
-  const auto* first_old = &vterm_old->getFChar(int(xmin), int(y));
-  auto* last = &vterm->getFChar(int(xmax), int(y));
-  const auto* last_old = &vterm_old->getFChar(int(xmax), int(y));
+  auto* line = &vterm->getFChar(0, int(y));
+  const auto* line_old = &vterm_old->getFChar(0, int(y));
+  const auto length = std::size_t(xmax - xmin + 1);
+  const auto prefix = getEqualPrefixLength (line + xmin, line_old + xmin, length);
+
+  if ( prefix == length )  // Line is unchanged
+  {
+    xmin = uInt(vterm->size.width);
+    xmax = 0;
+    return;
+  }
+
+  xmin += uInt(prefix);
+  xmax -= uInt(getEqualSuffixLength ( line + xmin, line_old + xmin
+                                    , length - prefix ));
+
+  for (auto x{xmin + 1}; x < xmax; x++)
+  {
+    if ( isSameFChar(line[x], line_old[x]) )
+      line[x].attr.bit.no_changes = true;
+  }
+}
+
+//----------------------------------------------------------------------
+auto FVTerm::findTerminalLineShift (uInt ymin, uInt ymax) -> FLineShift
+{
+  // Searches the lines ymin to ymax for content that has moved
+  // vertically since the last terminal update. The terminal can
+  // scroll these lines instead of printing them again.
+
+  static const auto& init_object = getGlobalFVTermInstance();
+  static const auto& vterm = init_object->vterm;
+  static const auto& vterm_old = init_object->vterm_old;
+  static std::vector<uInt64> line_hash{};
+  static std::vector<uInt64> old_line_hash{};
+  static std::vector<uInt> votes{};
+  FLineShift shift{0, 0, 0, 0};
+
+  if ( ymax < ymin || ymax - ymin + 1 < MIN_LINE_SHIFT_HEIGHT )
+    return shift;
+
+  const auto height = std::size_t(ymax - ymin + 1);
+  const auto width = std::size_t(vterm->size.width);
+  line_hash.resize(height);
+  old_line_hash.resize(height);
+
+  for (std::size_t i{0}; i < height; i++)
+  {
+    const auto y = int(ymin + i);
+    line_hash[i] = internal::getLineHash(&vterm->getFChar(0, y), width);
+    old_line_hash[i] = internal::getLineHash(&vterm_old->getFChar(0, y), width);
+  }
+
+  // Each changed line votes for the distance to its old position
+  votes.assign(2 * height - 1, 0);
 
-  while ( xmin < xmax && *first == *first_old )
+  for (std::size_t i{0}; i < height; i++)
   {
-    xmin++;
-    first++;
-    first_old++;
+    if ( line_hash[i] == old_line_hash[i] )
+      continue;
+
+    for (std::size_t j{0}; j < height; j++)
+    {
+      if ( old_line_hash[j] == line_hash[i] )
+        votes[height - 1 + j - i]++;
+    }
   }
 
-  while ( last >= first && *last == *last_old )
+  int count{0};
+  uInt max_votes{1};  // A single moved line is not worth scrolling
+
+  for (auto distance{1}; distance < int(height); distance++)
   {
-    xmax--;
-    last--;
-    last_old--;
+    for (const auto n : {distance, -distance})
+    {
+      const auto v = votes[std::size_t(int(height) - 1 + n)];
+
+      if ( v > max_votes )
+      {
+        max_votes = v;
+        count = n;
+      }
+    }
   }
 
-  while ( last > first )
+  if ( count == 0 )
+    return shift;
+
+  // Find the band in which scrolling saves the most output
+  const auto first = count > 0 ? int(ymin) : int(ymin) - count;
+  const auto last = count > 0 ? int(ymax) - count : int(ymax);
+  int sum{0};
+  int max_sum{0};
+  int start{first};
+  int band_start{first};
+  int band_end{first};
+
+  for (auto y{first}; y <= last; y++)
   {
-    if ( *last == *last_old )
-      last->attr.bit.no_changes = true;
+    const auto* line = &vterm->getFChar(0, y);
+    const auto moved = internal::getLineUpdateCost(line, &vterm_old->getFChar(0, y + count), width);
+    const auto kept = internal::getLineUpdateCost(line, &vterm_old->getFChar(0, y), width);
 
-    last--;
-    last_old--;
+    if ( sum <= 0 )
+    {
+      sum = 0;
+      start = y;
+    }
+
+    sum += int(kept) - int(moved);
+
+    if ( sum > max_sum )
+    {
+      max_sum = sum;
+      band_start = start;
+      band_end = y;
+    }
+  }
+
+  // The lines scrolled in must be printed completely
+  const auto new_lines = count > 0 ? band_end + 1 : band_start + count;
+
+  for (auto y{new_lines}; y < new_lines + std::abs(count); y++)
+  {
+    const auto* line = &vterm->getFChar(0, y);
+    max_sum -= int(internal::getLineUpdateCost(line, nullptr, width))
+             - int(internal::getLineUpdateCost(line, &vterm_old->getFChar(0, y), width));
   }
+
+  if ( max_sum <= 0 )
+    return shift;
+
+  shift.top = uInt(count > 0 ? band_start : band_start + count);
+  shift.bottom = uInt(count > 0 ? band_end + count : band_end);
+  shift.count = count;
+  shift.saved_output = uInt(max_sum);
+  return shift;
+}
+
+//----------------------------------------------------------------------
+void FVTerm::shiftTerminalLines (const FLineShift& shift)
+{
+  // The terminal has scrolled the lines from top to bottom. The saved
+  // terminal content follows, and the lines scrolled in are unknown.
+
+  static const auto& init_object = getGlobalFVTermInstance();
+  static const auto& vterm = init_object->vterm;
+  static const auto& vterm_old = init_object->vterm_old;
+
+  if ( shift.count == 0 )
+    return;
+
+  const auto top = int(shift.top);
+  const auto bottom = int(shift.bottom);
+  const auto count = std::abs(shift.count);
+  auto& offsets = vterm_old->line_offset;
+  const auto first = offsets.begin() + top;
+  const auto last = offsets.begin() + bottom + 1;
+
+  if ( shift.count > 0 )
+    std::rotate (first, first + count, last);
+  else
+    std::rotate (first, last - count, last);
+
+  const FChar unknown_char
+  {
+    { { L' ',  L'\0', L'\0', L'\0', L'\0' } },
+    FColor::Undefined,
+    FColor::Undefined,
+    { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3 (byte 2 = 0x08 = char_width 1)
+  };
+
+  const auto new_lines = shift.count > 0 ? bottom - count + 1 : top;
+
+  for (auto y{new_lines}; y < new_lines + count; y++)
+  {
+    auto& oc = vterm_old->getFChar(0, y);  // old character
+    std::fill (&oc, &oc + vterm_old->size.width, unknown_char);
+  }
+
+  // Compare all lines of the scroll region again
+  for (auto y{top}; y <= bottom; y++)
+  {
+    auto& vterm_changes = vterm->changes[unsigned(y)];
+    vterm_changes.xmin = 0;
+    vterm_changes.xmax = uInt(vterm->size.width - 1);
+  }
+
+  vterm->addChangedLines (top, bottom);
 }
 
 //----------------------------------------------------------------------
@@ -553,6 +828,8 @@ void FVTerm::resizeArea ( const FRect& box
   if ( ! area )
     return;
 
+  invalidateOcclusionMap();
+
   if ( width == area->size.width
     && height == area->size.height
     && rsw == area->shadow.width
@@ -616,6 +893,7 @@ void FVTerm::restoreVTerm (const FRect& box) const noexcept
 
   const auto vterm_size = FSize{ std::size_t(vterm->size.width)
                                , std::size_t(vterm->size.height) };
+  checkOcclusionMap();
 
   if ( vdesktop && vdesktop->reprint(box, vterm_size) )
     addLayer(vdesktop.get());
@@ -703,6 +981,9 @@ void FVTerm::getArea (const FPoint& pos, FTermArea* area) const noexcept
     line_changes.xmin = 0;
     line_changes.xmax = uInt(length - 1);
   }
+
+  if ( y_end > 0 )
+    area->addChangedLines (0, y_end - 1);
 }
 
 //----------------------------------------------------------------------
@@ -740,6 +1021,9 @@ void FVTerm::getArea (const FRect& box, FTermArea* area) const noexcept
     line_changes.xmin = std::min(line_changes.xmin, uInt(dx));
     line_changes.xmax = std::max(line_changes.xmax, uInt(dx + length - 1));
   }
+
+  if ( y_end > 0 )
+    area->addChangedLines (dy, dy + y_end - 1);
 }
 
 //----------------------------------------------------------------------
@@ -760,40 +1044,63 @@ void FVTerm::addLayer (FTermArea* area) const noexcept
   // Call the preprocessing handler methods (child area change handling)
   callPreprocessingHandler(area);
 
-  for (auto y{0}; y < y_end; y++)  // Line loop
+  // Only the damaged lines of the area need to be visited.
+  // Changes without a damaged line range (e.g. written directly
+  // into area->changes) fall back to a scan of all lines.
+  const auto damaged = area->changed_lines;
+  const bool has_damage = area->hasChangedLines();
+  const bool full_scan = ! has_damage && area->has_changes;
+  const int y_start = has_damage ? int(damaged.ymin) : 0;
+  const int y_stop = has_damage ? std::min(int(damaged.ymax), y_end - 1)
+                                : ( full_scan ? y_end - 1 : -1 );
+  area->resetChangedLines();
+
+  if ( has_damage && int(damaged.ymax) > y_stop )  // Keep lines below the terminal
+    area->addChangedLines (std::max(y_start, y_stop + 1), int(damaged.ymax));
+
+  const auto& occlusion = getOcclusionMap();
+  const int layer = getOcclusionLayer(area);
+
+  for (auto y{y_start}; y <= y_stop; y++)  // Line loop
   {
     auto& line_changes = area->changes[unsigned(y)];
     auto line_xmin = int(line_changes.xmin);
     auto line_xmax = int(line_changes.xmax);
-    line_xmin = std::max(line_xmin, ol);
-    line_xmax = std::min(line_xmax, vterm->size.width + ol - ax - 1);
 
     if ( line_xmin > line_xmax )
       continue;
 
-    const std::size_t length = unsigned(line_xmax - line_xmin + 1);
+    line_xmin = std::max(line_xmin, ol);
+    line_xmax = std::min(line_xmax, vterm->size.width + ol - ax - 1);
     const int tx = ax - ol;  // Global terminal positions for x
     const int ty = ay + y;  // Global terminal positions for y
 
-    if ( ax + line_xmin >= vterm->size.width || tx + line_xmin + ol < 0 || ty < 0 )
+    if ( line_xmin > line_xmax
+      || ax + line_xmin >= vterm->size.width || tx + line_xmin + ol < 0 || ty < 0 )
+    {
+      // Keep the changes of the invisible line part
+      area->addChangedLine (y);
       continue;
+    }
+
+    const std::size_t length = unsigned(line_xmax - line_xmin + 1);
 
     // Area character
     const auto& ac = area->getFChar(line_xmin, y);
 
     // Terminal character
     auto& tc = vterm->getFChar(tx + line_xmin, ty);
+    const bool has_transparency = line_changes.trans_count > 0;
 
-    if ( line_changes.trans_count > 0 )
+    if ( layer >= 0 && occlusion.getLineTopLayer(ty, ty) > layer )
     {
-      // Line with hidden and transparent characters
-      addAreaLineWithTransparency (&ac, &tc, length);
+      // Line is partially covered by upper windows
+      const FPoint pos{tx + line_xmin, ty};
+      addUncoveredAreaLine ( occlusion, &ac, &tc, length
+                           , pos, layer, has_transparency );
     }
     else
-    {
-      // Line has only covered characters
-      putAreaLine (ac, tc, length);
-    }
+      addAreaLine (&ac, &tc, length, has_transparency);
 
     int new_xmin = ax + line_xmin - ol;
     int new_xmax = ax + line_xmax;
@@ -801,6 +1108,7 @@ void FVTerm::addLayer (FTermArea* area) const noexcept
     vterm_changes.xmin = std::min(vterm_changes.xmin, uInt(new_xmin));
     new_xmax = std::min(new_xmax, vterm->size.width - 1);
     vterm_changes.xmax = std::max (vterm_changes.xmax, uInt(new_xmax));
+    vterm->addChangedLine (ty);
     line_changes.xmin = uInt(width);
     line_changes.xmax = 0;
   }
@@ -868,6 +1176,9 @@ void FVTerm::copyArea (FTermArea* dst, const FPoint& pos, const FTermArea* const
     dst_changes.xmax = std::max(uInt(ax + length - 1), dst_changes.xmax);
   }
 
+  if ( y_end > 0 )
+    dst->addChangedLines (ay, ay + y_end - 1);
+
   dst->has_changes = true;
 }
 
@@ -890,12 +1201,25 @@ void FVTerm::determineWindowLayers() noexcept
     (*iter)->getPrintArea()->layer = int(std::distance(begin, iter) + 1);
     ++iter;
   }
+
+  invalidateOcclusionMap();
+}
+
+//----------------------------------------------------------------------
+void FVTerm::invalidateOcclusionMap() noexcept
+{
+  // The window stacking order or a window geometry has changed
+
+  static const auto& init_object = getGlobalFVTermInstance();
+
+  if ( init_object && init_object->occlusion_map )
+    init_object->occlusion_map->valid = false;
 }
 
 //----------------------------------------------------------------------
 void FVTerm::scrollAreaForward (FTermArea* area)
 {
-  // Scrolls the entire area on line up
+  // Scrolls the entire area one line up
 
   if ( ! area || area->size.height <= 1 )
     return;
@@ -903,28 +1227,34 @@ void FVTerm::scrollAreaForward (FTermArea* area)
   const int y_max = area->size.height - 1;
   const int x_max = area->size.width - 1;
 
+  // The right shadow stays in place
+  if ( area->shadow.width > 0 )
+    for (auto y = y_max; y > 0; y--)
+      swapRightShadow (area, y, y - 1);
+
+  // Rotate the line order instead of moving the character data
+  const auto height = std::ptrdiff_t(area->size.height);
+  auto& offsets = area->line_offset;
+  std::rotate (offsets.begin(), offsets.begin() + 1, offsets.begin() + height);
+  auto& changes = area->changes;
+  std::rotate (changes.begin(), changes.begin() + 1, changes.begin() + height);
+
   for (auto y{0}; y < y_max; y++)
   {
-    auto& dc = area->getFChar(0, y);  // destination character
-    const auto& sc = area->getFChar(0, y + 1);  // source character
-    putAreaLine (sc, dc, unsigned(area->size.width));
     auto& line_changes = area->changes[unsigned(y)];
     line_changes.xmin = 0;
     line_changes.xmax = uInt(x_max);
   }
 
   // insert a new line below
-  const auto& lc = area->getFChar(x_max, area->size.height - 2);  // last character
+  const auto& lc = area->getFChar(x_max, y_max - 1);  // last character
   nc.fg_color = lc.fg_color;
   nc.bg_color = lc.bg_color;
   nc.attr  = lc.attr;
   nc.ch[0] = L' ';
   nc.ch[1] = L'\0';
-  auto& dc = area->getFChar(0, y_max);  // destination character
-  std::fill (&dc, &dc + area->size.width, nc);
-  auto& new_line_changes = area->changes[unsigned(y_max)];
-  new_line_changes.xmin = 0;
-  new_line_changes.xmax = uInt(x_max);
+  fillScrolledLine (area, y_max, nc);
+  area->addChangedLines (0, y_max);
   area->has_changes = true;
 
   if ( area == vdesktop.get() )
@@ -942,11 +1272,20 @@ void FVTerm::scrollAreaReverse (FTermArea* area)
   const int y_max = area->size.height - 1;
   const int x_max = area->size.width - 1;
 
-  for (auto y = y_max; y > 0; y--)
+  // The right shadow stays in place
+  if ( area->shadow.width > 0 )
+    for (auto y{0}; y < y_max; y++)
+      swapRightShadow (area, y, y + 1);
+
+  // Rotate the line order instead of moving the character data
+  const auto height = std::ptrdiff_t(area->size.height);
+  auto& offsets = area->line_offset;
+  std::rotate (offsets.begin(), offsets.begin() + height - 1, offsets.begin() + height);
+  auto& changes = area->changes;
+  std::rotate (changes.begin(), changes.begin() + height - 1, changes.begin() + height);
+
+  for (auto y{1}; y <= y_max; y++)
   {
-    auto& dc = area->getFChar(0, y);  // destination character
-    const auto& sc = area->getFChar(0, y - 1);  // source character
-    putAreaLine (sc, dc, unsigned(area->size.width));
     auto& line_changes = area->changes[unsigned(y)];
     line_changes.xmin = 0;
     line_changes.xmax = uInt(x_max);
@@ -959,11 +1298,8 @@ void FVTerm::scrollAreaReverse (FTermArea* area)
   nc.attr  = lc.attr;
   nc.ch[0] = L' ';
   nc.ch[1] = L'\0';
-  auto& dc = area->getFChar(0, 0);  // destination character
-  std::fill (&dc, &dc + area->size.width, nc);
-  auto& new_line_changes = area->changes[unsigned(y_max)];
-  new_line_changes.xmin = 0;
-  new_line_changes.xmax = uInt(x_max);
+  fillScrolledLine (area, 0, nc);
+  area->addChangedLines (0, y_max);
   area->has_changes = true;
 
   if ( area == vdesktop.get() )
@@ -1024,6 +1360,7 @@ void FVTerm::clearArea (FTermArea* area, wchar_t fillchar) noexcept
     line_changes.trans_count = width;
   }
 
+  area->addChangedLines (0, area->size.height + area->shadow.height - 1);
   area->has_changes = true;
 }
 
@@ -1128,7 +1465,6 @@ inline void FVTerm::resetTextAreaToDefault ( FTermArea* area
   FChar default_char
   {
     { { L' ',  L'\0', L'\0', L'\0', L'\0' } },
-    { { L'\0', L'\0', L'\0', L'\0', L'\0' } },
     FColor::Default,
     FColor::Default,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3 (byte 2 = 0x08 = char_width 1)
@@ -1137,6 +1473,17 @@ inline void FVTerm::resetTextAreaToDefault ( FTermArea* area
 
   FLineChanges unchanged { uInt(size.getWidth()), 0, 0 };
   std::fill (area->changes.begin(), area->changes.end(), unchanged);
+  area->resetChangedLines();
+
+  // Lines are stored one after the other until the area is scrolled
+  area->line_offset.resize(size.getHeight());
+  std::size_t offset{0};
+
+  for (auto& line_offset : area->line_offset)
+  {
+    line_offset = offset;
+    offset += size.getWidth();
+  }
 }
 
 //----------------------------------------------------------------------
@@ -1168,39 +1515,211 @@ auto FVTerm::isCovered (const FPoint& pos, const FTermArea* area) const noexcept
 
   const auto& win_list = getWindowList();
   auto is_covered = CoveredState::None;
-  bool found{ area == vdesktop.get() };
 
   if ( ! area || ! win_list || win_list->empty()
     || win_list->back()->getVWin() == area )
     return CoveredState::None;
 
-  for (const auto& win_obj : *win_list)
+  // Only the windows between the area and the topmost window
+  // at this position can cover the character
+  const auto start = ( area == vdesktop.get() ) ? 0 : getOverlayStartIndex(area);
+  auto end = win_list->size();
+  const auto& occlusion = getOcclusionMap();
+
+  if ( occlusion.contains(pos.getX(), pos.getY()) )
+    end = std::min(end, std::size_t(occlusion.getTopLayer(pos.getX(), pos.getY())));
+
+  for (auto i{start}; i < end; i++)
   {
-    const auto& win = win_obj->getVWin();
+    const auto& win = (*win_list)[i]->getVWin();
 
-    if ( ! (win && win->visible) )
+    if ( ! (win && win->visible && win->contains(pos)) )
       continue;
 
-    if ( found && win->contains(pos) )  // is covered
+    const auto& tmp = win->getFChar( pos.getX() - win->position.x
+                                   , pos.getY() - win->position.y );
+
+    if ( tmp.attr.bit.color_overlay )
     {
-      const auto& tmp = win->getFChar( pos.getX() - win->position.x
-                                     , pos.getY() - win->position.y );
+      is_covered = CoveredState::Half;
+    }
+    else if ( ! tmp.attr.bit.transparent )
+    {
+      return CoveredState::Full;
+    }
+  }
 
-      if ( tmp.attr.bit.color_overlay )
-      {
-        is_covered = CoveredState::Half;
-      }
-      else if ( ! tmp.attr.bit.transparent )
-      {
-        return CoveredState::Full;
-      }
+  return is_covered;
+}
+
+//----------------------------------------------------------------------
+auto FVTerm::getOcclusionMap() const -> const FOcclusionMap&
+{
+  // Returns the occlusion map and rebuilds it after it was
+  // invalidated by a change of the window stacking order
+  // or the window geometry
+
+  auto& occlusion = *occlusion_map;
+  const auto& win_list = getWindowList();
+  const auto count = win_list ? win_list->size() : 0;
+
+  if ( occlusion.valid
+    && occlusion.width == vterm->size.width
+    && occlusion.height == vterm->size.height
+    && occlusion.windows.size() == count )
+    return occlusion;
+
+  const int width = vterm->size.width;
+  const int height = vterm->size.height;
+  occlusion.width = width;
+  occlusion.height = height;
+  occlusion.top_layer.assign(std::size_t(width) * std::size_t(height), 0);
+  occlusion.line_top_layer.assign(std::size_t(height), 0);
+  occlusion.windows.clear();
+  occlusion.valid = true;
+
+  if ( ! win_list )
+    return occlusion;
+
+  for (const auto& win_obj : *win_list)  // List from bottom to top
+  {
+    const auto geometry = getWindowGeometry(win_obj->getVWin());
+    occlusion.windows.push_back(geometry);
+    const int x_start = std::max(0, geometry.x);
+    const int x_end = std::min(width, geometry.x + geometry.width);
+    const int y_start = std::max(0, geometry.y);
+    const int y_end = std::min(height, geometry.y + geometry.height);
+
+    if ( geometry.layer < 1 || x_start >= x_end )
+      continue;
+
+    for (auto y{y_start}; y < y_end; y++)  // Line loop
+    {
+      auto line = occlusion.top_layer.begin() + std::ptrdiff_t(y) * width;
+      std::fill (line + x_start, line + x_end, geometry.layer);
+      auto& line_top_layer = occlusion.line_top_layer[unsigned(y)];
+      line_top_layer = std::max(line_top_layer, geometry.layer);
     }
+  }
+
+  return occlusion;
+}
+
+//----------------------------------------------------------------------
+void FVTerm::checkOcclusionMap() const noexcept
+{
+  // Window areas can also be changed directly without an
+  // invalidation, so the map is checked once per update pass
+
+  if ( occlusion_map->valid && ! isOcclusionMapValid() )
+    occlusion_map->valid = false;
+}
+
+//----------------------------------------------------------------------
+auto FVTerm::isOcclusionMapValid() const noexcept -> bool
+{
+  // Compares the map geometry with the current window geometry
+  // to detect direct changes to the window areas
+
+  const auto& occlusion = *occlusion_map;
+  const auto& win_list = getWindowList();
+  const auto count = win_list ? win_list->size() : 0;
+
+  if ( ! occlusion.valid
+    || occlusion.width != vterm->size.width
+    || occlusion.height != vterm->size.height
+    || occlusion.windows.size() != count )
+    return false;
 
-    if ( area == win )
-      found = true;
+  for (std::size_t i{0}; i < count; i++)
+  {
+    const auto& old_geometry = occlusion.windows[i];
+    const auto geometry = getWindowGeometry((*win_list)[i]->getVWin());
+
+    if ( geometry.area != old_geometry.area
+      || geometry.x != old_geometry.x
+      || geometry.y != old_geometry.y
+      || geometry.width != old_geometry.width
+      || geometry.height != old_geometry.height
+      || geometry.layer != old_geometry.layer )
+      return false;
   }
 
-  return is_covered;
+  return true;
+}
+
+//----------------------------------------------------------------------
+auto FVTerm::getWindowGeometry (const FTermArea* win) const noexcept -> FWindowGeometry
+{
+  // Returns the terminal rectangle and the layer of a visible window
+
+  if ( ! (win && win->visible && win->layer > 0) )
+    return { win, 0, 0, 0, 0, 0 };
+
+  const int win_height = win->minimized ? win->min_size.height : getFullAreaHeight(win);
+  return { win, win->position.x, win->position.y
+         , getFullAreaWidth(win), win_height, win->layer };
+}
+
+//----------------------------------------------------------------------
+auto FVTerm::getOverlayStartIndex (const FTermArea* area) const noexcept -> std::size_t
+{
+  // Returns the window list index of the first window above the area
+  // (or the list size if the area is not in the window list)
+
+  const auto& win_list = getWindowList();
+  const auto size = win_list->size();
+  const auto layer = std::size_t(std::max(0, area->layer));
+
+  if ( layer > 0 && layer <= size && (*win_list)[layer - 1]->getVWin() == area )
+    return layer;
+
+  const auto iter = std::find_if ( win_list->cbegin(), win_list->cend()
+                                 , [&area] (const FVTerm* win_obj)
+                                   {
+                                     return win_obj->getVWin() == area;
+                                   } );
+
+  if ( iter == win_list->cend() )
+    return size;
+
+  return std::size_t(std::distance(win_list->cbegin(), iter)) + 1;
+}
+
+//----------------------------------------------------------------------
+auto FVTerm::getOcclusionLayer (const FTermArea* area) const noexcept -> int
+{
+  // Returns the layer of the area in the occlusion map
+  // or -1 if the area is not part of the window stack
+
+  const auto& win_list = getWindowList();
+
+  if ( area == vdesktop.get() )
+    return 0;
+
+  if ( ! win_list || area->layer < 1 || std::size_t(area->layer) > win_list->size()
+    || (*win_list)[std::size_t(area->layer) - 1]->getVWin() != area )
+    return -1;
+
+  return area->layer;
+}
+
+//----------------------------------------------------------------------
+inline auto FVTerm::isHiddenByUpperLayer ( const FOcclusionMap& occlusion
+                                         , int x, int y
+                                         , int layer ) const noexcept -> bool
+{
+  // Is the terminal character at (x, y) hidden by an opaque
+  // character of a window above the given layer?
+
+  const auto top_layer = occlusion.getTopLayer(x, y);
+
+  if ( top_layer <= layer )
+    return false;
+
+  const auto& win = (*window_list)[std::size_t(top_layer) - 1]->getVWin();
+  const auto& ch = win->getFChar(x - win->position.x, y - win->position.y);
+  return (ch.attr.byte[1] & internal::var::b1_transparent_mask) == 0;
 }
 
 //----------------------------------------------------------------------
@@ -1219,25 +1738,31 @@ constexpr auto FVTerm::getFullAreaHeight (const FTermArea* area) const noexcept
 void FVTerm::passChangesToOverlap (const FTermArea* area) const
 {
   const auto& win_list = getWindowList();
-  bool found{false};
 
   if ( ! area || ! win_list || win_list->empty() )
     return;
 
-  for (auto&& win_obj : *win_list)
+  const int area_height = area->minimized ? area->min_size.height : getFullAreaHeight(area);
+  const int area_y2 = area->position.y + area_height - 1;
+
+  // Windows above the highest layer in the area lines cannot overlap
+  const auto start = getOverlayStartIndex(area);
+  const auto& occlusion = getOcclusionMap();
+  const auto top_layer = occlusion.getLineTopLayer(area->position.y, area_y2);
+  const auto end = std::min(win_list->size(), std::size_t(top_layer));
+
+  for (auto i{start}; i < end; i++)
   {
-    const auto& win = win_obj->getVWin();
+    const auto& win = (*win_list)[i]->getVWin();
 
-    if ( found && win && win->visible && win->isOverlapped(area) )
+    if ( win && win->visible && win->isOverlapped(area) )
     {
       // Pass the changes to the overlapping window
 
       win->has_changes = true;
       const int win_position_y = win->position.y;
       const int y_start = std::max(0, std::max(area->position.y, win_position_y)) - win_position_y;
-      const int area_height = area->minimized ? area->min_size.height : getFullAreaHeight(area);
       const int win_height = win->minimized ? win->min_size.height : getFullAreaHeight(win);
-      const int area_y2 = area->position.y + area_height - 1;
       const int win_y2 = win_position_y + win_height - 1;
       const int y_end = std::min(vterm->size.height - 1, std::min(area_y2, win_y2)) - win_position_y;
 
@@ -1252,10 +1777,10 @@ void FVTerm::passChangesToOverlap (const FTermArea* area) const
         line_changes.xmin = uInt(std::min(int(line_changes.xmin), x_start));
         line_changes.xmax = uInt(std::max(int(line_changes.xmax), x_end));
       }
-    }
 
-    if ( win == area )
-      found = true;
+      if ( y_start <= y_end )
+        win->addChangedLines (y_start, y_end);
+    }
   }
 }
 
@@ -1266,19 +1791,23 @@ void FVTerm::restoreOverlaidWindows (const FTermArea* area) const noexcept
 
   const auto& win_list = getWindowList();
 
-  if ( ! win_list || win_list->empty() )
+  if ( ! area || ! getVWin() || ! win_list || win_list->empty() )
     return;
 
-  bool overlaid{false};
+  // Windows above the highest layer in the area lines cannot overlap
+  const int area_height = area->minimized ? area->min_size.height : getFullAreaHeight(area);
+  const int area_y2 = area->position.y + area_height - 1;
+  const auto start = getOverlayStartIndex(getVWin());
+  const auto& occlusion = getOcclusionMap();
+  const auto top_layer = occlusion.getLineTopLayer(area->position.y, area_y2);
+  const auto end = std::min(win_list->size(), std::size_t(top_layer));
 
-  for (auto&& win_obj : *win_list)
+  for (auto i{start}; i < end; i++)
   {
-    const auto& win = win_obj->getVWin();
+    const auto& win = (*win_list)[i]->getVWin();
 
-    if ( overlaid && win && win->visible && win->isOverlapped(area) )
+    if ( win && win->visible && win->isOverlapped(area) )
       copyArea (vterm.get(), FPoint{win->position.x + 1, win->position.y + 1}, win);
-    else if ( getVWin() == win )
-      overlaid = true;
   }
 }
 
@@ -1296,6 +1825,8 @@ void FVTerm::updateVTerm() const
   if ( ! window_list || window_list->empty() )
     return;
 
+  checkOcclusionMap();
+
   for (auto&& window : *window_list)  // List from bottom to top
   {
     auto v_win = window->getVWin();
@@ -1318,6 +1849,55 @@ void FVTerm::updateVTerm() const
   }
 }
 
+//----------------------------------------------------------------------
+void FVTerm::swapRightShadow (FTermArea* area, int y1, int y2) const noexcept
+{
+  // Exchanges the right shadow of two lines together with
+  // their number of transparent characters
+
+  const auto shadow_width = std::size_t(area->shadow.width);
+  auto* shadow1 = &area->getFChar(area->size.width, y1);
+  auto* shadow2 = &area->getFChar(area->size.width, y2);
+  const auto count1 = getTransparentCount(shadow1, shadow_width);
+  const auto count2 = getTransparentCount(shadow2, shadow_width);
+  std::swap_ranges (shadow1, shadow1 + shadow_width, shadow2);
+  auto& line_changes1 = area->changes[unsigned(y1)];
+  auto& line_changes2 = area->changes[unsigned(y2)];
+  line_changes1.trans_count = line_changes1.trans_count - count1 + count2;
+  line_changes2.trans_count = line_changes2.trans_count - count2 + count1;
+}
+
+//----------------------------------------------------------------------
+void FVTerm::fillScrolledLine ( FTermArea* area, int y
+                              , const FChar& fillchar ) const noexcept
+{
+  // Fills the line that was scrolled into the area
+
+  auto& dc = area->getFChar(0, y);  // destination character
+  std::fill (&dc, &dc + area->size.width, fillchar);
+  auto& line_changes = area->changes[unsigned(y)];
+  line_changes.xmin = 0;
+  line_changes.xmax = uInt(area->size.width - 1);
+  line_changes.trans_count = getTransparentCount(&dc, 1) * uInt(area->size.width);
+
+  if ( area->shadow.width > 0 )
+  {
+    const auto* shadow = &dc + area->size.width;
+    line_changes.trans_count += getTransparentCount(shadow, std::size_t(area->shadow.width));
+  }
+}
+
+//----------------------------------------------------------------------
+inline auto FVTerm::getTransparentCount ( const FChar* fchar
+                                        , std::size_t length ) const noexcept -> uInt
+{
+  return uInt(std::count_if ( fchar, fchar + length
+                            , [] (const FChar& ch)
+                              {
+                                return (ch.attr.byte[1] & b1_print_trans_mask) != 0;
+                              } ));
+}
+
 //----------------------------------------------------------------------
 inline void FVTerm::scrollTerminalForward() const
 {
@@ -1485,6 +2065,7 @@ inline void FVTerm::saveCurrentVTerm() const
 {
   // Save the content of the virtual terminal
   std::memcpy(vterm_old->data.data(), vterm->data.data(), vterm->data.size() * sizeof(FChar));
+  vterm_old->line_offset = vterm->line_offset;
 }
 
 
@@ -1568,6 +2149,51 @@ inline void FVTerm::putTransparentAreaLine ( const FPoint& pos
   restoreVTerm(box);
 }
 
+//----------------------------------------------------------------------
+inline void FVTerm::addAreaLine ( const FChar* src_char
+                                , FChar* dst_char
+                                , const std::size_t length
+                                , bool has_transparency ) const
+{
+  if ( has_transparency )
+  {
+    // Line with hidden and transparent characters
+    addAreaLineWithTransparency (src_char, dst_char, length);
+  }
+  else
+  {
+    // Line has only covered characters
+    putAreaLine (*src_char, *dst_char, length);
+  }
+}
+
+//----------------------------------------------------------------------
+void FVTerm::addUncoveredAreaLine ( const FOcclusionMap& occlusion
+                                  , const FChar* src_char
+                                  , FChar* dst_char
+                                  , const std::size_t length
+                                  , const FPoint& pos
+                                  , int layer
+                                  , bool has_transparency ) const
+{
+  // Adds only the characters that are not hidden by upper windows
+
+  const int x = pos.getX();
+  const int y = pos.getY();
+  std::size_t start{0};
+
+  for (std::size_t i{0}; i <= length; i++)  // Column loop
+  {
+    if ( i < length && ! isHiddenByUpperLayer(occlusion, x + int(i), y, layer) )
+      continue;
+
+    if ( i > start )
+      addAreaLine (src_char + start, dst_char + start, i - start, has_transparency);
+
+    start = i + 1;
+  }
+}
+
 //----------------------------------------------------------------------
 inline void FVTerm::addAreaLineWithTransparency ( const FChar* src_char
                                                 , FChar* dst_char
@@ -1701,6 +2327,7 @@ auto FVTerm::clearFullArea (FTermArea* area, FChar& fillchar) const -> bool
       vdesktop_changes.trans_count = 0;
     }
 
+    vdesktop->addChangedLines (0, vdesktop->size.height - 1);
     vdesktop->has_changes = true;
   }
 
@@ -1832,6 +2459,8 @@ inline auto FVTerm::printCharacterOnCoordinate ( FTermArea* area
   if ( uInt(ax) + padding > line_changes.xmax )
     line_changes.xmax = uInt(ax) + padding;
 
+  area->addChangedLine (ay);
+
   return ac->attr.bit.char_width;
 }
 
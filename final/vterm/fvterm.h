@@ -50,6 +50,7 @@
 #include <sys/time.h>  // need for timeval (cygwin)
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -106,6 +107,20 @@ class FVTerm : public FVTermAttribute
       uInt trans_count;    // Number of transparent characters
     };
 
+    struct FLineRange
+    {
+      uInt ymin;           // Y-position of the first changed line
+      uInt ymax;           // Y-position of the last changed line
+    };
+
+    struct FLineShift
+    {
+      uInt top;            // First line of the scroll region
+      uInt bottom;         // Last line of the scroll region
+      int  count;          // Scrolled lines (> 0 up, < 0 down)
+      uInt saved_output;   // Estimated output length saved
+    };
+
     // Using-declarations
     using FVTermAttribute::print;
     using FCharVector = std::vector<FChar>;
@@ -193,6 +208,7 @@ class FVTerm : public FVTermAttribute
     static auto  isTerminalUpdateForced() noexcept -> bool;
     static auto  areTerminalUpdatesPaused() noexcept -> bool;
     static auto  hasPendingTerminalUpdates() noexcept -> bool;
+    static auto  hasPendingAreaUpdates() -> bool;
 
     // Methods
     virtual void clearArea (wchar_t = L' ');
@@ -202,6 +218,8 @@ class FVTerm : public FVTermAttribute
     void  putVTerm() const;
     auto  updateTerminal() const -> bool;
     static void reduceTerminalLineUpdates (uInt);
+    static auto findTerminalLineShift (uInt, uInt) -> FLineShift;
+    static void shiftTerminalLines (const FLineShift&);
     virtual void addPreprocessingHandler ( const FVTerm*
                                          , FPreprocessingFunction&& );
     virtual void delPreprocessingHandler (const FVTerm*);
@@ -260,6 +278,7 @@ class FVTerm : public FVTermAttribute
     void  copyArea (FTermArea*, const FPoint&, const FTermArea* const)  const noexcept;
     static auto  getLayer (FVTerm&) noexcept -> int;
     static void  determineWindowLayers() noexcept;
+    static void  invalidateOcclusionMap() noexcept;
     void  scrollAreaForward (FTermArea*);
     void  scrollAreaReverse (FTermArea*);
     void  clearArea (FTermArea*, wchar_t = L' ') noexcept;
@@ -270,8 +289,12 @@ class FVTerm : public FVTermAttribute
     virtual void initTerminal();
 
   private:
+    struct FWindowGeometry;       // forward declaration
+    struct FOcclusionMap;         // forward declaration
+
     // Constants
     static constexpr int DEFAULT_MINIMIZED_HEIGHT = 1;
+    static constexpr uInt MIN_LINE_SHIFT_HEIGHT = 3;
 
     // Enumerations
     enum class CharacterType
@@ -289,11 +312,21 @@ class FVTerm : public FVTermAttribute
     auto  resizeTextArea (FTermArea*, std::size_t, std::size_t ) const -> bool;
     auto  resizeTextArea (FTermArea*, std::size_t) const -> bool;
     auto  isCovered (const FPoint&, const FTermArea*) const noexcept -> CoveredState;
+    auto  getOcclusionMap() const -> const FOcclusionMap&;
+    void  checkOcclusionMap() const noexcept;
+    auto  isOcclusionMapValid() const noexcept -> bool;
+    auto  getWindowGeometry (const FTermArea*) const noexcept -> FWindowGeometry;
+    auto  getOverlayStartIndex (const FTermArea*) const noexcept -> std::size_t;
+    auto  getOcclusionLayer (const FTermArea*) const noexcept -> int;
+    auto  isHiddenByUpperLayer (const FOcclusionMap&, int, int, int) const noexcept -> bool;
     constexpr auto  getFullAreaWidth (const FTermArea*) const noexcept -> int;
     constexpr auto  getFullAreaHeight (const FTermArea*) const noexcept -> int;
     void  passChangesToOverlap (const FTermArea*) const;
     void  restoreOverlaidWindows (const FTermArea* area) const noexcept;
     void  updateVTerm() const;
+    void  swapRightShadow (FTermArea*, int, int) const noexcept;
+    void  fillScrolledLine (FTermArea*, int, const FChar&) const noexcept;
+    auto  getTransparentCount (const FChar*, std::size_t) const noexcept -> uInt;
     void  scrollTerminalForward() const;
     void  scrollTerminalReverse() const;
     void  callPreprocessingHandler (const FTermArea*) const;
@@ -310,6 +343,9 @@ class FVTerm : public FVTermAttribute
     void  putAreaLine (const FChar&, FChar&, const std::size_t) const;
     void  putAreaLineWithTransparency (const FChar*, FChar*, const int, FPoint) const;
     void  putTransparentAreaLine (const FPoint&, const std::size_t) const;
+    void  addAreaLine (const FChar*, FChar*, const std::size_t, bool) const;
+    void  addUncoveredAreaLine ( const FOcclusionMap&, const FChar*, FChar*
+                               , const std::size_t, const FPoint&, int, bool ) const;
     void  addAreaLineWithTransparency (const FChar*, FChar*, const std::size_t) const;
     void  addTransparentAreaLine (const FChar&, FChar&, const std::size_t) const;
     void  addTransparentAreaChar (const FChar&, FChar&) const;
@@ -337,6 +373,7 @@ class FVTerm : public FVTermAttribute
     std::shared_ptr<FTermArea>   vterm{};                    // Virtual terminal
     std::shared_ptr<FTermArea>   vterm_old{};                // Last virtual terminal
     std::shared_ptr<FTermArea>   vdesktop{};                 // Virtual desktop
+    std::shared_ptr<FOcclusionMap> occlusion_map{};          // Topmost window per cell
     static FTermArea*            active_area;                // Active area
     static uInt8                 b1_print_trans_mask;        // Transparency mask
     static int                   tabstop;
@@ -359,6 +396,7 @@ struct FVTerm::FTermArea  // Define virtual terminal character properties
   // Using-declaration
   using FDataAccessPtr  = std::shared_ptr<FDataAccess>;
   using FLineChangesPtr = std::vector<FLineChanges>;
+  using FLineOffsets    = std::vector<std::size_t>;
   using FCharPtr        = std::vector<FChar>;
 
   // Constructor
@@ -398,12 +436,12 @@ struct FVTerm::FTermArea  // Define virtual terminal character properties
 
   inline auto getFChar (int x, int y) const noexcept -> const FChar&
   {
-    return data[unsigned(y) * unsigned(size.width + shadow.width) + unsigned(x)];
+    return data[line_offset[unsigned(y)] + unsigned(x)];
   }
 
   inline auto getFChar (int x, int y) noexcept -> FChar&
   {
-    return data[unsigned(y) * unsigned(size.width + shadow.width) + unsigned(x)];
+    return data[line_offset[unsigned(y)] + unsigned(x)];
   }
 
   inline auto getFChar (const FPoint& pos) const noexcept -> const FChar&
@@ -416,6 +454,29 @@ struct FVTerm::FTermArea  // Define virtual terminal character properties
     return getFChar(pos.getX(), pos.getY());
   }
 
+  inline auto hasChangedLines() const noexcept -> bool
+  {
+    return changed_lines.ymin <= changed_lines.ymax;
+  }
+
+  inline void addChangedLines (int first, int last) noexcept
+  {
+    // Extends the damaged line range by the lines first to last
+    changed_lines.ymin = std::min(changed_lines.ymin, uInt(first));
+    changed_lines.ymax = std::max(changed_lines.ymax, uInt(last));
+  }
+
+  inline void addChangedLine (int y) noexcept
+  {
+    addChangedLines (y, y);
+  }
+
+  inline void resetChangedLines() noexcept
+  {
+    changed_lines.ymin = NO_CHANGED_LINE;
+    changed_lines.ymax = 0;
+  }
+
   inline void setCursorPos (int x, int y) noexcept
   {
     cursor.x = x;
@@ -437,6 +498,9 @@ struct FVTerm::FTermArea  // Define virtual terminal character properties
     return -1;
   }
 
+  // Constants
+  static constexpr uInt NO_CHANGED_LINE = std::numeric_limits<uInt>::max();
+
   // Data members
   struct Coordinate
   {
@@ -465,6 +529,8 @@ struct FVTerm::FTermArea  // Define virtual terminal character properties
   FDataAccessPtr  owner{nullptr};        // Object that owns this FTermArea
   FPreprocVector  preproc_list{};
   FLineChangesPtr changes{};
+  FLineRange      changed_lines{NO_CHANGED_LINE, 0};  // Damaged lines
+  FLineOffsets    line_offset{};         // Data offset of each line
   FCharPtr        data{};                // FChar data of the drawing area
 };
 
@@ -559,6 +625,9 @@ inline auto FVTerm::FTermArea::reprint (const FRect& box, const FSize& term_size
     line_changes.xmax = uInt(std::max(int(line_changes.xmax), x_end));
   }
 
+  if ( y_start <= y_end )
+    addChangedLines (y_start, y_end);
+
   return true;
 }
 
@@ -593,6 +662,56 @@ struct FVTerm::FVTermPreprocessing
 };
 
 
+//----------------------------------------------------------------------
+// struct FVTerm::FWindowGeometry and FVTerm::FOcclusionMap
+//----------------------------------------------------------------------
+
+struct FVTerm::FWindowGeometry  // Terminal rectangle and layer of a window
+{
+  const FTermArea* area{nullptr};
+  int x{0};
+  int y{0};
+  int width{0};
+  int height{0};
+  int layer{0};
+};
+
+struct FVTerm::FOcclusionMap  // Topmost window layer for each terminal cell
+{
+  inline auto getTopLayer (int x, int y) const noexcept -> int
+  {
+    return top_layer[unsigned(y) * unsigned(width) + unsigned(x)];
+  }
+
+  inline auto getLineTopLayer (int y_start, int y_end) const noexcept -> int
+  {
+    // Returns the highest window layer in the lines y_start to y_end
+
+    y_start = std::max(y_start, 0);
+    y_end = std::min(y_end, height - 1);
+    int layer{0};
+
+    for (auto y{y_start}; y <= y_end; y++)
+      layer = std::max(layer, line_top_layer[unsigned(y)]);
+
+    return layer;
+  }
+
+  inline auto contains (int x, int y) const noexcept -> bool
+  {
+    return x >= 0 && x < width && y >= 0 && y < height;
+  }
+
+  // Data members
+  std::vector<int>             top_layer{};       // Layer of the topmost window (0 = desktop)
+  std::vector<int>             line_top_layer{};  // Highest window layer in each line
+  std::vector<FWindowGeometry> windows{};         // Window geometries of the map
+  int                          width{0};
+  int                          height{0};
+  bool                         valid{false};
+};
+
+
 // FVTerm inline functions
 //----------------------------------------------------------------------
 template <typename FOutputType>
@@ -833,6 +952,7 @@ inline void FVTerm::init()
     b1_print_trans_mask = getByte1PrintTransMask();
     foutput     = std::make_shared<FOutputType>(*this);
     window_list = std::make_shared<FVTermList>();
+    occlusion_map = std::make_shared<FOcclusionMap>();
     initSettings();
   }
   else
@@ -843,6 +963,7 @@ inline void FVTerm::init()
     vterm       = std::shared_ptr<FTermArea>(init_object->vterm);
     vterm_old   = std::shared_ptr<FTermArea>(init_object->vterm_old);
     vdesktop    = std::shared_ptr<FTermArea>(init_object->vdesktop);
+    occlusion_map = std::shared_ptr<FOcclusionMap>(init_object->occlusion_map);
   }
 }
 
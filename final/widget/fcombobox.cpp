@@ -405,10 +405,13 @@ void FComboBox::onMouseMove (FMouseEvent* ev)
 //----------------------------------------------------------------------
 void FComboBox::onWheel (FWheelEvent* ev)
 {
-  if ( ev->getWheel() == MouseWheel::Up )
-    onePosUp();
-  else if ( ev->getWheel() == MouseWheel::Down )
-    onePosDown();
+  for (auto i{0}; i < ev->getDelta(); i++)
+  {
+    if ( ev->getWheel() == MouseWheel::Up )
+      onePosUp();
+    else if ( ev->getWheel() == MouseWheel::Down )
+      onePosDown();
+  }
 }
 
 //----------------------------------------------------------------------
@@ -588,7 +591,8 @@ void FComboBox::processClick() const
 //----------------------------------------------------------------------
 void FComboBox::processRowChanged() const
 {
-  emitCallback("row-changed");
+  static const auto row_changed = FCallback::getSignalId("row-changed");
+  emitCallback(row_changed);
 }
 
 //----------------------------------------------------------------------
@@ -378,6 +378,33 @@ void FLineEdit::onKeyPress (FKeyEvent* ev)
   }
 }
 
+//----------------------------------------------------------------------
+void FLineEdit::onPaste (FPasteEvent* ev)
+{
+  if ( isReadOnly() )
+    return;
+
+  ev->accept();
+  auto input = pasteFilter(ev->getText());
+  const auto len = text.getLength();
+  const auto end_pos = ( insert_mode ) ? len : cursor_pos;
+  const auto free_space = ( max_length > end_pos ) ? max_length - end_pos : 0;
+
+  if ( input.getLength() > free_space )
+  {
+    FVTerm::getFOutput()->beep();
+    input = input.left(free_space);
+  }
+
+  if ( input.isEmpty() )
+    return;
+
+  // Insert the whole text at once
+  inputText(input);
+  drawInputField();
+  forceTerminalUpdate();
+}
+
 //----------------------------------------------------------------------
 void FLineEdit::onMouseDown (FMouseEvent* ev)
 {
@@ -1127,6 +1154,31 @@ inline auto FLineEdit::characterFilter (const wchar_t c) const -> wchar_t
   return L'\0';
 }
 
+//----------------------------------------------------------------------
+auto FLineEdit::pasteFilter (const FString& paste_text) const -> FString
+{
+  // Returns the first line of the pasted text without
+  // control characters and characters rejected by the input filter
+
+  std::wstring input{};
+  const auto has_filter = ! input_filter.empty();
+  const auto regex = has_filter ? std::wregex(input_filter) : std::wregex();
+
+  for (const auto& ch : paste_text)
+  {
+    if ( ch == L'\r' || ch == L'\n' )
+      break;
+
+    if ( ch < L' '
+      || (has_filter && ! std::regex_match(std::wstring(1, ch), regex)) )
+      continue;
+
+    input.push_back(ch);
+  }
+
+  return FString{std::move(input)};
+}
+
 //----------------------------------------------------------------------
 void FLineEdit::processActivate()
 {
@@ -1137,7 +1189,8 @@ void FLineEdit::processActivate()
 //----------------------------------------------------------------------
 void FLineEdit::processChanged() const
 {
-  emitCallback("changed");
+  static const auto changed = FCallback::getSignalId("changed");
+  emitCallback(changed);
 }
 
 }  // namespace finalcut
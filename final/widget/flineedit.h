@@ -159,6 +159,7 @@ class FLineEdit : public FWidget
 
     // Event handlers
     void onKeyPress (FKeyEvent*) override;
+    void onPaste (FPasteEvent*) override;
     void onMouseDown (FMouseEvent*) override;
     void onMouseUp (FMouseEvent*) override;
     void onMouseMove (FMouseEvent*) override;
@@ -210,6 +211,7 @@ class FLineEdit : public FWidget
     void acceptInput();
     auto keyInput (FKey) -> bool;
     auto characterFilter (const wchar_t) const -> wchar_t;
+    auto pasteFilter (const FString&) const -> FString;
     void processActivate();
     void processChanged() const;
 
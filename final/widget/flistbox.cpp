@@ -21,7 +21,9 @@
 ***********************************************************************/
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
+#include <utility>
 
 #include "final/fapplication.h"
 #include "final/fevent.h"
@@ -34,6 +36,100 @@
 namespace finalcut
 {
 
+//----------------------------------------------------------------------
+// class FListBox::SelectionRanges
+//----------------------------------------------------------------------
+
+// public methods of FListBox::SelectionRanges
+//----------------------------------------------------------------------
+auto FListBox::SelectionRanges::contains (std::size_t pos) const -> bool
+{
+  auto iter = ranges.upper_bound(pos);
+
+  if ( iter == ranges.cbegin() )
+    return false;
+
+  --iter;
+  return pos <= iter->second;
+}
+
+//----------------------------------------------------------------------
+void FListBox::SelectionRanges::insert (std::size_t pos)
+{
+  if ( contains(pos) )
+    return;
+
+  // Merges the position with the adjacent ranges
+  const auto next = ranges.upper_bound(pos);
+  const auto prev = ( next == ranges.begin() ) ? ranges.end() : std::prev(next);
+  const bool join_prev = prev != ranges.end() && prev->second + 1 == pos;
+  const bool join_next = next != ranges.end() && next->first == pos + 1;
+
+  if ( join_prev && join_next )
+  {
+    prev->second = next->second;
+    ranges.erase(next);
+  }
+  else if ( join_prev )
+    prev->second = pos;
+  else if ( join_next )
+  {
+    const auto last = next->second;
+    ranges.erase(next);
+    ranges.emplace(pos, last);
+  }
+  else
+    ranges.emplace(pos, pos);
+}
+
+//----------------------------------------------------------------------
+void FListBox::SelectionRanges::erase (std::size_t pos)
+{
+  auto iter = ranges.upper_bound(pos);
+
+  if ( iter == ranges.begin() )
+    return;
+
+  --iter;
+
+  if ( pos > iter->second )
+    return;
+
+  // Splits the range around the position
+  const auto first = iter->first;
+  const auto last = iter->second;
+  ranges.erase(iter);
+
+  if ( first < pos )
+    ranges.emplace(first, pos - 1);
+
+  if ( pos < last )
+    ranges.emplace(pos + 1, last);
+}
+
+//----------------------------------------------------------------------
+void FListBox::SelectionRanges::eraseFrom (std::size_t pos)
+{
+  // Removes all positions >= pos
+
+  ranges.erase (ranges.lower_bound(pos), ranges.end());
+
+  if ( ranges.empty() )
+    return;
+
+  auto& last_range = *ranges.rbegin();
+
+  if ( last_range.second >= pos )
+    last_range.second = pos - 1;
+}
+
+//----------------------------------------------------------------------
+void FListBox::SelectionRanges::clear()
+{
+  ranges.clear();
+}
+
+
 //----------------------------------------------------------------------
 // class FListBox
 //----------------------------------------------------------------------
@@ -89,6 +185,9 @@ void FListBox::setCurrentItem (FListBoxItems::iterator iter)
 void FListBox::showInsideBrackets ( const std::size_t index
                                   , BracketType b )
 {
+  if ( isVirtual() )  // Virtual rows have no brackets
+    return;
+
   auto iter = index2iterator(index - 1);
   iter->brackets = b;
 
@@ -137,6 +236,64 @@ void FListBox::setText (const FString& txt)
   data.text.setString(txt);
 }
 
+//----------------------------------------------------------------------
+void FListBox::setVirtualRows (std::size_t count, RowProvider&& provider)
+{
+  // Shows count rows without storing a list item per row.
+  // The provider returns the text of a row (0-based index)
+  // and is only called for the visible rows.
+
+  data.itemlist.clear();
+  data.itemlist.shrink_to_fit();
+  delete data.source_container;
+  data.source_container = nullptr;
+  conv_type = ConvertType::Virtual;
+  virtual_list.provider = std::move(provider);
+  virtual_list.selected.clear();
+  virtual_list.count = 0;
+  max_line_width = 0;
+  selection.current = 0;
+  scroll.xoffset = 0;
+  scroll.yoffset = 0;
+  scroll.last_yoffset = -1;
+  setVirtualRowCount (count);
+}
+
+//----------------------------------------------------------------------
+void FListBox::setVirtualRowCount (std::size_t count)
+{
+  if ( ! isVirtual() )
+    return;
+
+  virtual_list.count = count;
+  virtual_list.selected.eraseFrom(count);
+
+  if ( selection.current > count )
+    selection.current = count;
+  else if ( selection.current == 0 && count > 0 )
+    selection.current = 1;
+
+  const auto yoffset_end = int(count) - int(getClientHeight());
+
+  if ( scroll.yoffset > yoffset_end )
+    scroll.yoffset = std::max(yoffset_end, 0);
+
+  scroll.last_yoffset = -1;  // Redraw all rows
+  recalculateVerticalBar (count);
+  scroll.vbar->setValue (scroll.yoffset);
+  processChanged();
+}
+
+//----------------------------------------------------------------------
+void FListBox::setVirtualSearch (RowSearch&& search)
+{
+  // The incremental search in a virtual list calls this function.
+  // It returns the number (1-based) of the first row that begins
+  // with the given text (case-insensitive), or 0 if none was found.
+
+  virtual_list.search = std::move(search);
+}
+
 //----------------------------------------------------------------------
 void FListBox::hide()
 {
@@ -147,6 +304,9 @@ void FListBox::hide()
 //----------------------------------------------------------------------
 void FListBox::insert (const FListBoxItem& listItem)
 {
+  if ( isVirtual() )
+    resetVirtualRows();
+
   const auto column_width = getColumnWidth(listItem.text);
   const bool has_brackets(listItem.brackets != BracketType::None);
   recalculateHorizontalBar (column_width, has_brackets);
@@ -164,7 +324,7 @@ void FListBox::insert (const FListBoxItem& listItem)
 //----------------------------------------------------------------------
 void FListBox::remove (std::size_t item)
 {
-  if ( item > getCount() )
+  if ( isVirtual() || item > getCount() )  // Use setVirtualRowCount()
     return;
 
   data.itemlist.erase (data.itemlist.cbegin() + int(item) - 1);
@@ -215,6 +375,9 @@ void FListBox::remove (std::size_t item)
 //----------------------------------------------------------------------
 void FListBox::clear()
 {
+  if ( isVirtual() )
+    resetVirtualRows();
+
   data.itemlist.clear();
   data.itemlist.shrink_to_fit();
   selection.current = 0;
@@ -450,19 +613,20 @@ void FListBox::onWheel (FWheelEvent* ev)
   const std::size_t current_before = selection.current;
   const int yoffset_before = scroll.yoffset;
   static constexpr int wheel_distance = 4;
+  const int distance = wheel_distance * ev->getDelta();
   const auto& wheel = ev->getWheel();
 
   if ( isDragging(drag_scroll) )
     stopDragScroll();
 
   if ( wheel == MouseWheel::Up )
-    wheelUp (wheel_distance);
+    wheelUp (distance);
   else if ( wheel == MouseWheel::Down )
-    wheelDown (wheel_distance);
+    wheelDown (distance);
   else if ( wheel == MouseWheel::Left )
-    wheelLeft (wheel_distance);
+    wheelLeft (distance);
   else if ( wheel == MouseWheel::Right )
-    wheelRight (wheel_distance);
+    wheelRight (distance);
 
   if ( current_before != selection.current )
   {
@@ -572,9 +736,17 @@ void FListBox::adjustSize()
 
 // private methods of FListBox
 //----------------------------------------------------------------------
-inline auto FListBox::getString (FListBoxItems::iterator iter) -> FString
+inline auto FListBox::getString (const FListBoxItem& item) -> FString
 {
-  return iter->getText();
+  return item.getText();
+}
+
+//----------------------------------------------------------------------
+auto FListBox::getVirtualItem (std::size_t index) const -> FListBoxItem
+{
+  FListBoxItem item{virtual_list.provider(index)};
+  item.selected = virtual_list.selected.contains(index);
+  return item;
 }
 
 //----------------------------------------------------------------------
@@ -726,7 +898,7 @@ void FListBox::drawHeadline()
 //----------------------------------------------------------------------
 void FListBox::drawList()
 {
-  if ( data.itemlist.empty() || getHeight() <= 2 || getWidth() <= 4 )
+  if ( getCount() == 0 || getHeight() <= 2 || getWidth() <= 4 )
     return;
 
   std::size_t start{};
@@ -746,31 +918,36 @@ void FListBox::drawList()
     num = std::max(last_pos, current_pos) + 1;
   }
 
-  auto iter = index2iterator(start + std::size_t(scroll.yoffset));
-
-  for (std::size_t y = start; y < num && iter != data.itemlist.end() ; y++)
+  if ( isVirtual() )
+    drawVirtualList (start, num);
+  else
   {
-    bool serach_mark{false};
-    const bool lineHasBrackets = hasBrackets(iter);
+    auto iter = index2iterator(start + std::size_t(scroll.yoffset));
 
-    // Import data via lazy conversion
-    lazyConvert (iter, y);
+    for (std::size_t y = start; y < num && iter != data.itemlist.end() ; y++)
+    {
+      bool serach_mark{false};
+      const bool lineHasBrackets = hasBrackets(iter);
 
-    // Set screen position and attributes
-    setLineAttributes ( int(y), isSelected(iter), lineHasBrackets
-                      , serach_mark );
+      // Import data via lazy conversion
+      lazyConvert (iter, y);
 
-    // print the entry
-    if ( lineHasBrackets )
-    {
-      drawListBracketsLine (int(y), iter, serach_mark);
-    }
-    else  // line has no brackets
-    {
-      drawListLine (int(y), iter, serach_mark);
-    }
+      // Set screen position and attributes
+      setLineAttributes ( int(y), isSelected(iter), lineHasBrackets
+                        , serach_mark );
+
+      // print the entry
+      if ( lineHasBrackets )
+      {
+        drawListBracketsLine (int(y), *iter, serach_mark);
+      }
+      else  // line has no brackets
+      {
+        drawListLine (int(y), *iter, serach_mark);
+      }
 
-    ++iter;
+      ++iter;
+    }
   }
 
   unsetAttributes();
@@ -780,7 +957,7 @@ void FListBox::drawList()
 
 //----------------------------------------------------------------------
 inline void FListBox::drawListLine ( int y
-                                   , FListBoxItems::iterator iter
+                                   , const FListBoxItem& item
                                    , bool serach_mark )
 {
   const std::size_t inc_len = data.inc_search.getLength();
@@ -788,7 +965,7 @@ inline void FListBox::drawListLine ( int y
   const bool isCurrentLine( y + scroll.yoffset + 1 == int(selection.current) );
   const std::size_t first = std::size_t(scroll.xoffset) + 1;
   const std::size_t max_width = getWidth() - nf_offset - 4;
-  const FString element(getColumnSubString (getString(iter), first, max_width));
+  const FString element(getColumnSubString (getString(item), first, max_width));
   auto column_width = getColumnWidth(element);
 
   if ( FVTerm::getFOutput()->isMonochron() && isCurrentLine && getFlags().focus.focus )
@@ -835,7 +1012,7 @@ inline void FListBox::printRightBracket (BracketType bracket_type)
 
 //----------------------------------------------------------------------
 inline void FListBox::drawListBracketsLine ( int y
-                                           , FListBoxItems::iterator iter
+                                           , const FListBoxItem& item
                                            , bool serach_mark )
 {
   std::size_t b{0};
@@ -850,14 +1027,14 @@ inline void FListBox::drawListBracketsLine ( int y
   if ( scroll.xoffset == 0 )
   {
     b = 1;  // Required bracket space
-    printLeftBracket (iter->brackets);
+    printLeftBracket (item.brackets);
   }
 
   const auto first = std::size_t(scroll.xoffset);
   const std::size_t max_width = getWidth() - nf_offset - 4 - b;
-  const FString element(getColumnSubString (getString(iter), first, max_width));
+  const FString element(getColumnSubString (getString(item), first, max_width));
   auto column_width = getColumnWidth(element);
-  const std::size_t text_width = getColumnWidth(getString(iter));
+  const std::size_t text_width = getColumnWidth(getString(item));
   std::size_t i{0};
   const auto& wc = getColorTheme();
 
@@ -881,7 +1058,7 @@ inline void FListBox::drawListBracketsLine ( int y
       setColor ( wc->current_element.focus_fg
                , wc->current_element.focus_bg );
 
-    printRightBracket (iter->brackets);
+    printRightBracket (item.brackets);
     column_width++;
   }
 
@@ -895,6 +1072,31 @@ inline void FListBox::drawListBracketsLine ( int y
     print (' ');
 }
 
+//----------------------------------------------------------------------
+void FListBox::drawVirtualList (std::size_t start, std::size_t num)
+{
+  // Fetches only the visible rows from the row provider
+
+  const auto old_max_line_width = max_line_width;
+
+  for (std::size_t y = start; y < num; y++)
+  {
+    const auto index = y + std::size_t(scroll.yoffset);
+
+    if ( index >= virtual_list.count )
+      break;
+
+    bool serach_mark{false};
+    const auto item = getVirtualItem(index);
+    recalculateHorizontalBar (getColumnWidth(item.text), false);
+    setLineAttributes (int(y), item.selected, false, serach_mark);
+    drawListLine (int(y), item, serach_mark);
+  }
+
+  if ( max_line_width != old_max_line_width && scroll.hbar->isShown() )
+    scroll.hbar->redraw();
+}
+
 //----------------------------------------------------------------------
 inline void FListBox::setInitialLineAttributes (bool isLineSelected) const
 {
@@ -1505,28 +1707,15 @@ inline auto FListBox::spacebarProcessing() -> bool
   if ( inc_len > 0 )  // Enter a spacebar for incremental search
   {
     data.inc_search += L' ';
-    bool inc_found{false};
-    auto iter = data.itemlist.begin();
+    const auto found = findIncSearchItem();
 
-    while ( iter != data.itemlist.end() )
-    {
-      if ( ! inc_found
-        && data.inc_search.toLower()
-        == iter->getText().left(inc_len + 1).toLower() )
-      {
-        setCurrentItem(iter);
-        inc_found = true;
-        break;
-      }
-
-      ++iter;
-    }
-
-    if ( ! inc_found )
+    if ( found == 0 )
     {
       data.inc_search.remove(inc_len, 1);
       return false;
     }
+
+    setCurrentItem(found);
   }
   else if ( isMultiSelection() )  // Change selection
   {
@@ -1582,19 +1771,10 @@ inline auto FListBox::deletePreviousCharacter() -> bool
 
   if ( inc_len > 1 )
   {
-    auto iter = data.itemlist.begin();
-
-    while ( iter != data.itemlist.end() )
-    {
-      if ( data.inc_search.toLower()
-           == iter->getText().left(inc_len - 1).toLower() )
-      {
-        setCurrentItem(iter);
-        break;
-      }
+    const auto found = findIncSearchItem();
 
-      ++iter;
-    }
+    if ( found > 0 )
+      setCurrentItem(found);
   }
 
   return true;
@@ -1613,32 +1793,49 @@ inline auto FListBox::keyIncSearchInput (FKey key) -> bool
     data.inc_search += wchar_t(key);
 
   const auto& inc_len = data.inc_search.getLength();
-  bool inc_found{false};
-  auto iter = data.itemlist.begin();
-
-  while ( iter != data.itemlist.end() )
-  {
-    if ( ! inc_found
-      && data.inc_search.toLower()
-      == iter->getText().left(inc_len).toLower() )
-    {
-      setCurrentItem(iter);
-      inc_found = true;
-      break;
-    }
+  const auto found = findIncSearchItem();
 
-    ++iter;
-  }
-
-  if ( ! inc_found )
+  if ( found == 0 )
   {
     data.inc_search.remove(inc_len - 1, 1);
     return inc_len != 1;
   }
 
+  setCurrentItem(found);
   return true;
 }
 
+//----------------------------------------------------------------------
+auto FListBox::findIncSearchItem() const -> std::size_t
+{
+  // Returns the number of the first item that begins
+  // with the search text, or 0 if there is no such item
+
+  if ( isVirtual() )
+  {
+    // Searching millions of rows is left to the row provider
+    return ( virtual_list.search )
+           ? virtual_list.search(data.inc_search)
+           : 0;
+  }
+
+  const auto& inc_len = data.inc_search.getLength();
+  const auto search = data.inc_search.toLower();
+  auto is_match = [&search, &inc_len] (const FListBoxItem& item)
+  {
+    return search == item.getText().left(inc_len).toLower();
+  };
+
+  const auto iter = std::find_if ( data.itemlist.cbegin()
+                                 , data.itemlist.cend()
+                                 , is_match );
+
+  if ( iter == data.itemlist.cend() )
+    return 0;
+
+  return std::size_t(std::distance(data.itemlist.cbegin(), iter)) + 1;
+}
+
 //----------------------------------------------------------------------
 void FListBox::processClick() const
 {
@@ -1654,13 +1851,15 @@ void FListBox::processSelect() const
 //----------------------------------------------------------------------
 void FListBox::processRowChanged() const
 {
-  emitCallback("row-changed");
+  static const auto row_changed = FCallback::getSignalId("row-changed");
+  emitCallback(row_changed);
 }
 
 //----------------------------------------------------------------------
 void FListBox::processChanged() const
 {
-  emitCallback("changed");
+  static const auto changed = FCallback::getSignalId("changed");
+  emitCallback(changed);
 }
 
 //----------------------------------------------------------------------
@@ -1692,6 +1891,19 @@ void FListBox::lazyConvert(FListBoxItems::iterator iter, std::size_t y)
     scroll.hbar->redraw();
 }
 
+//----------------------------------------------------------------------
+void FListBox::resetVirtualRows()
+{
+  conv_type = ConvertType::None;
+  virtual_list.count = 0;
+  virtual_list.provider = nullptr;
+  virtual_list.search = nullptr;
+  virtual_list.selected.clear();
+  virtual_list.item.clear();
+  selection.current = 0;
+  max_line_width = 0;
+}
+
 //----------------------------------------------------------------------
 void FListBox::cb_vbarChange (const FWidget*)
 {
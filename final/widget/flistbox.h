@@ -48,6 +48,8 @@
   #error "Only <final/final.h> can be included directly."
 #endif
 
+#include <functional>
+#include <map>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -176,6 +178,8 @@ class FListBox : public FWidget
     // Using-declaration
     using FWidget::setGeometry;
     using FListBoxItems = std::vector<FListBoxItem>;
+    using RowProvider = std::function<FString(std::size_t)>;
+    using RowSearch = std::function<std::size_t(const FString&)>;
 
     // Constructor
     explicit FListBox (FWidget* = nullptr);
@@ -208,6 +212,7 @@ class FListBox : public FWidget
     auto getItem (std::size_t) const & -> const FListBoxItem&;
     auto getItem (FListBoxItems::iterator) & -> FListBoxItem&;
     auto getItem (FListBoxItems::const_iterator) const & -> const FListBoxItem&;
+    auto getItemCopy (std::size_t) const -> FListBoxItem;
     auto currentItem() const noexcept -> std::size_t;
     auto getData() & -> FListBoxItems&;
     auto getData() const & -> const FListBoxItems&;
@@ -229,8 +234,12 @@ class FListBox : public FWidget
     void unsetMultiSelection ();
     void setDisable() override;
     void setText (const FString&);
+    void setVirtualRows (std::size_t, RowProvider&&);
+    void setVirtualRowCount (std::size_t);
+    void setVirtualSearch (RowSearch&&);
 
     // Inquiries
+    auto isVirtual() const -> bool;
     auto isSelected (std::size_t) const -> bool;
     auto isSelected (FListBoxItems::iterator) const -> bool;
     auto isMultiSelection() const -> bool;
@@ -288,6 +297,33 @@ class FListBox : public FWidget
     using KeyMapResult = std::unordered_map<FKey, std::function<bool()>, EnumHash<FKey>>;
     using LazyInsert = std::function<void(FListBoxItem&, FDataAccess*, std::size_t)>;
 
+    // Selected rows of a virtual list as ranges of consecutive indexes
+    class SelectionRanges
+    {
+      public:
+        // Inquiry
+        auto contains (std::size_t) const -> bool;
+
+        // Methods
+        void insert (std::size_t);
+        void erase (std::size_t);
+        void eraseFrom (std::size_t);
+        void clear();
+
+      private:
+        // Data member
+        std::map<std::size_t, std::size_t> ranges{};  // first -> last
+    };
+
+    struct VirtualData
+    {
+      std::size_t      count{0};
+      RowProvider      provider{};
+      RowSearch        search{};
+      SelectionRanges  selected{};
+      FListBoxItem     item{};  // Row buffer for getItem()
+    };
+
     struct ListBoxData
     {
       FListBoxItems  itemlist{};
@@ -323,13 +359,15 @@ class FListBox : public FWidget
     // Enumeration
     enum class ConvertType
     {
-      None   = 0,
-      Direct = 1,
-      Lazy   = 2
+      None    = 0,
+      Direct  = 1,
+      Lazy    = 2,
+      Virtual = 3
     };
 
     // Accessors
-    static auto getString (FListBoxItems::iterator) -> FString;
+    static auto getString (const FListBoxItem&) -> FString;
+    auto getVirtualItem (std::size_t) const -> FListBoxItem;
 
     // Inquiry
     auto isHorizontallyScrollable() const -> bool;
@@ -344,10 +382,11 @@ class FListBox : public FWidget
     void drawScrollbars() const;
     void drawHeadline();
     void drawList();
-    void drawListLine (int, FListBoxItems::iterator, bool);
+    void drawListLine (int, const FListBoxItem&, bool);
     void printLeftBracket (BracketType);
     void printRightBracket (BracketType);
-    void drawListBracketsLine (int, FListBoxItems::iterator, bool);
+    void drawListBracketsLine (int, const FListBoxItem&, bool);
+    void drawVirtualList (std::size_t, std::size_t);
     void setInitialLineAttributes (bool) const;
     void setCurrentLineAttributes (int, bool, bool, bool&);
     void setLineAttributes (int, bool, bool, bool&);
@@ -387,12 +426,14 @@ class FListBox : public FWidget
     auto changeSelectionAndPosition() -> bool;
     auto deletePreviousCharacter() -> bool;
     auto keyIncSearchInput (FKey) -> bool;
+    auto findIncSearchItem() const -> std::size_t;
     void processClick() const;
     void processSelect() const;
     void processRowChanged() const;
     void processChanged() const;
     void changeOnResize() const;
     void lazyConvert (FListBoxItems::iterator, std::size_t);
+    void resetVirtualRows();
     auto index2iterator (std::size_t) -> FListBoxItems::iterator;
     auto index2iterator (std::size_t index) const -> FListBoxItems::const_iterator;
     // Callback methods
@@ -400,16 +441,17 @@ class FListBox : public FWidget
     void cb_hbarChange (const FWidget*);
 
     // Function Pointer
-    LazyInsert      lazy_inserter{};
+    LazyInsert           lazy_inserter{};
 
     // Data members
-    std::size_t     nf_offset{0};
-    std::size_t     max_line_width{0};
-    ListBoxData     data{};
-    ScrollingState  scroll{};
-    SelectionState  selection{};
-    ConvertType     conv_type{ConvertType::None};
-    DragScrollMode  drag_scroll{DragScrollMode::None};
+    std::size_t          nf_offset{0};
+    std::size_t          max_line_width{0};
+    ListBoxData          data{};
+    mutable VirtualData  virtual_list{};
+    ScrollingState       scroll{};
+    SelectionState       selection{};
+    ConvertType          conv_type{ConvertType::None};
+    DragScrollMode       drag_scroll{DragScrollMode::None};
 };
 
 // non-member function
@@ -462,11 +504,25 @@ inline auto FListBox::getClassName() const -> FString
 
 //----------------------------------------------------------------------
 inline auto FListBox::getCount() const -> std::size_t
-{ return data.itemlist.size(); }
+{
+  return ( isVirtual() )
+         ? virtual_list.count
+         : data.itemlist.size();
+}
 
 //----------------------------------------------------------------------
 inline auto FListBox::getItem (std::size_t index) & -> FListBoxItem&
 {
+  // In virtual mode, all rows share one item buffer. The reference
+  // is only valid until the next getItem() call, and changes to the
+  // item are not stored. getItemCopy() returns an independent item.
+
+  if ( isVirtual() )
+  {
+    virtual_list.item = getVirtualItem(index - 1);
+    return virtual_list.item;
+  }
+
   auto iter = index2iterator(index - 1);
   return *iter;
 }
@@ -474,6 +530,12 @@ inline auto FListBox::getItem (std::size_t index) & -> FListBoxItem&
 //----------------------------------------------------------------------
 inline auto FListBox::getItem (std::size_t index) const & -> const FListBoxItem&
 {
+  if ( isVirtual() )
+  {
+    virtual_list.item = getVirtualItem(index - 1);
+    return virtual_list.item;
+  }
+
   auto iter = index2iterator(index - 1);
   return *iter;
 }
@@ -490,6 +552,15 @@ inline auto FListBox::getItem (FListBoxItems::const_iterator iter) const & -> co
 inline auto FListBox::currentItem() const noexcept -> std::size_t
 { return selection.current; }
 
+//----------------------------------------------------------------------
+inline auto FListBox::getItemCopy (std::size_t index) const -> FListBoxItem
+{
+  if ( isVirtual() )
+    return getVirtualItem(index - 1);
+
+  return *index2iterator(index - 1);
+}
+
 //----------------------------------------------------------------------
 inline auto FListBox::getData() & -> FListBoxItems&
 { return data.itemlist; }
@@ -504,7 +575,12 @@ inline auto FListBox::getText() & -> FString&
 
 //----------------------------------------------------------------------
 inline void FListBox::selectItem (std::size_t index)
-{ index2iterator(index - 1)->selected = true; }
+{
+  if ( isVirtual() )
+    virtual_list.selected.insert(index - 1);
+  else
+    index2iterator(index - 1)->selected = true;
+}
 
 //----------------------------------------------------------------------
 inline void FListBox::selectItem (FListBoxItems::iterator iter) const
@@ -512,7 +588,12 @@ inline void FListBox::selectItem (FListBoxItems::iterator iter) const
 
 //----------------------------------------------------------------------
 inline void FListBox::unselectItem (std::size_t index)
-{ index2iterator(index - 1)->selected = false; }
+{
+  if ( isVirtual() )
+    virtual_list.selected.erase(index - 1);
+  else
+    index2iterator(index - 1)->selected = false;
+}
 
 //----------------------------------------------------------------------
 inline void FListBox::unselectItem (FListBoxItems::iterator iter) const
@@ -520,7 +601,10 @@ inline void FListBox::unselectItem (FListBoxItems::iterator iter) const
 
 //----------------------------------------------------------------------
 inline void FListBox::showNoBrackets (std::size_t index)
-{ index2iterator(index - 1)->brackets = BracketType::None; }
+{
+  if ( ! isVirtual() )  // Virtual rows have no brackets
+    index2iterator(index - 1)->brackets = BracketType::None;
+}
 
 //----------------------------------------------------------------------
 inline void FListBox::showNoBrackets (FListBoxItems::iterator iter) const
@@ -538,9 +622,17 @@ inline void FListBox::unsetMultiSelection()
 inline void FListBox::setDisable()
 { setEnable(false); }
 
+//----------------------------------------------------------------------
+inline auto FListBox::isVirtual() const -> bool
+{ return conv_type == ConvertType::Virtual; }
+
 //----------------------------------------------------------------------
 inline auto FListBox::isSelected (std::size_t index) const -> bool
-{ return index2iterator(index - 1)->selected; }
+{
+  return ( isVirtual() )
+         ? virtual_list.selected.contains(index - 1)
+         : index2iterator(index - 1)->selected;
+}
 
 //----------------------------------------------------------------------
 inline auto FListBox::isSelected (FListBoxItems::iterator iter) const -> bool
@@ -552,7 +644,10 @@ inline auto FListBox::isMultiSelection() const -> bool
 
 //----------------------------------------------------------------------
 inline auto FListBox::hasBrackets(std::size_t index) const -> bool
-{ return index2iterator(index - 1)->brackets != BracketType::None; }
+{
+  return ! isVirtual()
+      && index2iterator(index - 1)->brackets != BracketType::None;
+}
 
 //----------------------------------------------------------------------
 inline auto FListBox::hasBrackets(FListBoxItems::iterator iter) const -> bool
@@ -583,6 +678,9 @@ template <typename Container
         , typename LazyConverter>
 void FListBox::insert (const Container& container, LazyConverter&& converter)
 {
+  if ( isVirtual() )
+    resetVirtualRows();
+
   conv_type = ConvertType::Lazy;
   data.source_container = makeFData(container);
   lazy_inserter = std::forward<LazyConverter>(converter);
@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -198,7 +199,8 @@ FListViewItem::FListViewItem (iterator parent_iter)
 //----------------------------------------------------------------------
 FListViewItem::~FListViewItem()  // destructor
 {
-  // Remove from parent itemlist
+  // Remove from parent itemlist (the list view
+  // also drops the lazy loading state of the subtree)
 
   auto parent = getParent();
 
@@ -354,7 +356,7 @@ void FListViewItem::remove (FListViewItem* item) const
     parent = item->getParent();
     parent->delChild(item);
     auto parent_item = static_cast<FListViewItem*>(parent);
-    parent_item->visible_lines--;
+    parent_item->resetVisibleLineCounter();
 
     if ( ! parent_item->hasChildren() )
     {
@@ -367,7 +369,20 @@ void FListViewItem::remove (FListViewItem* item) const
 //----------------------------------------------------------------------
 void FListViewItem::expand()
 {
-  if ( isExpand() || ! hasChildren() )
+  if ( isExpand() )
+    return;
+
+  if ( isLazy() && hasParent() )
+  {
+    auto listview = static_cast<FListView*>(*root);
+
+    if ( load_state == LoadState::Unloaded )
+      listview->loadChildren(this);  // Fetch the children on first use
+    else
+      listview->touchLazyItem(this);
+  }
+
+  if ( ! hasChildren() )
     return;
 
   resetVisibleLineCounter();
@@ -398,6 +413,8 @@ void FListViewItem::sort (Compare cmp)
   if ( ! children.empty() )
     std::sort(children.begin(), children.end(), cmp);
 
+  child_line_offsets.clear();  // The order of the lines has changed
+
   // Sort the sublevels
   for (auto&& item : children)
     static_cast<FListViewItem*>(item)->sort(cmp);
@@ -450,6 +467,28 @@ auto FListViewItem::getVisibleLines() -> std::size_t
   return visible_lines;
 }
 
+//----------------------------------------------------------------------
+auto FListViewItem::getChildLineOffsets() -> const LineOffsets&
+{
+  // Returns the number of visible lines before each child,
+  // followed by the total. The values are rebuilt after changes.
+
+  if ( ! child_line_offsets.empty() )
+    return child_line_offsets;
+
+  std::size_t lines{0};
+  child_line_offsets.reserve(numOfChildren() + 1);
+
+  for (auto iter = FObject::cbegin(); iter != FObject::cend(); ++iter)
+  {
+    child_line_offsets.push_back(lines);
+    lines += static_cast<FListViewItem*>(*iter)->getVisibleLines();
+  }
+
+  child_line_offsets.push_back(lines);
+  return child_line_offsets;
+}
+
 //----------------------------------------------------------------------
 void FListViewItem::setCheckable (bool enable)
 {
@@ -464,17 +503,44 @@ void FListViewItem::setCheckable (bool enable)
   }
 }
 
+//----------------------------------------------------------------------
+void FListViewItem::setLazy (bool enable)
+{
+  // The children of a lazy item are requested from the
+  // child loader of the list view on the first expand()
+
+  lazy = enable;
+
+  if ( enable && ! hasChildren() )
+  {
+    load_state = LoadState::Unloaded;
+    expandable = true;
+  }
+  else if ( ! enable && load_state == LoadState::Unloaded )
+  {
+    load_state = LoadState::Populated;
+    expandable = hasChildren();
+  }
+}
+
 //----------------------------------------------------------------------
 void FListViewItem::resetVisibleLineCounter()
 {
   visible_lines = 0;
+  child_line_offsets.clear();
   auto parent = getParent();
 
-  if ( parent && parent->isInstanceOf("FListViewItem") )
+  if ( ! parent )
+    return;
+
+  if ( parent->isInstanceOf("FListViewItem") )
   {
     auto parent_item = static_cast<FListViewItem*>(parent);
     return parent_item->resetVisibleLineCounter();
   }
+
+  if ( parent->isInstanceOf("FListView") )
+    static_cast<FListView*>(parent)->resetLineOffsets();
 }
 
 
@@ -676,15 +742,7 @@ FListView::~FListView()  // destructor
 //----------------------------------------------------------------------
 auto FListView::getCount() const -> std::size_t
 {
-  int n{0};
-
-  for (auto&& item : data.itemlist)
-  {
-    const auto& listitem = static_cast<FListViewItem*>(item);
-    n += listitem->getVisibleLines();
-  }
-
-  return std::size_t(n);
+  return getLineOffsets().back();
 }
 
 //----------------------------------------------------------------------
@@ -809,6 +867,27 @@ void FListView::setColumnSort (int column, SortOrder order)
   sorting.order = order;
 }
 
+//----------------------------------------------------------------------
+void FListView::setChildLoader (ChildLoader&& loader, LoadMode mode)
+{
+  // Sets the function that returns the children of a lazy item.
+  // In asynchronous mode, it is called with a copy of the item
+  // texts from a worker thread and must not access the widget.
+
+  lazy_load.loader = std::move(loader);
+  lazy_load.mode = mode;
+}
+
+//----------------------------------------------------------------------
+void FListView::setLazyItemLimit (std::size_t limit)
+{
+  // Limits the number of loaded children of lazy items.
+  // Collapsed subtrees are unloaded, least recently used first.
+
+  lazy_load.item_limit = limit;
+  evictLazyItems(nullptr);
+}
+
 //----------------------------------------------------------------------
 void FListView::showColumn (int column)
 {
@@ -976,6 +1055,7 @@ void FListView::remove (FListViewItem* item)
   const bool is_current_line( item == current_item );
   const bool is_first_line( item == first_item );
   const bool is_last_line( item == last_item );
+  forgetLazyItems(item);
 
   if ( is_current_line )
   {
@@ -998,13 +1078,14 @@ void FListView::remove (FListViewItem* item)
       auto last = std::remove (data.itemlist.begin(), data.itemlist.end(), item);
       data.itemlist.erase(last, data.itemlist.end());
       delChild(item);
+      resetLineOffsets();
       selection.current_iter.getPosition()--;
     }
     else
     {
       parent->delChild(item);
       auto parent_item = static_cast<FListViewItem*>(parent);
-      parent_item->visible_lines--;
+      parent_item->resetVisibleLineCounter();
       selection.current_iter.getPosition()--;
 
       if ( ! parent_item->hasChildren() )
@@ -1040,6 +1121,10 @@ void FListView::remove (FListViewItem* item)
 void FListView::clear()
 {
   data.itemlist.clear();
+  resetLineOffsets();
+  lazy_load.populated.clear();
+  lazy_load.pending.clear();
+  lazy_load.loaded_items = 0;
   selection.current_iter = getNullIterator();
   scroll.first_visible_line = getNullIterator();
   scroll.last_visible_line = getNullIterator();
@@ -1053,6 +1138,32 @@ void FListView::clear()
   processChanged();
 }
 
+//----------------------------------------------------------------------
+void FListView::beginUpdate()
+{
+  // Defers sorting, the scroll bar calculation and the change
+  // notification of insert() until the matching endUpdate()
+
+  update.depth++;
+}
+
+//----------------------------------------------------------------------
+void FListView::endUpdate()
+{
+  if ( update.depth == 0 )
+    return;
+
+  update.depth--;
+
+  if ( update.depth > 0 || ! update.inserted )
+    return;
+
+  update.inserted = false;
+  recalculateHorizontalBar (update.line_width);
+  update.line_width = 0;
+  afterInsertion();  // Sorts the list only once
+}
+
 //----------------------------------------------------------------------
 void FListView::sort()
 {
@@ -1061,8 +1172,18 @@ void FListView::sort()
   if ( sorting.column < 1 || sorting.column > int(data.header.size()) )
     return;
 
+  sort(getSortComparator());
+  selection.current_iter = data.itemlist.begin();
+  scroll.first_visible_line = data.itemlist.begin();
+  scroll.last_visible_line = findLine(int(getClientHeight()) - 1);
+  processChanged();
+}
+
+//----------------------------------------------------------------------
+auto FListView::getSortComparator() const -> SortComparator
+{
   SortType column_sort_type = getColumnSortType(sorting.column);
-  std::function<bool(const FObject*, const FObject*)> comparator;
+  SortComparator comparator;
 
   switch ( column_sort_type )
   {
@@ -1089,10 +1210,7 @@ void FListView::sort()
       throw std::invalid_argument{"Invalid sort type"};
   }
 
-  sort(comparator);
-  selection.current_iter = data.itemlist.begin();
-  scroll.first_visible_line = data.itemlist.begin();
-  processChanged();
+  return comparator;
 }
 
 //----------------------------------------------------------------------
@@ -1268,8 +1386,14 @@ void FListView::onMouseDoubleClick (FMouseEvent* ev)
 }
 
 //----------------------------------------------------------------------
-void FListView::onTimer (FTimerEvent*)
+void FListView::onTimer (FTimerEvent* ev)
 {
+  if ( lazy_load.timer_id != 0 && ev->getTimerId() == lazy_load.timer_id )
+  {
+    processLoadResults();
+    return;
+  }
+
   const int position_before = selection.current_iter.getPosition();
   scroll.first_line_position_before = scroll.first_visible_line.getPosition();
 
@@ -1303,6 +1427,7 @@ void FListView::onWheel (FWheelEvent* ev)
 {
   const int position_before = selection.current_iter.getPosition();
   static constexpr int wheel_distance = 4;
+  const int distance = wheel_distance * ev->getDelta();
   const auto& wheel = ev->getWheel();
   scroll.first_line_position_before = scroll.first_visible_line.getPosition();
 
@@ -1310,13 +1435,13 @@ void FListView::onWheel (FWheelEvent* ev)
     stopDragScroll();
 
   if ( wheel == MouseWheel::Up )
-    wheelUp (wheel_distance);
+    wheelUp (distance);
   else if ( wheel == MouseWheel::Down )
-    wheelDown (wheel_distance);
+    wheelDown (distance);
   else if ( wheel == MouseWheel::Left )
-    wheelLeft (wheel_distance);
+    wheelLeft (distance);
   else if ( wheel == MouseWheel::Right )
-    wheelRight (wheel_distance);
+    wheelRight (distance);
 
   if ( position_before != selection.current_iter.getPosition() )
     processRowChanged();
@@ -1335,7 +1460,7 @@ void FListView::onWheel (FWheelEvent* ev)
 //----------------------------------------------------------------------
 void FListView::onFocusOut (FFocusEvent* out_ev)
 {
-  delOwnTimers();
+  delTimer (scroll.timer_id);
   FWidget::onFocusOut(out_ev);
 }
 
@@ -1372,8 +1497,10 @@ void FListView::adjustViewport (const int element_count)
 
     if ( scroll.first_visible_line.getPosition() >= difference )
     {
-      scroll.first_visible_line -= difference;
-      scroll.last_visible_line -= difference;
+      const int first = scroll.first_visible_line.getPosition() - difference;
+      const int last = scroll.last_visible_line.getPosition() - difference;
+      moveToLine (scroll.first_visible_line, first);
+      moveToLine (scroll.last_visible_line, last);
     }
   }
 
@@ -1514,6 +1641,7 @@ void FListView::sort (Compare cmp)
 {
   // Sort the top level
   std::sort(data.itemlist.begin(), data.itemlist.end(), cmp);
+  resetLineOffsets();
 
   // Sort the sublevels
   for (auto&& item : data.itemlist)
@@ -2158,6 +2286,411 @@ void FListView::updateDrawing (bool draw_vbar, bool draw_hbar)
   forceTerminalUpdate();
 }
 
+//----------------------------------------------------------------------
+auto FListView::getLineOffsets() const -> const LineOffsets&
+{
+  // Returns the number of visible lines before each top-level
+  // item, followed by the total. The values are rebuilt after changes.
+
+  if ( ! line_offsets.empty() )
+    return line_offsets;
+
+  std::size_t lines{0};
+  line_offsets.reserve(data.itemlist.size() + 1);
+
+  for (auto&& item : data.itemlist)
+  {
+    line_offsets.push_back(lines);
+    lines += static_cast<FListViewItem*>(item)->getVisibleLines();
+  }
+
+  line_offsets.push_back(lines);
+  return line_offsets;
+}
+
+//----------------------------------------------------------------------
+inline void FListView::resetLineOffsets() const
+{
+  line_offsets.clear();
+}
+
+//----------------------------------------------------------------------
+auto FListView::findLine (int line) -> FListViewIterator
+{
+  // Returns an iterator to the visible line (0-based) by a binary
+  // search over the line offsets of each tree level - O(depth · log n)
+
+  FListViewIterator iter{data.itemlist.begin()};
+
+  if ( line <= 0 || isItemListEmpty() )
+    return iter;
+
+  auto rest = std::min(std::size_t(line), getCount() - 1);
+  iter.position = int(rest);
+  const auto* offsets = &getLineOffsets();
+  auto level_begin = data.itemlist.begin();
+
+  while ( true )
+  {
+    const auto next = std::upper_bound(offsets->cbegin(), offsets->cend(), rest);
+    const auto index = std::distance(offsets->cbegin(), next) - 1;
+    iter.node = level_begin + index;
+    rest -= (*offsets)[std::size_t(index)];
+
+    if ( rest == 0 )
+      return iter;
+
+    // The line lies in the expanded subtree of this item
+    rest--;
+    auto item = static_cast<FListViewItem*>(*iter.node);
+    iter.iter_path.push(iter.node);
+    level_begin = item->begin();
+    offsets = &item->getChildLineOffsets();
+  }
+}
+
+//----------------------------------------------------------------------
+void FListView::moveToLine (FListViewIterator& iter, int line)
+{
+  // Steps over short distances and searches for long ones
+
+  const int distance = line - iter.getPosition();
+
+  if ( distance >= 0 && distance <= int(getClientHeight()) )
+    iter += distance;
+  else if ( distance < 0 && -distance <= int(getClientHeight()) )
+    iter -= -distance;
+  else
+    iter = findLine(line);
+}
+
+//----------------------------------------------------------------------
+auto FListView::getItemLine (const FListViewItem* item) -> int
+{
+  // Returns the line number of a visible item
+
+  int line{0};
+  const FObject* node = item;
+  auto parent = node->getParent();
+
+  while ( parent && parent != this )
+  {
+    auto parent_item = static_cast<FListViewItem*>(parent);
+    const auto& children = parent_item->getChildren();
+    const auto iter = std::find(children.cbegin(), children.cend(), node);
+    const auto index = std::size_t(std::distance(children.cbegin(), iter));
+    line += int(parent_item->getChildLineOffsets()[index]) + 1;
+    node = parent;
+    parent = node->getParent();
+  }
+
+  const auto iter = std::find(data.itemlist.cbegin(), data.itemlist.cend(), node);
+  const auto index = std::size_t(std::distance(data.itemlist.cbegin(), iter));
+  return line + int(getLineOffsets()[index]);
+}
+
+//----------------------------------------------------------------------
+void FListView::restoreLinePositions (const FListViewItem* current, int ry)
+{
+  // Rebuilds the line iterators after lines were inserted
+  // or removed above them
+
+  if ( isItemListEmpty() || ! current )
+    return;
+
+  const int line = getItemLine(current);
+  const int first = std::max(0, line - ry);
+  selection.current_iter = findLine(line);
+  scroll.first_visible_line = findLine(first);
+  scroll.last_visible_line = findLine(first + int(getClientHeight()) - 1);
+  adjustViewport (int(getCount()));
+}
+
+//----------------------------------------------------------------------
+void FListView::loadChildren (FListViewItem* item)
+{
+  if ( ! lazy_load.loader )
+  {
+    item->load_state = FListViewItem::LoadState::Populated;
+    item->expandable = item->hasChildren();
+    return;
+  }
+
+  if ( lazy_load.mode == LoadMode::Sync )
+  {
+    const auto rows = lazy_load.loader(item->column_list);
+    item->load_state = FListViewItem::LoadState::Populated;
+    insertChildRows (item, rows);
+    lazy_load.populated.push_back(item);
+    lazy_load.loaded_items += rows.size();
+    evictLazyItems(item);
+    return;
+  }
+
+  // Show a placeholder line until the worker thread has finished
+  item->load_state = FListViewItem::LoadState::Loading;
+  item->load_request = ++lazy_load.last_request;
+  lazy_load.pending[item->load_request] = item;
+  insertChildRows (item, ChildRows{ChildRow{FStringList{lazy_load.loading_text}}});
+
+  if ( ! lazy_load.queue )
+    lazy_load.queue = std::make_shared<LoadResultQueue>();
+
+  auto queue = lazy_load.queue;
+  auto loader = lazy_load.loader;
+  auto columns = item->column_list;
+  const auto request = item->load_request;
+
+  std::thread
+  {
+    [queue, loader, columns, request] ()
+    {
+      // std::clog is not thread-safe, so errors
+      // are passed on with the result
+      LoadResult result{request, {}, {}};
+
+      try
+      {
+        result.rows = loader(columns);
+      }
+      catch (const std::exception& ex)
+      {
+        result.error = std::string("Exception in the child loader: ")
+                     + ex.what();
+      }
+      catch (...)
+      {
+        // An exception must not leave the thread (std::terminate)
+        result.error = "Unknown exception in the child loader";
+      }
+
+      std::lock_guard<std::mutex> lock_guard(queue->mutex);
+      queue->results.push_back(std::move(result));
+    }
+  }.detach();
+
+  if ( lazy_load.timer_id == 0 )
+    lazy_load.timer_id = addTimer(50);  // Poll the results every 50 ms
+}
+
+//----------------------------------------------------------------------
+void FListView::insertChildRows (FListViewItem* item, const ChildRows& rows)
+{
+  // Appends the rows as children of the item without
+  // moving the selection or the visible area
+
+  std::size_t line_width{0};
+
+  for (const auto& row : rows)
+  {
+    auto child = new FListViewItem (row.columns, nullptr, getNullIterator());
+    item->insert (child);
+    child->setLazy (row.lazy);
+    line_width = std::max(line_width, determineLineWidth(child));
+  }
+
+  recalculateHorizontalBar (line_width);
+
+  if ( sorting.column > 0 && sorting.column <= int(data.header.size()) )
+    item->sort(getSortComparator());
+}
+
+//----------------------------------------------------------------------
+void FListView::processLoadResults()
+{
+  std::vector<LoadResult> results{};
+
+  {
+    std::lock_guard<std::mutex> lock_guard(lazy_load.queue->mutex);
+    std::swap (results, lazy_load.queue->results);
+  }
+
+  for (auto&& result : results)
+  {
+    if ( ! result.error.empty() )
+      std::clog << FLog::LogLevel::Error << result.error;
+
+    const auto iter = lazy_load.pending.find(result.request);
+
+    if ( iter == lazy_load.pending.end() )
+      continue;  // The item was removed in the meantime
+
+    auto item = iter->second;
+    lazy_load.pending.erase(iter);
+    const FListViewItem* current = getCurrentItem();
+    const int ry = selection.current_iter.getPosition()
+                 - scroll.first_visible_line.getPosition();
+
+    if ( item->hasChildren() )
+    {
+      // Remove the placeholder
+      auto placeholder = static_cast<FListViewItem*>(item->front());
+
+      if ( current == placeholder )
+        current = item;
+
+      item->delChild(placeholder);
+      delete placeholder;
+    }
+
+    item->load_state = FListViewItem::LoadState::Populated;
+    insertChildRows (item, result.rows);
+    item->resetVisibleLineCounter();
+    lazy_load.populated.push_back(item);
+    lazy_load.loaded_items += result.rows.size();
+
+    if ( ! item->hasChildren() )
+    {
+      item->expandable = false;
+      item->is_expand = false;
+    }
+
+    restoreLinePositions (current, ry);
+    evictLazyItems(nullptr);
+  }
+
+  if ( lazy_load.pending.empty() )
+  {
+    delTimer (lazy_load.timer_id);
+    lazy_load.timer_id = 0;
+  }
+
+  adjustScrollbars (getCount());
+
+  if ( isShown() )
+    draw();
+
+  forceTerminalUpdate();
+}
+
+//----------------------------------------------------------------------
+void FListView::touchLazyItem (FListViewItem* item)
+{
+  // Marks the item as the most recently used
+
+  auto& populated = lazy_load.populated;
+  const auto iter = std::find(populated.begin(), populated.end(), item);
+
+  if ( iter != populated.end() )
+    populated.splice (populated.end(), populated, iter);
+}
+
+//----------------------------------------------------------------------
+void FListView::evictLazyItems (const FListViewItem* keep)
+{
+  // Unloads collapsed lazy subtrees until the
+  // number of loaded items fits into the limit
+
+  if ( lazy_load.item_limit == 0 )
+    return;
+
+  auto is_in_subtree = [this] (const FListViewItem* item)
+  {
+    // Checks whether one of the line iterators points into the subtree
+    for (auto&& line : { selection.current_iter
+                       , scroll.first_visible_line
+                       , scroll.last_visible_line })
+    {
+      if ( isItemListEmpty() || line == getNullIterator() )
+        continue;
+
+      for (auto obj = (*line)->getParent(); obj; obj = obj->getParent())
+        if ( obj == item )
+          return true;
+    }
+
+    return false;
+  };
+
+  auto& populated = lazy_load.populated;
+  auto iter = populated.begin();
+
+  while ( lazy_load.loaded_items > lazy_load.item_limit
+       && iter != populated.end() )
+  {
+    auto item = *iter;
+
+    if ( item == keep || item->isExpand() || is_in_subtree(item) )
+    {
+      ++iter;
+      continue;
+    }
+
+    populated.erase(iter);
+    lazy_load.loaded_items -= std::min ( item->numOfChildren()
+                                       , lazy_load.loaded_items );
+
+    for (auto&& child : item->getChildren())
+      forgetLazyItems(static_cast<FListViewItem*>(child));
+
+    while ( item->hasChildren() )
+    {
+      // Detach from the back so that each removal is constant
+      auto child = item->back();
+      item->delChild(child);
+      delete child;
+    }
+
+    item->load_state = FListViewItem::LoadState::Unloaded;
+    item->resetVisibleLineCounter();
+    iter = populated.begin();  // forgetLazyItems() may have removed entries
+  }
+}
+
+//----------------------------------------------------------------------
+void FListView::forgetLazyItems (FListViewItem* item)
+{
+  // Drops the lazy loading state of an item subtree
+  // before its removal or destruction
+
+  if ( lazy_load.populated.empty() && lazy_load.pending.empty() )
+    return;
+
+  auto is_in_subtree = [item] (const FObject* node)
+  {
+    for (auto obj = node; obj; obj = obj->getParent())
+      if ( obj == item )
+        return true;
+
+    return false;
+  };
+
+  auto& pending = lazy_load.pending;
+
+  for (auto iter = pending.begin(); iter != pending.end();)
+  {
+    if ( is_in_subtree(iter->second) )
+    {
+      iter->second->load_state = FListViewItem::LoadState::Unloaded;
+      iter = pending.erase(iter);
+    }
+    else
+      ++iter;
+  }
+
+  // Search by ancestry, since the lazy flag of
+  // a populated item could have been reset
+  auto& populated = lazy_load.populated;
+
+  for (auto iter = populated.begin(); iter != populated.end();)
+  {
+    auto node = *iter;
+
+    if ( is_in_subtree(node) )
+    {
+      lazy_load.loaded_items -= std::min ( node->numOfChildren()
+                                         , lazy_load.loaded_items );
+
+      if ( node->isLazy() )
+        node->load_state = FListViewItem::LoadState::Unloaded;
+
+      iter = populated.erase(iter);
+    }
+    else
+      ++iter;
+  }
+}
+
 //----------------------------------------------------------------------
 auto FListView::determineLineWidth (FListViewItem* item) -> std::size_t
 {
@@ -2202,7 +2735,11 @@ auto FListView::determineLineWidth (FListViewItem* item) -> std::size_t
 inline void FListView::beforeInsertion (FListViewItem* item)
 {
   std::size_t line_width = determineLineWidth (item);
-  recalculateHorizontalBar (line_width);
+
+  if ( isUpdating() )
+    update.line_width = std::max(update.line_width, line_width);
+  else
+    recalculateHorizontalBar (line_width);
 }
 
 //----------------------------------------------------------------------
@@ -2211,11 +2748,28 @@ inline void FListView::afterInsertion()
   if ( data.itemlist.size() == 1 )  // Select first item on insert
     selection.current_iter = data.itemlist.begin();
 
+  if ( isUpdating() )
+  {
+    update.inserted = true;
+    return;
+  }
+
   // The visible area of the list begins with the first element
   scroll.first_visible_line = data.itemlist.begin();
 
-  // Sort list by a column (only if activated)
+  // Sort list by a column (only if activated).
+  // The change is notified only once below.
+  update.in_sort = true;
   sort();
+  update.in_sort = false;
+
+  if ( ! isItemListEmpty() )
+  {
+    // Appending can reallocate the item list, so the current
+    // and the last visible line are searched again
+    selection.current_iter = findLine(selection.current_iter.getPosition());
+    scroll.last_visible_line = findLine(int(getClientHeight()) - 1);
+  }
 
   const std::size_t element_count = getCount();
   recalculateVerticalBar (element_count);
@@ -2431,7 +2985,7 @@ void FListView::dragUp (MouseButton mouse_button)
   if ( ! scroll.timer && selection.current_iter.getPosition() > 0 )
   {
     scroll.timer = true;
-    addTimer(scroll.repeat);
+    scroll.timer_id = addTimer(scroll.repeat);
 
     if ( mouse_button == MouseButton::Right )
       drag_scroll = DragScrollMode::SelectUpward;
@@ -2441,7 +2995,7 @@ void FListView::dragUp (MouseButton mouse_button)
 
   if ( selection.current_iter.getPosition() == 0 )
   {
-    delOwnTimers();
+    delTimer (scroll.timer_id);
     drag_scroll = DragScrollMode::None;
   }
 }
@@ -2456,7 +3010,7 @@ void FListView::dragDown (MouseButton mouse_button)
   if ( ! scroll.timer && selection.current_iter.getPosition() <= int(getCount()) )
   {
     scroll.timer = true;
-    addTimer(scroll.repeat);
+    scroll.timer_id = addTimer(scroll.repeat);
 
     if ( mouse_button == MouseButton::Right )
       drag_scroll = DragScrollMode::SelectDownward;
@@ -2466,7 +3020,7 @@ void FListView::dragDown (MouseButton mouse_button)
 
   if ( selection.current_iter.getPosition() - 1 == int(getCount()) )
   {
-    delOwnTimers();
+    delTimer (scroll.timer_id);
     drag_scroll = DragScrollMode::None;
   }
 }
@@ -2474,7 +3028,7 @@ void FListView::dragDown (MouseButton mouse_button)
 //----------------------------------------------------------------------
 inline void FListView::stopDragScroll()
 {
-  delOwnTimers();
+  delTimer (scroll.timer_id);
   scroll.timer = false;
   scroll.distance = 1;
   drag_scroll = DragScrollMode::None;
@@ -2530,6 +3084,7 @@ auto FListView::appendItem (FListViewItem* item) -> FObject::iterator
   item->root = data.root;
   addChild (item);
   data.itemlist.push_back (item);
+  resetLineOffsets();
   return --data.itemlist.end();
 }
 
@@ -2587,13 +3142,18 @@ void FListView::processClick() const
 //----------------------------------------------------------------------
 void FListView::processRowChanged() const
 {
-  emitCallback("row-changed");
+  static const auto row_changed = FCallback::getSignalId("row-changed");
+  emitCallback(row_changed);
 }
 
 //----------------------------------------------------------------------
 void FListView::processChanged() const
 {
-  emitCallback("changed");
+  if ( update.in_sort )
+    return;
+
+  static const auto changed = FCallback::getSignalId("changed");
+  emitCallback(changed);
 }
 
 //----------------------------------------------------------------------
@@ -2709,10 +3269,11 @@ inline void FListView::firstPos()
   if ( isItemListEmpty() )
     return;
 
-  selection.current_iter -= selection.current_iter.getPosition();
-  const int difference = scroll.first_visible_line.getPosition();
-  scroll.first_visible_line -= difference;
-  scroll.last_visible_line -= difference;
+  const int last = scroll.last_visible_line.getPosition()
+                 - scroll.first_visible_line.getPosition();
+  selection.current_iter = data.itemlist.begin();
+  scroll.first_visible_line = data.itemlist.begin();
+  moveToLine (scroll.last_visible_line, last);
 }
 
 //----------------------------------------------------------------------
@@ -2722,10 +3283,11 @@ inline void FListView::lastPos()
     return;
 
   const auto element_count = int(getCount());
-  selection.current_iter += element_count - selection.current_iter.getPosition() - 1;
   const int difference = element_count - scroll.last_visible_line.getPosition() - 1;
-  scroll.first_visible_line += difference;
-  scroll.last_visible_line += difference;
+  moveToLine (selection.current_iter, element_count - 1);
+  moveToLine ( scroll.first_visible_line
+             , scroll.first_visible_line.getPosition() + difference );
+  moveToLine (scroll.last_visible_line, element_count - 1);
 }
 
 //----------------------------------------------------------------------
@@ -2821,28 +3383,19 @@ void FListView::stepForward (int distance)
   if ( selection.current_iter.getPosition() + 1 == element_count )
     return;
 
-  if ( selection.current_iter.getPosition() + distance < element_count )
-  {
-    selection.current_iter += distance;
-  }
-  else
-  {
-    selection.current_iter += element_count - selection.current_iter.getPosition() - 1;
-  }
+  const int target = std::min ( selection.current_iter.getPosition() + distance
+                              , element_count - 1 );
+  moveToLine (selection.current_iter, target);
 
   if ( selection.current_iter.getPosition() > scroll.last_visible_line.getPosition() )
   {
-    if ( scroll.last_visible_line.getPosition() + distance < element_count )
-    {
-      scroll.first_visible_line += distance;
-      scroll.last_visible_line += distance;
-    }
-    else
-    {
-      const int differenz = element_count - scroll.last_visible_line.getPosition() - 1;
-      scroll.first_visible_line += differenz;
-      scroll.last_visible_line += differenz;
-    }
+    const int differenz = std::min ( distance
+                                   , element_count
+                                     - scroll.last_visible_line.getPosition() - 1 );
+    moveToLine ( scroll.first_visible_line
+               , scroll.first_visible_line.getPosition() + differenz );
+    moveToLine ( scroll.last_visible_line
+               , scroll.last_visible_line.getPosition() + differenz );
   }
 }
 
@@ -2852,28 +3405,17 @@ void FListView::stepBackward (int distance)
   if ( isItemListEmpty() || selection.current_iter.getPosition() == 0 )
     return;
 
-  if ( selection.current_iter.getPosition() - distance >= 0 )
-  {
-    selection.current_iter -= distance;
-  }
-  else
-  {
-    selection.current_iter -= selection.current_iter.getPosition();
-  }
+  const int target = std::max (selection.current_iter.getPosition() - distance, 0);
+  moveToLine (selection.current_iter, target);
 
   if ( selection.current_iter.getPosition() < scroll.first_visible_line.getPosition() )
   {
-    if ( scroll.first_visible_line.getPosition() - distance >= 0 )
-    {
-      scroll.first_visible_line -= distance;
-      scroll.last_visible_line -= distance;
-    }
-    else
-    {
-      const int difference = scroll.first_visible_line.getPosition();
-      scroll.first_visible_line -= difference;
-      scroll.last_visible_line -= difference;
-    }
+    const int difference = std::min ( distance
+                                    , scroll.first_visible_line.getPosition() );
+    moveToLine ( scroll.first_visible_line
+               , scroll.first_visible_line.getPosition() - difference );
+    moveToLine ( scroll.last_visible_line
+               , scroll.last_visible_line.getPosition() - difference );
   }
 }
 
@@ -2907,16 +3449,18 @@ void FListView::scrollToY (int y)
 
   if ( y + pagesize <= element_count )
   {
-    scroll.first_visible_line = data.itemlist.begin() + y;
+    scroll.first_visible_line = findLine(y);
     setRelativePosition (ry);
     scroll.last_visible_line = scroll.first_visible_line + pagesize;
   }
   else
   {
     const int differenz = element_count - scroll.last_visible_line.getPosition() - 1;
-    selection.current_iter += differenz;
-    scroll.first_visible_line += differenz;
-    scroll.last_visible_line += differenz;
+    moveToLine ( selection.current_iter
+               , selection.current_iter.getPosition() + differenz );
+    moveToLine ( scroll.first_visible_line
+               , scroll.first_visible_line.getPosition() + differenz );
+    moveToLine (scroll.last_visible_line, element_count - 1);
   }
 }
 
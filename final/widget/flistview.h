@@ -48,8 +48,11 @@
 #endif
 
 #include <iterator>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <stack>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -104,10 +107,12 @@ class FListViewItem : public FObject
     void setData (DT&&);
     void setCheckable (bool = true);
     void setChecked (bool = true);
+    void setLazy (bool = true);
 
     // Inquiry
     auto isChecked() const -> bool;
     auto isExpand() const -> bool;
+    auto isLazy() const -> bool;
 
     // Methods
     auto insert (FListViewItem*) -> iterator;
@@ -119,6 +124,15 @@ class FListViewItem : public FObject
   private:
     // Using-declaration
     using FDataAccessPtr = std::shared_ptr<FDataAccess>;
+    using LineOffsets = std::vector<std::size_t>;
+
+    // Enumeration
+    enum class LoadState : uInt8
+    {
+      Populated,  // Children are present (or the item is not lazy)
+      Unloaded,   // Children are fetched on the next expand
+      Loading     // An asynchronous fetch is running
+    };
 
     // Inquiry
     auto isExpandable() const -> bool;
@@ -130,17 +144,22 @@ class FListViewItem : public FObject
     auto appendItem (FListViewItem*) -> iterator;
     void replaceControlCodes();
     auto getVisibleLines() -> std::size_t;
+    auto getChildLineOffsets() -> const LineOffsets&;
     void resetVisibleLineCounter();
 
     // Data members
     FStringList     column_list{};
     FDataAccessPtr  data_pointer{};
     iterator        root{};
+    LineOffsets     child_line_offsets{};  // Lines before each child
     std::size_t     visible_lines{1};
+    std::size_t     load_request{0};
+    LoadState       load_state{LoadState::Populated};
     bool            expandable{false};
     bool            is_expand{false};
     bool            checkable{false};
     bool            is_checked{false};
+    bool            lazy{false};
 
     // Friend class
     friend class FListView;
@@ -200,6 +219,10 @@ inline auto FListViewItem::isChecked() const -> bool
 inline auto FListViewItem::isExpand() const -> bool
 { return is_expand; }
 
+//----------------------------------------------------------------------
+inline auto FListViewItem::isLazy() const -> bool
+{ return lazy; }
+
 //----------------------------------------------------------------------
 inline auto FListViewItem::isExpandable() const -> bool
 { return expandable; }
@@ -260,6 +283,9 @@ class FListViewIterator
    friend auto operator + (const FListViewIterator&, int) -> FListViewIterator;
    friend auto operator - (const FListViewIterator&, int) -> FListViewIterator;
 
+    // Friend class
+    friend class FListView;
+
   private:
     // Methods
     void nextElement (Iterator&);
@@ -317,6 +343,22 @@ class FListView : public FWidget
     using FWidget::setGeometry;
     using FListViewItems = std::vector<FListViewItem*>;
 
+    struct ChildRow
+    {
+      FStringList  columns{};
+      bool         lazy{false};  // The row has children to load
+    };
+
+    using ChildRows = std::vector<ChildRow>;
+    using ChildLoader = std::function<ChildRows(const FStringList&)>;
+
+    // Enumeration
+    enum class LoadMode
+    {
+      Sync,   // The loader runs inside expand()
+      Async   // The loader runs in a worker thread
+    };
+
     // Disable copy constructor
     FListView (const FListView&) = delete;
 
@@ -345,6 +387,7 @@ class FListView : public FWidget
     auto getSortOrder() const -> SortOrder;
     auto getSortColumn() const -> int;
     auto getCurrentItem() -> FListViewItem*;
+    auto getLoadingText() const -> FString;
 
     // Mutators
     void setSize (const FSize&, bool = true) override;
@@ -363,9 +406,13 @@ class FListView : public FWidget
     void hideColumn (int);
     void setTreeView (bool = true);
     void unsetTreeView();
+    void setChildLoader (ChildLoader&&, LoadMode = LoadMode::Sync);
+    void setLazyItemLimit (std::size_t);
+    void setLoadingText (const FString&);
 
     // Inquiries
     auto isColumnHidden (int) const -> bool;
+    auto isUpdating() const -> bool;
 
     // Methods
     virtual auto addColumn (const FString&, int = USE_MAX_SIZE) -> int;
@@ -397,6 +444,8 @@ class FListView : public FWidget
     auto insert (const std::vector<ColT>&, DT&&, iterator) -> iterator;
     void remove (FListViewItem*);
     void clear();
+    void beginUpdate();
+    void endUpdate();
     auto getData() & -> FListViewItems&;
     auto getData() const & -> const FListViewItems&;
 
@@ -427,6 +476,8 @@ class FListView : public FWidget
     using KeyMapResult = std::unordered_map<FKey, std::function<bool()>, EnumHash<FKey>>;
     using HeaderItems = std::vector<Header>;
     using SortTypes = std::vector<SortType>;
+    using LineOffsets = std::vector<std::size_t>;
+    using SortComparator = std::function<bool(const FObject*, const FObject*)>;
 
     struct ListViewData
     {
@@ -464,10 +515,46 @@ class FListView : public FWidget
       int                first_line_position_before{-1};
       int                xoffset{0};
       bool               timer{false};
+      int                timer_id{0};
       int                repeat{100};
       int                distance{1};
     };
 
+    struct LoadResult
+    {
+      std::size_t  request{0};
+      ChildRows    rows{};
+      std::string  error{};  // Logged by the UI thread
+    };
+
+    struct LoadResultQueue
+    {
+      std::mutex               mutex{};
+      std::vector<LoadResult>  results{};
+    };
+
+    struct LazyLoadState
+    {
+      ChildLoader  loader{};
+      LoadMode     mode{LoadMode::Sync};
+      std::size_t  item_limit{0};    // 0 = no limit for loaded items
+      std::size_t  loaded_items{0};  // Children of populated lazy items
+      std::size_t  last_request{0};
+      int          timer_id{0};
+      FString      loading_text{"Loading..."};  // Placeholder line
+      std::list<FListViewItem*>  populated{};  // Least recently used first
+      std::unordered_map<std::size_t, FListViewItem*>  pending{};
+      std::shared_ptr<LoadResultQueue>  queue{};
+    };
+
+    struct UpdateState
+    {
+      std::size_t  depth{0};       // Nesting level of beginUpdate()
+      std::size_t  line_width{0};  // Widest inserted line
+      bool         inserted{false};
+      bool         in_sort{false};   // sort() called by afterInsertion()
+    };
+
     // Constants
     static constexpr std::size_t checkbox_space = 4;
 
@@ -490,6 +577,7 @@ class FListView : public FWidget
     void processKeyAction (FKeyEvent*);
     template <typename Compare>
     void sort (Compare);
+    auto getSortComparator() const -> SortComparator;
     auto getAlignOffset ( const Align
                         , const std::size_t
                         , const std::size_t ) const -> std::size_t;
@@ -515,6 +603,18 @@ class FListView : public FWidget
                             , const FString& );
     void updateLayout();
     void updateDrawing (bool, bool);
+    auto getLineOffsets() const -> const LineOffsets&;
+    void resetLineOffsets() const;
+    auto findLine (int) -> FListViewIterator;
+    void moveToLine (FListViewIterator&, int);
+    auto getItemLine (const FListViewItem*) -> int;
+    void restoreLinePositions (const FListViewItem*, int);
+    void loadChildren (FListViewItem*);
+    void insertChildRows (FListViewItem*, const ChildRows&);
+    void processLoadResults();
+    void touchLazyItem (FListViewItem*);
+    void evictLazyItems (const FListViewItem*);
+    void forgetLazyItems (FListViewItem*);
     auto determineLineWidth (FListViewItem*) -> std::size_t;
     void beforeInsertion (FListViewItem*);
     void afterInsertion();
@@ -569,15 +669,18 @@ class FListView : public FWidget
     void cb_hbarChange (const FWidget*);
 
     // Data members
-    std::size_t     nf_offset{0};
-    std::size_t     max_line_width{1};
-    bool            tree_view{false};
-    bool            has_checkable_items{false};
-    ListViewData    data{};
-    SortState       sorting{};
-    ScrollingState  scroll{};
-    SelectionState  selection{};
-    DragScrollMode  drag_scroll{DragScrollMode::None};
+    std::size_t          nf_offset{0};
+    std::size_t          max_line_width{1};
+    bool                 tree_view{false};
+    bool                 has_checkable_items{false};
+    ListViewData         data{};
+    mutable LineOffsets  line_offsets{};  // Lines before each top-level item
+    SortState            sorting{};
+    ScrollingState       scroll{};
+    SelectionState       selection{};
+    UpdateState          update{};
+    LazyLoadState        lazy_load{};
+    DragScrollMode       drag_scroll{DragScrollMode::None};
 
     // Function Pointer
     bool (*user_defined_ascending) (const FObject*, const FObject*){nullptr};
@@ -622,6 +725,10 @@ inline auto FListView::getSortColumn() const -> int
 inline auto FListView::getCurrentItem() -> FListViewItem*
 { return static_cast<FListViewItem*>(*selection.current_iter); }
 
+//----------------------------------------------------------------------
+inline auto FListView::getLoadingText() const -> FString
+{ return lazy_load.loading_text; }
+
 //----------------------------------------------------------------------
 template <typename Compare>
 inline void FListView::setUserAscendingCompare (Compare cmp)
@@ -632,6 +739,10 @@ template <typename Compare>
 inline void FListView::setUserDescendingCompare (Compare cmp)
 { user_defined_descending = cmp; }
 
+//----------------------------------------------------------------------
+inline void FListView::setLoadingText (const FString& text)
+{ lazy_load.loading_text = text; }
+
 //----------------------------------------------------------------------
 inline void FListView::hideSortIndicator (bool hide)
 { sorting.hide_sort_indicator = hide; }
@@ -644,6 +755,10 @@ inline void FListView::setTreeView (bool enable)
 inline void FListView::unsetTreeView()
 { setTreeView(false); }
 
+//----------------------------------------------------------------------
+inline auto FListView::isUpdating() const -> bool
+{ return update.depth > 0; }
+
 //----------------------------------------------------------------------
 inline auto FListView::insert (FListViewItem* item) -> FObject::iterator
 { return insert (item, data.root); }
@@ -398,7 +398,8 @@ void FScrollbar::onWheel (FWheelEvent* ev)
   else if ( wheel == MouseWheel::Right )
     scroll_type = ScrollType::WheelRight;
 
-  processScroll();
+  for (auto i{0}; i < ev->getDelta(); i++)
+    processScroll();
 }
 
 //----------------------------------------------------------------------
@@ -781,7 +782,8 @@ void FScrollbar::avoidScrollOvershoot()
 //----------------------------------------------------------------------
 void FScrollbar::processScroll()
 {
-  emitCallback("change-value");
+  static const auto change_value = FCallback::getSignalId("change-value");
+  emitCallback(change_value);
   avoidScrollOvershoot();
 }
 
@@ -530,7 +530,8 @@ void FScrollView::onMouseMove (FMouseEvent* ev)
 //----------------------------------------------------------------------
 void FScrollView::onWheel (FWheelEvent* ev)
 {
-  static constexpr int distance = 4;
+  static constexpr int wheel_distance = 4;
+  const int distance = wheel_distance * ev->getDelta();
 
   if ( ev->getWheel() == MouseWheel::Up )
   {
@@ -759,6 +760,9 @@ void FScrollView::copy2area()
     line_changes.xmax = std::max(line_changes.xmax, uInt(ax + x_end - 1));
   }
 
+  if ( y_end > 0 )
+    printarea->addChangedLines (ay, ay + y_end - 1);
+
   setViewportCursor();
   viewport->has_changes = false;
   printarea->has_changes = true;
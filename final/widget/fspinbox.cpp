@@ -238,12 +238,16 @@ void FSpinBox::onWheel (FWheelEvent* ev)
 
   if ( wheel == MouseWheel::Up )
   {
-    increaseValue();
+    for (auto i{0}; i < ev->getDelta(); i++)
+      increaseValue();
+
     updateInputField();
   }
   else if ( wheel == MouseWheel::Down )
   {
-    decreaseValue();
+    for (auto i{0}; i < ev->getDelta(); i++)
+      decreaseValue();
+
     updateInputField();
   }
 }
@@ -416,7 +420,8 @@ void FSpinBox::processActivate() const
 //----------------------------------------------------------------------
 void FSpinBox::processChanged() const
 {
-  emitCallback("changed");
+  static const auto changed = FCallback::getSignalId("changed");
+  emitCallback(changed);
 }
 
 //----------------------------------------------------------------------
@@ -20,6 +20,7 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <algorithm>
 #include <memory>
 
 #include "final/dialog/fdialog.h"
@@ -36,6 +37,157 @@
 namespace finalcut
 {
 
+//----------------------------------------------------------------------
+// class FTextView::FTextViewList
+//----------------------------------------------------------------------
+
+// public methods of FTextView::FTextViewList
+//----------------------------------------------------------------------
+auto FTextView::FTextViewList::getMaxWidth() const -> std::size_t
+{
+  std::size_t max_width{0};
+
+  for (const auto& chunk : chunks)
+    max_width = std::max(max_width, chunk.max_width);
+
+  return max_width;
+}
+
+//----------------------------------------------------------------------
+void FTextView::FTextViewList::insert ( size_type pos
+                                      , FTextViewLine&& line
+                                      , std::size_t width )
+{
+  if ( pos > line_count )
+    pos = line_count;
+
+  if ( pos == line_count
+    && (chunks.empty() || chunks.back().text_lines.size() >= MAX_CHUNK_LINES) )
+  {
+    // Appending starts a new chunk when the last one is full
+    chunks.emplace_back();
+    chunk_start.push_back(line_count);
+  }
+
+  const auto index = ( pos == line_count ) ? chunks.size() - 1 : findChunk(pos);
+  auto& chunk = chunks[index];
+  const auto offset = pos - chunk_start[index];
+  using distance_type = std::vector<FTextViewLine>::difference_type;
+  chunk.text_lines.emplace ( chunk.text_lines.begin() + distance_type(offset)
+                      , std::move(line) );
+  chunk.widths.insert ( chunk.widths.begin() + distance_type(offset)
+                      , width );
+  chunk.max_width = std::max(chunk.max_width, width);
+  line_count++;
+  updateChunkStart (index + 1);
+
+  if ( chunk.text_lines.size() > MAX_CHUNK_LINES )
+    splitChunk (index);
+}
+
+//----------------------------------------------------------------------
+void FTextView::FTextViewList::erase (size_type first, size_type last)
+{
+  // Removes the lines in the range [first, last)
+
+  if ( last > line_count )
+    last = line_count;
+
+  if ( first >= last )
+    return;
+
+  const auto first_chunk = findChunk(first);
+  auto index = first_chunk;
+  auto offset = first - chunk_start[index];
+  auto remaining = last - first;
+  using distance_type = std::vector<FTextViewLine>::difference_type;
+
+  while ( remaining > 0 )
+  {
+    auto& chunk = chunks[index];
+    const auto count = std::min(remaining, chunk.text_lines.size() - offset);
+    const auto begin = distance_type(offset);
+    const auto end = distance_type(offset + count);
+    chunk.text_lines.erase (chunk.text_lines.begin() + begin, chunk.text_lines.begin() + end);
+    chunk.widths.erase (chunk.widths.begin() + begin, chunk.widths.begin() + end);
+    remaining -= count;
+    line_count -= count;
+    offset = 0;
+
+    if ( chunk.text_lines.empty() )
+    {
+      chunks.erase (chunks.begin() + distance_type(index));
+      chunk_start.erase (chunk_start.begin() + distance_type(index));
+    }
+    else
+    {
+      chunk.max_width = *std::max_element(chunk.widths.cbegin(), chunk.widths.cend());
+      index++;
+    }
+  }
+
+  updateChunkStart (first_chunk);
+}
+
+//----------------------------------------------------------------------
+void FTextView::FTextViewList::clear()
+{
+  chunks.clear();
+  chunks.shrink_to_fit();
+  chunk_start.clear();
+  chunk_start.shrink_to_fit();
+  line_count = 0;
+}
+
+
+// private methods of FTextView::FTextViewList
+//----------------------------------------------------------------------
+auto FTextView::FTextViewList::findChunk (size_type line) const -> std::size_t
+{
+  // Binary search for the chunk that contains the line
+
+  const auto iter = std::upper_bound ( chunk_start.cbegin()
+                                     , chunk_start.cend()
+                                     , line );
+  return std::size_t(std::distance(chunk_start.cbegin(), iter)) - 1;
+}
+
+//----------------------------------------------------------------------
+void FTextView::FTextViewList::splitChunk (std::size_t index)
+{
+  // Moves the second half of an overfull chunk into a new chunk
+
+  using distance_type = std::vector<FTextViewLine>::difference_type;
+  const auto half = distance_type(chunks[index].text_lines.size() / 2);
+  FTextViewChunk new_chunk{};
+  auto& chunk = chunks[index];
+  std::move ( chunk.text_lines.begin() + half
+            , chunk.text_lines.end()
+            , std::back_inserter(new_chunk.text_lines) );
+  new_chunk.widths.assign (chunk.widths.begin() + half, chunk.widths.end());
+  chunk.text_lines.erase (chunk.text_lines.begin() + half, chunk.text_lines.end());
+  chunk.widths.erase (chunk.widths.begin() + half, chunk.widths.end());
+  chunk.max_width = *std::max_element(chunk.widths.cbegin(), chunk.widths.cend());
+  new_chunk.max_width = *std::max_element ( new_chunk.widths.cbegin()
+                                          , new_chunk.widths.cend() );
+  const auto next = distance_type(index + 1);
+  chunks.insert (chunks.begin() + next, std::move(new_chunk));
+  chunk_start.insert (chunk_start.begin() + next, 0);
+  updateChunkStart (index + 1);
+}
+
+//----------------------------------------------------------------------
+void FTextView::FTextViewList::updateChunkStart (std::size_t index)
+{
+  for (auto i = index; i < chunks.size(); i++)
+  {
+    chunk_start[i] = ( i == 0 )
+                     ? 0
+                     : chunk_start[i - 1] + chunks[i - 1].text_lines.size();
+  }
+}
+
+
 //----------------------------------------------------------------------
 // class FTextView
 //----------------------------------------------------------------------
@@ -120,6 +272,22 @@ void FTextView::setText (const FString& str)
   insert(str, -1);
 }
 
+//----------------------------------------------------------------------
+void FTextView::setLineLimit (std::size_t limit)
+{
+  // Limits the number of lines (0 = unlimited). When the limit
+  // is reached, the oldest lines are removed from the beginning.
+
+  line_limit = limit;
+
+  if ( line_limit == 0 || getRows() <= line_limit )
+    return;
+
+  removeExcessLines();
+  updateScrollbars();
+  processChanged();
+}
+
 //----------------------------------------------------------------------
 void FTextView::addHighlight (std::size_t line, const FTextHighlight& hgl)
 {
@@ -226,8 +394,8 @@ void FTextView::hide()
 //----------------------------------------------------------------------
 void FTextView::clear()
 {
+  closeFile();
   data.clear();
-  data.shrink_to_fit();
   xoffset = 0;
   yoffset = 0;
   max_line_width = 0;
@@ -274,73 +442,26 @@ void FTextView::append (const FString& str)
 }
 
 //----------------------------------------------------------------------
-void FTextView::insert (const FString& str, int pos)
+void FTextView::append (FStringList&& list)
 {
-  if ( pos < 0 || pos >= int(getRows()) )
-    pos = int(getRows());
+  // Appends several strings and updates the scroll bars only once
 
-  auto showHorizontallyScrollable = [this] ()
-  {
-    if ( isShown() && isHorizontallyScrollable() )
-      hbar->show();
-  };
+  FStringList line_list{};
 
-  auto&& text_split = \
-      [&str] ()
-      {
-        if ( str.isEmpty() )
-        {
-          FStringList list{};
-          list.emplace_back("");
-          return list;
-        }
-
-        const auto& string = str.rtrim().expandTabs(getFOutput()->getTabstop());
-        return string.split("\n");
-      }();
-
-  for (auto&& line : text_split)  // Line loop
+  for (const auto& str : list)
   {
-    line = line.removeBackspaces()
-               .removeDel()
-               .replaceControlCodes()
-               .rtrim();
-    const auto column_width = getColumnWidth(line);
-
-    if ( column_width > max_line_width )
-    {
-      max_line_width = column_width;
-
-      if ( column_width > getTextWidth() )
-      {
-        const int hmax = ( max_line_width > getTextWidth() )
-                         ? int(max_line_width) - int(getTextWidth())
-                         : 0;
-        hbar->setMaximum (hmax);
-        hbar->setPageSize (int(max_line_width), int(getTextWidth()));
-        hbar->calculateSliderValues();
-        showHorizontallyScrollable();
-      }
-    }
-
-    data.emplace (data.cbegin() + pos, std::move(line));
-    pos++;
+    auto split = splitText(str);
+    std::move (split.begin(), split.end(), std::back_inserter(line_list));
   }
 
-  const int vmax = ( getRows() > getTextHeight() )
-                   ? int(getRows()) - int(getTextHeight())
-                   : 0;
-  vbar->setMaximum (vmax);
-  vbar->setPageSize (int(getRows()), int(getTextHeight()));
-  vbar->calculateSliderValues();
-
-  if ( isShown() && ! vbar->isShown() && isVerticallyScrollable() )
-    vbar->show();
-
-  if ( isShown() && vbar->isShown() && ! isVerticallyScrollable() )
-    vbar->hide();
+  list.clear();
+  insertLines (std::move(line_list), -1);
+}
 
-  processChanged();
+//----------------------------------------------------------------------
+void FTextView::insert (const FString& str, int pos)
+{
+  insertLines (splitText(str), pos);
 }
 
 //----------------------------------------------------------------------
@@ -361,11 +482,51 @@ void FTextView::replaceRange (const FString& str, int from, int to)
 //----------------------------------------------------------------------
 void FTextView::deleteRange (int from, int to)
 {
+  closeFile();  // The lines of a file cannot be deleted
+
   if ( from > to || from >= int(getRows()) || to >= int(getRows()) )
     throw std::out_of_range("");  // Invalid range
 
-  auto iter = data.cbegin();
-  data.erase (iter + from, iter + to + 1);
+  data.erase (std::size_t(from), std::size_t(to) + 1);
+  max_line_width = data.getMaxWidth();
+  updateScrollbars();
+}
+
+//----------------------------------------------------------------------
+auto FTextView::openFile (const std::string& file_name) -> bool
+{
+  // Shows a UTF-8 text file without reading it into memory.
+  // The line index is built step by step in timer events,
+  // and only the visible lines are decoded.
+
+  clear();
+  auto file = std::make_unique<FMappedTextFile>();
+
+  if ( ! file->open(file_name) )
+    return false;
+
+  text_file = std::move(file);
+  indexFile();
+  file_timer_id = addTimer ( text_file->isIndexComplete()
+                             ? FILE_WATCH_INTERVAL
+                             : FILE_INDEX_INTERVAL );
+  return true;
+}
+
+//----------------------------------------------------------------------
+void FTextView::closeFile()
+{
+  if ( ! text_file )
+    return;
+
+  delTimer (file_timer_id);
+  file_timer_id = 0;
+  text_file.reset();
+  xoffset = 0;
+  yoffset = 0;
+  max_line_width = data.getMaxWidth();
+  updateScrollbars();
+  processChanged();
 }
 
 //----------------------------------------------------------------------
@@ -380,6 +541,23 @@ void FTextView::onKeyPress (FKeyEvent* ev)
   }
 }
 
+//----------------------------------------------------------------------
+void FTextView::onPaste (FPasteEvent* ev)
+{
+  // Append the pasted lines in one step
+  const auto& str = ev->getText().replace(L"\r\n", L"\n")
+                                 .replace(L"\r", L"\n");
+  append(str);
+  ev->accept();
+
+  if ( isShown() )
+  {
+    drawScrollbars();
+    drawText();
+    forceTerminalUpdate();
+  }
+}
+
 //----------------------------------------------------------------------
 void FTextView::onMouseDown (FMouseEvent* ev)
 {
@@ -411,7 +589,8 @@ void FTextView::onMouseMove (FMouseEvent* ev)
 //----------------------------------------------------------------------
 void FTextView::onWheel (FWheelEvent* ev)
 {
-  static constexpr int distance = 4;
+  static constexpr int wheel_distance = 4;
+  const int distance = wheel_distance * ev->getDelta();
   const auto& wheel = ev->getWheel();
 
   if ( wheel == MouseWheel::Up )
@@ -427,6 +606,25 @@ void FTextView::onWheel (FWheelEvent* ev)
     drawText();
 }
 
+//----------------------------------------------------------------------
+void FTextView::onTimer (FTimerEvent* ev)
+{
+  if ( ! text_file || ev->getTimerId() != file_timer_id )
+    return;
+
+  const bool was_complete = text_file->isIndexComplete();
+  indexFile();
+
+  if ( was_complete == text_file->isIndexComplete() )
+    return;
+
+  // Index less frequently once the entire file is indexed
+  delTimer (file_timer_id);
+  file_timer_id = addTimer ( text_file->isIndexComplete()
+                             ? FILE_WATCH_INTERVAL
+                             : FILE_INDEX_INTERVAL );
+}
+
 
 // protected methods of FTextView
 //----------------------------------------------------------------------
@@ -522,6 +720,19 @@ auto FTextView::getTextWidth() const -> std::size_t
   return getWidth() - 2 - std::size_t(nf_offset);
 }
 
+//----------------------------------------------------------------------
+auto FTextView::getFileLine (std::size_t line) const -> FString
+{
+  // Decodes only the bytes that can be in the visible columns
+  // (a UTF-8 character has at most 4 bytes)
+
+  const auto max_bytes = (std::size_t(xoffset) + getTextWidth()) * 4;
+  auto text = text_file->getLine(line, max_bytes)
+                        .expandTabs(getFOutput()->getTabstop());
+  cleanupLine (text);
+  return text;
+}
+
 //----------------------------------------------------------------------
 void FTextView::init()
 {
@@ -547,6 +758,175 @@ inline void FTextView::mapKeyFunctions()
   };
 }
 
+//----------------------------------------------------------------------
+auto FTextView::splitText (const FString& str) const -> FStringList
+{
+  if ( str.isEmpty() )
+  {
+    FStringList list{};
+    list.emplace_back("");
+    return list;
+  }
+
+  const auto& string = str.rtrim().expandTabs(getFOutput()->getTabstop());
+  return string.split("\n");
+}
+
+//----------------------------------------------------------------------
+void FTextView::cleanupLine (FString& line)
+{
+  auto hasNonPrintable = [] (const FString& str)
+  {
+    return std::any_of ( str.cbegin(), str.cend()
+                       , [] (wchar_t ch)
+                         {
+                           if ( ch >= L' ' && ch < L'\x7f' )
+                             return false;  // Printable ASCII
+
+                           return ch < L'\xa0' || ! std::iswprint(std::wint_t(ch));
+                         } );
+  };
+
+  // Skips the control code replacement for printable lines
+  if ( hasNonPrintable(line) )
+    line = line.removeBackspaces()
+               .removeDel()
+               .replaceControlCodes()
+               .rtrim();
+  else
+    line = line.rtrim();
+}
+
+//----------------------------------------------------------------------
+void FTextView::insertLines (FStringList&& line_list, int pos)
+{
+  closeFile();  // Inserted text replaces the file view
+
+  if ( pos < 0 || pos >= int(getRows()) )
+    pos = int(getRows());
+
+  const auto old_max_line_width = max_line_width;
+
+  for (auto&& line : line_list)  // Line loop
+  {
+    cleanupLine (line);
+    const auto column_width = getColumnWidth(line);
+    max_line_width = std::max(max_line_width, column_width);
+    data.insert (std::size_t(pos), FTextViewLine{std::move(line)}, column_width);
+    pos++;
+  }
+
+  removeExcessLines();
+
+  if ( max_line_width != old_max_line_width )
+    updateHorizontalScrollbar();
+
+  updateVerticalScrollbar();
+  processChanged();
+}
+
+//----------------------------------------------------------------------
+void FTextView::indexFile()
+{
+  // Extends the line index of the open file and follows
+  // the end of the file when it grows
+
+  const auto old_rows = getRows();
+  const auto old_max_line_width = max_line_width;
+  const bool was_complete = text_file->isIndexComplete();
+  const bool at_end = yoffset >= int(old_rows) - int(getTextHeight());
+
+  if ( was_complete )
+    text_file->refresh();  // Checks for a changed file size
+
+  text_file->buildIndex (FILE_INDEX_STEP);
+
+  if ( getRows() < old_rows )  // Truncated file
+    max_line_width = text_file->getMaxLineLength();
+  else  // Byte length as a width estimate until the line is drawn
+    max_line_width = std::max(max_line_width, text_file->getMaxLineLength());
+
+  if ( getRows() == old_rows && max_line_width == old_max_line_width )
+    return;
+
+  if ( max_line_width != old_max_line_width )
+    updateHorizontalScrollbar();
+
+  if ( was_complete && at_end && isVerticallyScrollable() )
+    yoffset = int(getRows() - getTextHeight());
+
+  updateVerticalScrollbar();
+  processChanged();
+
+  if ( isShown() )
+  {
+    drawScrollbars();
+    drawText();
+  }
+}
+
+//----------------------------------------------------------------------
+void FTextView::removeExcessLines()
+{
+  // Removes the oldest lines above the line limit
+
+  if ( text_file || line_limit == 0 || getRows() <= line_limit )
+    return;
+
+  const auto excess = getRows() - line_limit;
+  data.erase (0, excess);
+  yoffset = std::max(0, yoffset - int(excess));
+  max_line_width = data.getMaxWidth();
+}
+
+//----------------------------------------------------------------------
+void FTextView::updateScrollbars()
+{
+  updateHorizontalScrollbar();
+  updateVerticalScrollbar();
+}
+
+//----------------------------------------------------------------------
+void FTextView::updateHorizontalScrollbar()
+{
+  if ( ! isHorizontallyScrollable() )
+  {
+    xoffset = 0;
+
+    if ( isShown() && hbar->isShown() )
+      hbar->hide();
+
+    return;
+  }
+
+  const int hmax = int(max_line_width) - int(getTextWidth());
+  xoffset = std::min(xoffset, hmax);
+  hbar->setMaximum (hmax);
+  hbar->setPageSize (int(max_line_width), int(getTextWidth()));
+  hbar->setValue (xoffset);
+
+  if ( isShown() )
+    hbar->show();
+}
+
+//----------------------------------------------------------------------
+void FTextView::updateVerticalScrollbar()
+{
+  const int vmax = ( getRows() > getTextHeight() )
+                   ? int(getRows()) - int(getTextHeight())
+                   : 0;
+  yoffset = std::min(yoffset, vmax);
+  vbar->setMaximum (vmax);
+  vbar->setPageSize (int(getRows()), int(getTextHeight()));
+  vbar->setValue (yoffset);
+
+  if ( isShown() && ! vbar->isShown() && isVerticallyScrollable() )
+    vbar->show();
+
+  if ( isShown() && vbar->isShown() && ! isVerticallyScrollable() )
+    vbar->hide();
+}
+
 //----------------------------------------------------------------------
 void FTextView::draw()
 {
@@ -591,9 +971,11 @@ void FTextView::drawScrollbars() const
 //----------------------------------------------------------------------
 void FTextView::drawText()
 {
-  if ( data.empty() || getHeight() <= 2 || getWidth() <= 2 )
+  if ( getRows() == 0 || getHeight() <= 2 || getWidth() <= 2 )
     return;
 
+  const std::vector<FTextHighlight> no_highlight{};
+  const auto old_max_line_width = max_line_width;
   auto num = getTextHeight();
 
   if ( num > getRows() )
@@ -609,7 +991,9 @@ void FTextView::drawText()
     const std::size_t n = std::size_t(yoffset) + y;
     const std::size_t pos = std::size_t(xoffset) + 1;
     const auto text_width = getTextWidth();
-    const FString line(getColumnSubString(data[n].text, pos, text_width));
+    const FString file_line( text_file ? getFileLine(n) : FString{} );
+    const auto& text = ( text_file ) ? file_line : data[n].text;
+    const FString line(getColumnSubString(text, pos, text_width));
     print() << FPoint{2, 2 - nf_offset + int(y)};
     FVTermBuffer line_buffer{};
     line_buffer.print(line);
@@ -626,11 +1010,24 @@ void FTextView::drawText()
       line_buffer.print() << FString{trailing_whitespace, L' '};
     }
 
-    printHighlighted (line_buffer, data[n].highlight);
+    if ( text_file )
+    {
+      // Corrects the byte length estimate of the line width
+      max_line_width = std::max(max_line_width, getColumnWidth(text));
+      printHighlighted (line_buffer, no_highlight);
+    }
+    else
+      printHighlighted (line_buffer, data[n].highlight);
   }
 
   if ( FVTerm::getFOutput()->isMonochron() )
     setReverse(false);
+
+  if ( max_line_width != old_max_line_width )
+  {
+    updateHorizontalScrollbar();
+    hbar->redraw();
+  }
 }
 
 //----------------------------------------------------------------------
@@ -692,7 +1089,8 @@ inline auto FTextView::isPrintable (wchar_t ch) const -> bool
 //----------------------------------------------------------------------
 void FTextView::processChanged() const
 {
-  emitCallback("changed");
+  static const auto changed = FCallback::getSignalId("changed");
+  emitCallback(changed);
 }
 
 //----------------------------------------------------------------------
@@ -47,18 +47,19 @@
   #error "Only <final/final.h> can be included directly."
 #endif
 
+#include <algorithm>
+#include <iterator>
 #include <limits>
-#include <limits>
-#include <memory>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <utility>
-#include <utility>
 #include <vector>
 
 #include "final/fwidgetcolors.h"
 #include "final/fwidget.h"
+#include "final/util/fmappedtextfile.h"
 #include "final/util/fstring.h"
 #include "final/util/fstringstream.h"
 #include "final/vterm/fcolorpair.h"
@@ -152,8 +153,69 @@ class FTextView : public FWidget
       std::vector<FTextHighlight> highlight{};
     };
 
+    // Line storage in chunks of consecutive lines
+    class FTextViewList
+    {
+      private:
+        struct FTextViewChunk
+        {
+          std::vector<FTextViewLine> text_lines{};
+          std::vector<std::size_t>   widths{};  // Column width per line
+          std::size_t                max_width{0};
+        };
+
+        template <typename ChunkIterT, typename LineT>
+        class FLineIterator;
+
+      public:
+        // Using-declarations
+        using value_type = FTextViewLine;
+        using size_type = std::size_t;
+        using iterator = FLineIterator< std::vector<FTextViewChunk>::iterator
+                                      , FTextViewLine >;
+        using const_iterator = FLineIterator< std::vector<FTextViewChunk>::const_iterator
+                                            , const FTextViewLine >;
+
+        // Overloaded operators
+        auto operator [] (size_type) -> FTextViewLine&;
+        auto operator [] (size_type) const -> const FTextViewLine&;
+
+        // Accessors
+        auto size() const noexcept -> size_type;
+        auto at (size_type) -> FTextViewLine&;
+        auto at (size_type) const -> const FTextViewLine&;
+        auto getMaxWidth() const -> std::size_t;
+
+        // Inquiry
+        auto empty() const noexcept -> bool;
+
+        // Methods
+        auto begin() noexcept -> iterator;
+        auto end() noexcept -> iterator;
+        auto begin() const noexcept -> const_iterator;
+        auto end() const noexcept -> const_iterator;
+        void insert (size_type, FTextViewLine&&, std::size_t);
+        void erase (size_type, size_type);
+        void clear();
+
+      private:
+        // Constants
+        static constexpr std::size_t MAX_CHUNK_LINES = 512;
+
+        // Accessor
+        auto findChunk (size_type) const -> std::size_t;
+
+        // Methods
+        void splitChunk (std::size_t);
+        void updateChunkStart (std::size_t);
+
+        // Data members
+        std::vector<FTextViewChunk> chunks{};
+        std::vector<size_type>      chunk_start{};  // Index of the first line
+        size_type                   line_count{0};
+    };
+
     // Using-declarations
-    using FTextViewList = std::vector<FTextViewLine>;
     using FWidget::setGeometry;
 
     // Constructor
@@ -178,12 +240,15 @@ class FTextView : public FWidget
     auto getText() const -> FString;
     auto getLine (FTextViewList::size_type) -> FTextViewLine&;
     auto getLines() const & -> const FTextViewList&;
+    auto getLineLimit() const noexcept -> std::size_t;
+    auto getFileName() const -> std::string;
 
     // Mutators
     void setSize (const FSize&, bool = true) override;
     void setGeometry (const FPoint&, const FSize&, bool = true) override;
     void resetColors() override;
     void setText (const FString&);
+    void setLineLimit (std::size_t);
     void addHighlight (std::size_t, const FTextHighlight&);
     void resetHighlight (std::size_t);
     void scrollToX (int);
@@ -194,25 +259,33 @@ class FTextView : public FWidget
     void scrollToEnd();
     void scrollBy (int, int);
 
+    // Inquiry
+    auto isFileOpen() const -> bool;
+
     // Methods
     void hide() override;
     void clear();
     template <typename T>
     void append (const std::initializer_list<T>&);
     void append (const FString&);
+    void append (FStringList&&);
     template <typename T>
     void insert (const std::initializer_list<T>&, int);
     void insert (const FString&, int);
     void replaceRange (const FString&, int, int);
     void deleteRange (int, int);
     void deleteLine (int);
+    auto openFile (const std::string&) -> bool;
+    void closeFile();
 
     // Event handlers
     void onKeyPress (FKeyEvent*) override;
+    void onPaste (FPasteEvent*) override;
     void onMouseDown (FMouseEvent*) override;
     void onMouseUp (FMouseEvent*) override;
     void onMouseMove (FMouseEvent*) override;
     void onWheel (FWheelEvent*) override;
+    void onTimer (FTimerEvent*) override;
 
   protected:
     // Method
@@ -222,10 +295,17 @@ class FTextView : public FWidget
   private:
     // Using-declaration
     using KeyMap = std::unordered_map<FKey, std::function<void()>, EnumHash<FKey>>;
+    using FMappedTextFilePtr = std::unique_ptr<FMappedTextFile>;
+
+    // Constants
+    static constexpr std::size_t FILE_INDEX_STEP = 8 * 1024 * 1024;  // Bytes
+    static constexpr int FILE_INDEX_INTERVAL = 10;   // Milliseconds
+    static constexpr int FILE_WATCH_INTERVAL = 500;  // Milliseconds
 
     // Accessors
     auto getTextHeight() const -> std::size_t;
     auto getTextWidth() const -> std::size_t;
+    auto getFileLine (std::size_t) const -> FString;
 
     // Inquiry
     auto isHorizontallyScrollable() const -> bool;
@@ -234,6 +314,14 @@ class FTextView : public FWidget
     // Methods
     void init();
     void mapKeyFunctions();
+    auto splitText (const FString&) const -> FStringList;
+    static void cleanupLine (FString&);
+    void insertLines (FStringList&&, int);
+    void indexFile();
+    void removeExcessLines();
+    void updateScrollbars();
+    void updateHorizontalScrollbar();
+    void updateVerticalScrollbar();
     void draw() override;
     void drawBorder() override;
     void drawScrollbars() const;
@@ -250,17 +338,138 @@ class FTextView : public FWidget
     void cb_hbarChange (const FWidget*);
 
     // Data members
-    FTextViewList  data{};
-    FScrollbarPtr  vbar{nullptr};
-    FScrollbarPtr  hbar{nullptr};
-    KeyMap         key_map{};
-    bool           update_scrollbar{true};
-    int            xoffset{0};
-    int            yoffset{0};
-    int            nf_offset{0};
-    std::size_t    max_line_width{0};
+    FTextViewList      data{};
+    FMappedTextFilePtr text_file{};
+    FScrollbarPtr      vbar{nullptr};
+    FScrollbarPtr      hbar{nullptr};
+    KeyMap             key_map{};
+    bool               update_scrollbar{true};
+    int                xoffset{0};
+    int                yoffset{0};
+    int                nf_offset{0};
+    std::size_t        max_line_width{0};
+    std::size_t        line_limit{0};
+    int                file_timer_id{0};
 };
 
+// FTextView::FTextViewList::FLineIterator class
+//----------------------------------------------------------------------
+template <typename ChunkIterT, typename LineT>
+class FTextView::FTextViewList::FLineIterator
+{
+  public:
+    // Using-declarations
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = FTextViewLine;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = LineT*;
+    using reference         = LineT&;
+
+    // Constructors
+    FLineIterator() = default;
+    explicit FLineIterator (ChunkIterT chunk)
+      : chunk_iter{chunk}
+    { }
+
+    // Overloaded operators
+    auto operator * () const -> reference
+    { return chunk_iter->text_lines[line_pos]; }
+
+    auto operator -> () const -> pointer
+    { return &chunk_iter->text_lines[line_pos]; }
+
+    auto operator ++ () -> FLineIterator&
+    {
+      line_pos++;
+
+      if ( line_pos >= chunk_iter->text_lines.size() )
+      {
+        ++chunk_iter;
+        line_pos = 0;
+      }
+
+      return *this;
+    }
+
+    auto operator ++ (int) -> FLineIterator
+    {
+      FLineIterator tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    auto operator == (const FLineIterator& rhs) const -> bool
+    {
+      return chunk_iter == rhs.chunk_iter && line_pos == rhs.line_pos;
+    }
+
+    auto operator != (const FLineIterator& rhs) const -> bool
+    { return ! (*this == rhs); }
+
+  private:
+    // Data members
+    ChunkIterT  chunk_iter{};
+    std::size_t line_pos{0};
+};
+
+// FTextView::FTextViewList inline functions
+//----------------------------------------------------------------------
+inline auto FTextView::FTextViewList::operator [] (size_type line) -> FTextViewLine&
+{
+  const auto chunk = findChunk(line);
+  return chunks[chunk].text_lines[line - chunk_start[chunk]];
+}
+
+//----------------------------------------------------------------------
+inline auto FTextView::FTextViewList::operator [] (size_type line) const -> const FTextViewLine&
+{
+  const auto chunk = findChunk(line);
+  return chunks[chunk].text_lines[line - chunk_start[chunk]];
+}
+
+//----------------------------------------------------------------------
+inline auto FTextView::FTextViewList::size() const noexcept -> size_type
+{ return line_count; }
+
+//----------------------------------------------------------------------
+inline auto FTextView::FTextViewList::at (size_type line) -> FTextViewLine&
+{
+  if ( line >= line_count )
+    throw std::out_of_range("FTextViewList::at");
+
+  return (*this)[line];
+}
+
+//----------------------------------------------------------------------
+inline auto FTextView::FTextViewList::at (size_type line) const -> const FTextViewLine&
+{
+  if ( line >= line_count )
+    throw std::out_of_range("FTextViewList::at");
+
+  return (*this)[line];
+}
+
+//----------------------------------------------------------------------
+inline auto FTextView::FTextViewList::empty() const noexcept -> bool
+{ return line_count == 0; }
+
+//----------------------------------------------------------------------
+inline auto FTextView::FTextViewList::begin() noexcept -> iterator
+{ return iterator{chunks.begin()}; }
+
+//----------------------------------------------------------------------
+inline auto FTextView::FTextViewList::end() noexcept -> iterator
+{ return iterator{chunks.end()}; }
+
+//----------------------------------------------------------------------
+inline auto FTextView::FTextViewList::begin() const noexcept -> const_iterator
+{ return const_iterator{chunks.cbegin()}; }
+
+//----------------------------------------------------------------------
+inline auto FTextView::FTextViewList::end() const noexcept -> const_iterator
+{ return const_iterator{chunks.cend()}; }
+
+
 // FListBox inline functions
 //----------------------------------------------------------------------
 inline auto FTextView::operator = (const FString& s) -> FTextView&
@@ -306,7 +515,11 @@ inline auto FTextView::getColumns() const noexcept -> std::size_t
 
 //----------------------------------------------------------------------
 inline auto FTextView::getRows() const -> std::size_t
-{ return std::size_t(data.size()); }
+{
+  return ( text_file )
+         ? text_file->getLineCount()
+         : std::size_t(data.size());
+}
 
 //----------------------------------------------------------------------
 inline auto FTextView::getScrollPos() const -> FPoint
@@ -324,27 +537,50 @@ inline auto FTextView::getLine (FTextViewList::size_type line) -> FTextViewLine&
 inline auto FTextView::getLines() const & -> const FTextViewList&
 { return data; }
 
+//----------------------------------------------------------------------
+inline auto FTextView::getLineLimit() const noexcept -> std::size_t
+{ return line_limit; }
+
+//----------------------------------------------------------------------
+inline auto FTextView::getFileName() const -> std::string
+{ return ( text_file ) ? text_file->getFileName() : std::string{}; }
+
 //----------------------------------------------------------------------
 inline void FTextView::scrollTo (const FPoint& pos)
 { scrollTo(pos.getX(), pos.getY()); }
 
+//----------------------------------------------------------------------
+inline auto FTextView::isFileOpen() const -> bool
+{ return text_file != nullptr; }
+
 //----------------------------------------------------------------------
 template <typename T>
 void FTextView::append (const std::initializer_list<T>& list)
 {
+  FStringList line_list{};
+
   for (const auto& str : list)
-    insert(str, -1);
+  {
+    auto split = splitText(str);
+    std::move (split.begin(), split.end(), std::back_inserter(line_list));
+  }
+
+  insertLines (std::move(line_list), -1);
 }
 
 //----------------------------------------------------------------------
 template <typename T>
 void FTextView::insert (const std::initializer_list<T>& list, int pos)
 {
+  FStringList line_list{};
+
   for (const auto& str : list)
   {
-    insert(str, pos);
-    pos++;
+    auto split = splitText(str);
+    std::move (split.begin(), split.end(), std::back_inserter(line_list));
   }
+
+  insertLines (std::move(line_list), pos);
 }
 
 //----------------------------------------------------------------------
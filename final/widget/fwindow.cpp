@@ -301,7 +301,10 @@ void FWindow::drawBorder()
 void FWindow::show()
 {
   if ( isVirtualWindow() )
+  {
     getVWin()->visible = true;
+    invalidateOcclusionMap();
+  }
 
   FWidget::show();
 }
@@ -319,7 +322,10 @@ void FWindow::hide()
   }
 
   if ( isVirtualWindow() )
+  {
     virtual_win->visible = false;
+    invalidateOcclusionMap();
+  }
 
   FWidget::hide();
   const auto& t_geometry = getTermGeometryWithShadow();
@@ -332,7 +338,10 @@ void FWindow::setX (int x, bool adjust)
   FWidget::setX (x, adjust);
 
   if ( isVirtualWindow() )
+  {
     getVWin()->position.x = getTermX() - 1;
+    invalidateOcclusionMap();
+  }
 }
 
 //----------------------------------------------------------------------
@@ -344,7 +353,10 @@ void FWindow::setY (int y, bool adjust)
   FWidget::setY (y, adjust);
 
   if ( isVirtualWindow() )
+  {
     getVWin()->position.y = getTermY() - 1;
+    invalidateOcclusionMap();
+  }
 }
 
 //----------------------------------------------------------------------
@@ -362,6 +374,7 @@ void FWindow::setPos (const FPoint& p, bool adjust)
     auto virtual_win = getVWin();
     virtual_win->position.x = getTermX() - 1;
     virtual_win->position.y = getTermY() - 1;
+    invalidateOcclusionMap();
   }
 }
 
@@ -438,6 +451,8 @@ void FWindow::setGeometry ( const FPoint& p, const FSize& size, bool adjust)
 
     if ( getY() != old_y )
       getVWin()->position.y = getTermY() - 1;
+
+    invalidateOcclusionMap();
   }
 }
 
@@ -451,6 +466,7 @@ void FWindow::move (const FPoint& pos)
     auto virtual_win = getVWin();
     virtual_win->position.x = getTermX() - 1;
     virtual_win->position.y = getTermY() - 1;
+    invalidateOcclusionMap();
   }
 }
 
@@ -652,6 +668,7 @@ auto FWindow::minimizeWindow() -> bool
 
   const auto& virtual_win = getVWin();
   virtual_win->minimized = bool( ! isMinimized() );
+  invalidateOcclusionMap();
   const auto& t_geometry = getTermGeometryWithShadow();
   restoreVTerm (t_geometry);
 
@@ -756,6 +773,8 @@ void FWindow::adjustSize()
 
     if ( getTermY() != old_y )
       getVWin()->position.y = getTermY() - 1;
+
+    invalidateOcclusionMap();
   }
 }
 
@@ -0,0 +1,261 @@
+#!/usr/bin/env python3
+#
+# Generates the two-stage Unicode column width table
+# in final/output/tty/fcharwidth.h and final/output/tty/fcharwidth.cpp
+#
+# Usage: ./unicode_width.py
+#
+# The character properties come from the Unicode database of the
+# Python interpreter (unicodedata.unidata_version). The width rules
+# follow the wcwidth() implementation of the GNU C Library:
+#
+#   0 - NUL, non-printable characters, combining marks (Mn, Me),
+#       format characters (Cf), Hangul Jamo medial vowels and
+#       final consonants, and unassigned code points
+#   2 - East Asian Wide (W) and Fullwidth (F) characters
+#   1 - all other characters
+#
+
+import os
+import unicodedata
+
+BLOCK_SIZE = 256
+ENTRIES_PER_BYTE = 4  # 2 bits per character
+MAX_CODE_POINT = 0x10ffff
+
+# Prepended concatenation marks are visible format characters
+PREPENDED_CONCATENATION_MARKS = \
+    set(range(0x0600, 0x0606)) | {0x06dd, 0x070f, 0x0890, 0x0891,
+                                  0x08e2, 0x110bd, 0x110cd}
+
+# Unassigned code points in these ranges default to wide
+DEFAULT_WIDE_RANGES = ((0x3400, 0x4dbf), (0x4e00, 0x9fff),
+                       (0xf900, 0xfaff), (0x20000, 0x2fffd),
+                       (0x30000, 0x3fffd))
+
+# Wide in the GNU C Library despite their East Asian width property
+EXTRA_WIDE_RANGES = ((0x3248, 0x324f), (0x4dc0, 0x4dff))
+
+# Hangul Jamo medial vowels and final consonants
+ZERO_WIDTH_RANGES = ((0x1160, 0x11ff), (0xd7b0, 0xd7ff))
+
+
+def in_ranges (code_point, ranges):
+    return any(first <= code_point <= last for first, last in ranges)
+
+
+def column_width (code_point):
+    char = chr(code_point)
+    category = unicodedata.category(char)
+
+    if code_point == 0 or category in ('Cc', 'Cs', 'Zl', 'Zp'):
+        return 0
+
+    if category == 'Cn':
+        return 2 if in_ranges(code_point, DEFAULT_WIDE_RANGES) else 0
+
+    if category in ('Mn', 'Me') or in_ranges(code_point, ZERO_WIDTH_RANGES):
+        return 0
+
+    if category == 'Cf' and code_point != 0x00ad \
+       and code_point not in PREPENDED_CONCATENATION_MARKS:
+        return 0
+
+    if code_point == 0x200b:  # Zero width space
+        return 0
+
+    if unicodedata.east_asian_width(char) in ('W', 'F') \
+       or in_ranges(code_point, EXTRA_WIDE_RANGES):
+        return 2
+
+    return 1
+
+
+def build_tables ():
+    stage1 = []
+    stage2 = []
+    block_index = {}
+
+    for block_start in range(0, MAX_CODE_POINT + 1, BLOCK_SIZE):
+        packed = bytearray(BLOCK_SIZE // ENTRIES_PER_BYTE)
+
+        for offset in range(BLOCK_SIZE):
+            width = column_width(block_start + offset)
+            packed[offset // ENTRIES_PER_BYTE] |= \
+                width << (2 * (offset % ENTRIES_PER_BYTE))
+
+        key = bytes(packed)
+
+        if key not in block_index:
+            block_index[key] = len(stage2)
+            stage2.append(key)
+
+        stage1.append(block_index[key])
+
+    return stage1, stage2
+
+
+def format_bytes (values, per_line, indent):
+    lines = []
+
+    for pos in range(0, len(values), per_line):
+        chunk = values[pos:pos + per_line]
+        lines.append(indent + ', '.join('0x%02x' % v for v in chunk))
+
+    return ',\n'.join(lines)
+
+
+LICENSE = '''\
+/***********************************************************************
+* %-68s *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2023 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+'''
+
+HEADER = '''
+/*  Generated by scripts/unicode_width.py from the
+ *  Unicode %(version)s character database - do not edit!
+ *
+ *  Two-stage lookup table for the terminal column width
+ *  of Unicode characters:
+ *
+ *  stage1[code point / 256] → index of a 256 character block
+ *  stage2[block][offset / 4] → 4 × 2 bit column widths
+ */
+
+#ifndef FCHARWIDTH_H
+#define FCHARWIDTH_H
+
+#if !defined (USE_FINAL_H) && !defined (COMPILE_FINAL_CUT)
+  #error "Only <final/final.h> can be included directly."
+#endif
+
+#include <array>
+
+#include "final/ftypes.h"
+
+namespace finalcut
+{
+
+namespace internal
+{
+
+struct char_width_table
+{
+  // Using-declaration
+  using Stage1Type = std::array<uInt8, %(stage1_size)d>;
+  using Stage2Type = std::array<std::array<uInt8, %(block_bytes)d>, %(stage2_size)d>;
+
+  // Data members
+  static const Stage1Type stage1;
+  static const Stage2Type stage2;
+};
+
+}  // namespace internal
+
+//----------------------------------------------------------------------
+inline auto getUnicodeWidth (wchar_t wchar) noexcept -> uInt8
+{
+  // Returns the column width (0, 1 or 2) of a Unicode character
+  // without considering the terminal capabilities
+
+  using internal::char_width_table;
+  const auto ucs = uInt32(wchar);
+
+  if ( ucs > 0x%(max)x )
+    return 0;
+
+  const auto block = char_width_table::stage1[ucs >> 8];
+  const auto bits = char_width_table::stage2[block][(ucs & 0xff) >> 2];
+  return uInt8((bits >> ((ucs & 0x03) << 1)) & 0x03);
+}
+
+}  // namespace finalcut
+
+#endif  // FCHARWIDTH_H
+'''
+
+SOURCE = '''
+/*  Generated by scripts/unicode_width.py from the
+ *  Unicode %(version)s character database - do not edit!
+ */
+
+#include <array>
+
+#include "final/ftypes.h"
+#include "final/output/tty/fcharwidth.h"
+
+namespace finalcut
+{
+
+namespace internal
+{
+
+// Index of the 256 character block for each code point / 256
+//----------------------------------------------------------------------
+constexpr char_width_table::Stage1Type char_width_table::stage1 =
+{{
+%(stage1)s
+}};
+
+// Column widths with 2 bits per character (4 characters per byte)
+//----------------------------------------------------------------------
+constexpr char_width_table::Stage2Type char_width_table::stage2 =
+{{
+%(stage2)s
+}};
+
+}  // namespace internal
+
+}  // namespace finalcut
+'''
+
+
+def main ():
+    stage1, stage2 = build_tables()
+    base_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                            '..', 'final', 'output', 'tty')
+    values = {
+        'version': unicodedata.unidata_version,
+        'stage1_size': len(stage1),
+        'stage2_size': len(stage2),
+        'block_bytes': BLOCK_SIZE // ENTRIES_PER_BYTE,
+        'max': MAX_CODE_POINT,
+        'stage1': format_bytes(stage1, 16, '  '),
+        'stage2': ',\n'.join('  {{  // Block %d\n%s\n  }}'
+                             % (num, format_bytes(block, 8, '    '))
+                             for num, block in enumerate(stage2))
+    }
+
+    with open(os.path.join(base_dir, 'fcharwidth.h'), 'w') as header:
+        header.write(LICENSE % 'fcharwidth.h - Unicode column width table')
+        header.write(HEADER % values)
+
+    with open(os.path.join(base_dir, 'fcharwidth.cpp'), 'w') as source:
+        source.write(LICENSE % 'fcharwidth.cpp - Unicode column width table')
+        source.write(SOURCE % values)
+
+    print('Unicode %s: %d blocks, %d bytes'
+          % (values['version'], len(stage2),
+             len(stage1) + len(stage2) * values['block_bytes']))
+
+
+if __name__ == '__main__':
+    main()
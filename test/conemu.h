@@ -123,6 +123,7 @@ class ConEmu
   protected:
     // Mutators
     void  enableConEmuDebug (bool) noexcept;
+    void  setConEmuLatency (uInt64) noexcept;
 
     // Inquiries
     auto  isConEmuChildProcess (pid_t) const noexcept -> bool;
@@ -156,6 +157,7 @@ class ConEmu
     int                fd_master{-1};
     int                fd_slave{-1};
     bool               debug{false};
+    uInt64             latency{0};  // Reply delay in milliseconds
     char               buffer[2048]{};
     static bool*       shared_state;
     static const char* colorname[];
@@ -438,6 +440,13 @@ inline void ConEmu::enableConEmuDebug (bool enable) noexcept
   debug = enable;
 }
 
+//----------------------------------------------------------------------
+inline void ConEmu::setConEmuLatency (uInt64 milliseconds) noexcept
+{
+  // Simulates the round-trip time of a remote connection
+  latency = milliseconds;
+}
+
 //----------------------------------------------------------------------
 inline auto ConEmu::isConEmuChildProcess (pid_t pid) const noexcept -> bool
 {
@@ -634,6 +643,10 @@ inline void ConEmu::startConEmuTerminal (console con)
       if ( len > 0 )
       {
         buffer[len] = '\0';
+
+        if ( latency > 0 )
+          std::this_thread::sleep_for(std::chrono::milliseconds(latency));
+
         parseTerminalBuffer (len, con);
         time_last_data = finalcut::FObjectTimer::getCurrentTime();
       }
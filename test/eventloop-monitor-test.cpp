@@ -28,9 +28,11 @@
 #include <cppunit/TestResultCollector.h>
 #include <cppunit/TestRunner.h>
 
+#include <array>
 #include <chrono>
 #include <queue>
 #include <string>
+#include <vector>
 
 #include <final/final.h>
 #define USE_FINAL_H
@@ -226,6 +228,10 @@ class FSystemTest : public finalcut::FSystem
                        , const struct itimerspec*
                        , struct itimerspec* ) -> int override;
     auto timer_delete (timer_t) -> int override;
+    auto timerfd_create (int, int) -> int override;
+    auto timerfd_settime ( int, int
+                         , const struct itimerspec*
+                         , struct itimerspec* ) -> int override;
     auto kqueue() -> int override;
     auto kevent ( int, const struct kevent*
                 , int, struct kevent*
@@ -240,6 +246,8 @@ class FSystemTest : public finalcut::FSystem
     void setTimerCreateReturnValue (int);
     void setTimerSettimeReturnValue (int);
     void setTimerDeleteReturnValue (int);
+    void setTimerfdCreateReturnValue (int);
+    void setTimerfdSettimeReturnValue (int);
     void setKqueueReturnValue (int);
     void setKeventReturnValue (int);
 
@@ -249,6 +257,8 @@ class FSystemTest : public finalcut::FSystem
     int timer_create_ret_value{0};
     int timer_settime_ret_value{0};
     int timer_delete_ret_value{0};
+    int timerfd_create_ret_value{0};
+    int timerfd_settime_ret_value{0};
     int kqueue_ret_value{0};
     int kevent_ret_value{0};
 };
@@ -399,6 +409,26 @@ inline auto FSystemTest::timer_delete (timer_t timer_id) -> int
   return timer_delete_ret_value;
 }
 
+//----------------------------------------------------------------------
+inline auto FSystemTest::timerfd_create (int clockid, int flags) -> int
+{
+  std::cerr << "Call: timerfd_create (clockid=" << clockid
+            << ", flags=" << flags << ")\n";
+  return timerfd_create_ret_value;
+}
+
+//----------------------------------------------------------------------
+inline auto FSystemTest::timerfd_settime ( int fd, int flags
+                                         , const struct itimerspec* new_value
+                                         , struct itimerspec* old_value ) -> int
+{
+  std::cerr << "Call: timerfd_settime (fd=" << fd
+            << ", flags=" << flags
+            << ", new_value=" << new_value
+            << ", old_value=" << old_value << ")\n";
+  return timerfd_settime_ret_value;
+}
+
 //----------------------------------------------------------------------
 inline auto FSystemTest::kqueue() -> int
 {
@@ -486,6 +516,18 @@ inline void FSystemTest::setTimerDeleteReturnValue (int ret_val)
   timer_delete_ret_value = ret_val;
 }
 
+//----------------------------------------------------------------------
+inline void FSystemTest::setTimerfdCreateReturnValue (int ret_val)
+{
+  timerfd_create_ret_value = ret_val;
+}
+
+//----------------------------------------------------------------------
+inline void FSystemTest::setTimerfdSettimeReturnValue (int ret_val)
+{
+  timerfd_settime_ret_value = ret_val;
+}
+
 //----------------------------------------------------------------------
 inline void FSystemTest::setKqueueReturnValue (int ret_val)
 {
@@ -596,6 +638,7 @@ class EventloopMonitorTest : public CPPUNIT_NS::TestFixture
     void eventLoopTest();
     void setMonitorTest();
     void IoMonitorTest();
+    void manyMonitorsTest();
     void SignalMonitorTest();
     void TimerMonitorTest();
     void BackendMonitorTest();
@@ -615,6 +658,7 @@ class EventloopMonitorTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (eventLoopTest);
     CPPUNIT_TEST (setMonitorTest);
     CPPUNIT_TEST (IoMonitorTest);
+    CPPUNIT_TEST (manyMonitorsTest);
     CPPUNIT_TEST (SignalMonitorTest);
     CPPUNIT_TEST (TimerMonitorTest);
     CPPUNIT_TEST (BackendMonitorTest);
@@ -814,6 +858,64 @@ void EventloopMonitorTest::IoMonitorTest()
   finalcut::FTermios::restoreTTYsettings();
 }
 
+//----------------------------------------------------------------------
+void EventloopMonitorTest::manyMonitorsTest()
+{
+  // More monitors than the former limit of 50 poll entries
+  constexpr std::size_t monitor_count{200};
+  finalcut::EventLoop eloop{};
+  auto eloop_ptr = &eloop;
+  std::vector<std::array<int, 2>> pipes(monitor_count, {{-1, -1}});
+  std::vector<std::unique_ptr<finalcut::IoMonitor>> monitors{};
+  std::vector<int> calls(monitor_count, 0);
+
+  for (std::size_t i{0}; i < monitor_count; i++)
+  {
+    CPPUNIT_ASSERT ( ::pipe(pipes[i].data()) == 0 );
+    monitors.emplace_back(std::make_unique<finalcut::IoMonitor>(&eloop));
+    auto callback_handler = [&pipes, &calls, i, eloop_ptr] (const finalcut::Monitor*, short)
+    {
+      uint64_t buf{0};
+      CPPUNIT_ASSERT ( ::read(pipes[i][0], &buf, sizeof(buf)) == sizeof(buf) );
+      calls[i]++;
+      eloop_ptr->leave();
+    };
+    monitors[i]->init (pipes[i][0], POLLIN, callback_handler, nullptr);
+    monitors[i]->resume();
+  }
+
+  uint64_t buf{1U};
+  CPPUNIT_ASSERT ( ::write (pipes[monitor_count - 1][1], &buf, sizeof(buf)) > 0 );
+  CPPUNIT_ASSERT ( eloop.run() == 0 );  // Run event loop
+  CPPUNIT_ASSERT ( calls[monitor_count - 1] == 1 );
+
+  // A suspended monitor is not triggered
+  monitors[120]->suspend();
+  CPPUNIT_ASSERT ( ::write (pipes[120][1], &buf, sizeof(buf)) > 0 );
+  CPPUNIT_ASSERT ( ::write (pipes[60][1], &buf, sizeof(buf)) > 0 );
+  CPPUNIT_ASSERT ( eloop.run() == 0 );  // Run event loop
+  CPPUNIT_ASSERT ( calls[60] == 1 );
+  CPPUNIT_ASSERT ( calls[120] == 0 );
+
+  // The pending data is processed after resumption
+  monitors[120]->resume();
+  CPPUNIT_ASSERT ( eloop.run() == 0 );  // Run event loop
+  CPPUNIT_ASSERT ( calls[120] == 1 );
+
+  // Removed monitors are no longer watched
+  monitors.erase(monitors.begin(), monitors.begin() + 100);
+  CPPUNIT_ASSERT ( ::write (pipes[150][1], &buf, sizeof(buf)) > 0 );
+  CPPUNIT_ASSERT ( eloop.run() == 0 );  // Run event loop
+  CPPUNIT_ASSERT ( calls[150] == 1 );
+  monitors.clear();
+
+  for (const auto& p : pipes)
+  {
+    ::close(p[0]);
+    ::close(p[1]);
+  }
+}
+
 //----------------------------------------------------------------------
 void EventloopMonitorTest::SignalMonitorTest()
 {
@@ -984,6 +1086,31 @@ void EventloopMonitorTest::exceptionTest()
   fsys_ptr->setTimerSettimeReturnValue(0);
   CPPUNIT_ASSERT_NO_THROW ( posix_timer_monitor.setInterval(t1, t2) );
 
+#if defined(USE_TIMERFD_TIMER)
+  // Timerfd timer monitor
+  //----------------------
+
+  // Timer file descriptor cannot be created
+  finalcut::TimerfdTimer timerfd_timer_monitor{&eloop};
+  fsys_ptr->setTimerfdCreateReturnValue(-1);
+  CPPUNIT_ASSERT_THROW ( timerfd_timer_monitor.init(callback_handler, nullptr)
+                       , finalcut::monitor_error );
+  fsys_ptr->setTimerfdCreateReturnValue(99);
+  CPPUNIT_ASSERT_NO_THROW ( timerfd_timer_monitor.init(callback_handler, nullptr) );
+  CPPUNIT_ASSERT ( timerfd_timer_monitor.getFileDescriptor() == 99 );
+
+  // Already initialised
+  CPPUNIT_ASSERT_THROW ( timerfd_timer_monitor.init(callback_handler, nullptr)
+                       , finalcut::monitor_error );
+
+  // Timer interval cannot be set
+  fsys_ptr->setTimerfdSettimeReturnValue(-1);
+  CPPUNIT_ASSERT_THROW ( timerfd_timer_monitor.setInterval(t1, t2)
+                       , std::system_error );
+  fsys_ptr->setTimerfdSettimeReturnValue(0);
+  CPPUNIT_ASSERT_NO_THROW ( timerfd_timer_monitor.setInterval(t1, t2) );
+#endif
+
   // Kqueue timer monitor
   //---------------------
 
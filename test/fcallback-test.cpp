@@ -20,7 +20,10 @@
 * <http://www.gnu.org/licenses/>.                                      *
 ***********************************************************************/
 
+#include <array>
+#include <functional>
 #include <utility>
+#include <vector>
 
 #include <cppunit/BriefTestProgressListener.h>
 #include <cppunit/CompilerOutputter.h>
@@ -129,6 +132,8 @@ class FCallbackTest : public CPPUNIT_NS::TestFixture
     void functionReferenceCallbackTest();
     void functionPointerCallbackTest();
     void ownWidgetTest();
+    void signalIdTest();
+    void callbackFunctionTest();
 
   private:
     // Adds code needed to register the test suite
@@ -143,6 +148,8 @@ class FCallbackTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (functionReferenceCallbackTest);
     CPPUNIT_TEST (functionPointerCallbackTest);
     CPPUNIT_TEST (ownWidgetTest);
+    CPPUNIT_TEST (signalIdTest);
+    CPPUNIT_TEST (callbackFunctionTest);
 
     // End of test suite definition
     CPPUNIT_TEST_SUITE_END();
@@ -533,6 +540,85 @@ void FCallbackTest::ownWidgetTest()
   CPPUNIT_ASSERT ( value == 3141596 );
 }
 
+//----------------------------------------------------------------------
+void FCallbackTest::signalIdTest()
+{
+  const auto clicked = finalcut::FCallback::getSignalId("clicked");
+  const auto changed = finalcut::FCallback::getSignalId("changed");
+  CPPUNIT_ASSERT ( clicked != changed );
+  CPPUNIT_ASSERT ( clicked == finalcut::FCallback::getSignalId("clicked") );
+  CPPUNIT_ASSERT ( changed == finalcut::FCallback::getSignalId("changed") );
+
+  finalcut::FCallback cb{};
+  std::vector<int> order{};
+  auto append = [&order] (int n) { order.push_back(n); };
+  cb.addCallback ("clicked", append, 1);
+  cb.addCallback ("changed", append, 2);
+  cb.addCallback ("clicked", append, 3);
+  cb.addCallback ("changed", append, 4);
+  CPPUNIT_ASSERT ( cb.getCallbackCount() == 4 );
+
+  // Callbacks of a signal are called in the order of registration
+  cb.emitCallback (clicked);
+  CPPUNIT_ASSERT ( order.size() == 2 );
+  CPPUNIT_ASSERT ( order[0] == 1 );
+  CPPUNIT_ASSERT ( order[1] == 3 );
+
+  cb.emitCallback ("changed");
+  CPPUNIT_ASSERT ( order.size() == 4 );
+  CPPUNIT_ASSERT ( order[2] == 2 );
+  CPPUNIT_ASSERT ( order[3] == 4 );
+
+  // Emitting or deleting an unknown signal changes nothing
+  cb.emitCallback ("never-registered-signal");
+  cb.delCallback ("never-registered-signal");
+  CPPUNIT_ASSERT ( order.size() == 4 );
+  CPPUNIT_ASSERT ( cb.getCallbackCount() == 4 );
+
+  cb.delCallback ("clicked");
+  CPPUNIT_ASSERT ( cb.getCallbackCount() == 2 );
+  cb.emitCallback (clicked);
+  CPPUNIT_ASSERT ( order.size() == 4 );
+  cb.emitCallback (changed);
+  CPPUNIT_ASSERT ( order.size() == 6 );
+}
+
+//----------------------------------------------------------------------
+void FCallbackTest::callbackFunctionTest()
+{
+  int value{0};
+  finalcut::FCallbackFunction empty{};
+  CPPUNIT_ASSERT ( ! empty );
+  CPPUNIT_ASSERT_THROW ( empty(), std::bad_function_call );
+
+  // Fits into the local buffer
+  finalcut::FCallbackFunction small{[&value] { value++; }};
+  CPPUNIT_ASSERT ( bool(small) );
+  small();
+  CPPUNIT_ASSERT ( value == 1 );
+
+  // Stored on the heap
+  std::array<int, 32> numbers{};
+  numbers[31] = 10;
+  finalcut::FCallbackFunction large{[&value, numbers] { value += numbers[31]; }};
+  large();
+  CPPUNIT_ASSERT ( value == 11 );
+
+  // Copy and move
+  auto large_copy = large;
+  large_copy();
+  CPPUNIT_ASSERT ( value == 21 );
+  auto small_moved = std::move(small);
+  small_moved();
+  CPPUNIT_ASSERT ( value == 22 );
+  large = std::move(small_moved);
+  large();
+  CPPUNIT_ASSERT ( value == 23 );
+  large = large_copy;
+  large();
+  CPPUNIT_ASSERT ( value == 33 );
+}
+
 // Put the test suite in the registry
 CPPUNIT_TEST_SUITE_REGISTRATION (FCallbackTest);
 
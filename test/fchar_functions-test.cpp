@@ -0,0 +1,178 @@
+/***********************************************************************
+* fchar_functions-test.cpp - FChar function unit tests                 *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2023 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <vector>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FCharFunctionsTest
+//----------------------------------------------------------------------
+
+class FCharFunctionsTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FCharFunctionsTest() = default;
+
+  protected:
+    void equalTest();
+    void prefixSuffixTest();
+    void repetitionTest();
+
+  private:
+    // Method
+    static auto createChar (wchar_t) -> finalcut::FChar;
+
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FCharFunctionsTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (equalTest);
+    CPPUNIT_TEST (prefixSuffixTest);
+    CPPUNIT_TEST (repetitionTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+//----------------------------------------------------------------------
+auto FCharFunctionsTest::createChar (wchar_t c) -> finalcut::FChar
+{
+  finalcut::FChar fchar{};
+  fchar.ch[0] = c;
+  fchar.fg_color = finalcut::FColor::Black;
+  fchar.bg_color = finalcut::FColor::LightGray;
+  fchar.attr.bit.char_width = 1;
+  return fchar;
+}
+
+//----------------------------------------------------------------------
+void FCharFunctionsTest::equalTest()
+{
+  const auto a = createChar(L'A');
+  auto b = createChar(L'A');
+  CPPUNIT_ASSERT ( finalcut::isSameFChar(a, b) );
+  CPPUNIT_ASSERT ( finalcut::isSameFChar(a, b) == (a == b) );
+
+  // Bytes after the string terminator are not relevant
+  b.ch[2] = L'x';
+  b.ch[4] = L'y';
+  CPPUNIT_ASSERT ( finalcut::isSameFChar(a, b) );
+  CPPUNIT_ASSERT ( finalcut::isSameFChar(a, b) == (a == b) );
+
+  // Combining characters
+  b.ch[1] = L'\U00000300';
+  CPPUNIT_ASSERT ( ! finalcut::isSameFChar(a, b) );
+  CPPUNIT_ASSERT ( finalcut::isSameFChar(a, b) == (a == b) );
+  b = createChar(L'B');
+  CPPUNIT_ASSERT ( ! finalcut::isSameFChar(a, b) );
+
+  // Colors
+  b = createChar(L'A');
+  b.fg_color = finalcut::FColor::Red;
+  CPPUNIT_ASSERT ( ! finalcut::isSameFChar(a, b) );
+  b = createChar(L'A');
+  b.bg_color = finalcut::FColor::Blue;
+  CPPUNIT_ASSERT ( ! finalcut::isSameFChar(a, b) );
+
+  // Attributes
+  b = createChar(L'A');
+  b.attr.bit.bold = true;
+  CPPUNIT_ASSERT ( ! finalcut::isSameFChar(a, b) );
+  b = createChar(L'A');
+  b.attr.bit.inherit_background = true;
+  CPPUNIT_ASSERT ( ! finalcut::isSameFChar(a, b) );
+  b = createChar(L'A');
+  b.attr.bit.fullwidth_padding = true;
+  CPPUNIT_ASSERT ( ! finalcut::isSameFChar(a, b) );
+
+  // The internal state bits are ignored
+  b = createChar(L'A');
+  b.attr.bit.no_changes = true;
+  b.attr.bit.printed = true;
+  b.attr.bit.char_width = 2;
+  b.attr.byte[3] = 0xff;
+  CPPUNIT_ASSERT ( finalcut::isSameFChar(a, b) );
+  CPPUNIT_ASSERT ( finalcut::isSameFChar(a, b) == (a == b) );
+}
+
+//----------------------------------------------------------------------
+void FCharFunctionsTest::prefixSuffixTest()
+{
+  std::vector<finalcut::FChar> line(80, createChar(L' '));
+  auto line_old = line;
+
+  CPPUNIT_ASSERT ( finalcut::getEqualPrefixLength(line.data(), line_old.data(), 80) == 80 );
+  CPPUNIT_ASSERT ( finalcut::getEqualSuffixLength(line.data(), line_old.data(), 80) == 80 );
+  CPPUNIT_ASSERT ( finalcut::getEqualPrefixLength(line.data(), line_old.data(), 0) == 0 );
+  CPPUNIT_ASSERT ( finalcut::getEqualSuffixLength(line.data(), line_old.data(), 0) == 0 );
+
+  // Changed state bits do not count as a difference
+  line[7].attr.bit.printed = true;
+  line[70].attr.bit.no_changes = true;
+  CPPUNIT_ASSERT ( finalcut::getEqualPrefixLength(line.data(), line_old.data(), 80) == 80 );
+
+  line[10].ch[0] = L'x';
+  line[60].attr.bit.reverse = true;
+  CPPUNIT_ASSERT ( finalcut::getEqualPrefixLength(line.data(), line_old.data(), 80) == 10 );
+  CPPUNIT_ASSERT ( finalcut::getEqualSuffixLength(line.data(), line_old.data(), 80) == 19 );
+  CPPUNIT_ASSERT ( finalcut::getEqualPrefixLength(&line[11], &line_old[11], 69) == 49 );
+  CPPUNIT_ASSERT ( finalcut::getEqualSuffixLength(line.data(), line_old.data(), 60) == 49 );
+  CPPUNIT_ASSERT ( finalcut::getEqualPrefixLength(&line[10], &line_old[10], 70) == 0 );
+  CPPUNIT_ASSERT ( finalcut::getEqualSuffixLength(line.data(), line_old.data(), 61) == 0 );
+}
+
+//----------------------------------------------------------------------
+void FCharFunctionsTest::repetitionTest()
+{
+  std::vector<finalcut::FChar> line(40, createChar(L'-'));
+  CPPUNIT_ASSERT ( finalcut::getRepetitionLength(line.data(), 0) == 0 );
+  CPPUNIT_ASSERT ( finalcut::getRepetitionLength(line.data(), 1) == 1 );
+  CPPUNIT_ASSERT ( finalcut::getRepetitionLength(line.data(), 40) == 40 );
+  CPPUNIT_ASSERT ( finalcut::getRepetitionLength(line.data(), 25) == 25 );
+
+  line[5].attr.bit.printed = true;
+  CPPUNIT_ASSERT ( finalcut::getRepetitionLength(line.data(), 40) == 40 );
+
+  line[30] = createChar(L'=');
+  CPPUNIT_ASSERT ( finalcut::getRepetitionLength(line.data(), 40) == 30 );
+  CPPUNIT_ASSERT ( finalcut::getRepetitionLength(&line[30], 10) == 1 );
+  CPPUNIT_ASSERT ( finalcut::getRepetitionLength(&line[31], 9) == 9 );
+
+  line[20].fg_color = finalcut::FColor::Green;
+  CPPUNIT_ASSERT ( finalcut::getRepetitionLength(line.data(), 40) == 20 );
+}
+
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FCharFunctionsTest);
+
+// The general unit test main part
+#include <main-test.inc>
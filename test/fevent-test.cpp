@@ -63,6 +63,7 @@ class FEventTest : public CPPUNIT_NS::TestFixture
   protected:
     void feventTest();
     void fkeyeventTest();
+    void fpasteeventTest();
     void fmouseeventTest();
     void fwheeleventTest();
     void ffocuseventTest();
@@ -81,6 +82,7 @@ class FEventTest : public CPPUNIT_NS::TestFixture
     // Add a methods to the test suite
     CPPUNIT_TEST (feventTest);
     CPPUNIT_TEST (fkeyeventTest);
+    CPPUNIT_TEST (fpasteeventTest);
     CPPUNIT_TEST (fmouseeventTest);
     CPPUNIT_TEST (fwheeleventTest);
     CPPUNIT_TEST (ffocuseventTest);
@@ -210,6 +212,24 @@ void FEventTest::fkeyeventTest()
   CPPUNIT_ASSERT ( ! event3.isAccepted() );
 }
 
+//----------------------------------------------------------------------
+void FEventTest::fpasteeventTest()
+{
+  finalcut::FPasteEvent event (finalcut::Event::Paste, "Pasted text\nLine 2");
+  CPPUNIT_ASSERT ( event.getType() == finalcut::Event::Paste );
+  CPPUNIT_ASSERT ( event.getText() == "Pasted text\nLine 2" );
+  CPPUNIT_ASSERT ( ! event.isAccepted() );  // reject by default
+  event.accept();
+  CPPUNIT_ASSERT ( event.isAccepted() );
+  event.ignore();
+  CPPUNIT_ASSERT ( ! event.isAccepted() );
+
+  finalcut::FPasteEvent event1 (finalcut::Event::Paste, finalcut::FString{});
+  CPPUNIT_ASSERT ( event1.getType() == finalcut::Event::Paste );
+  CPPUNIT_ASSERT ( event1.getText().isEmpty() );
+  CPPUNIT_ASSERT ( ! event1.isAccepted() );
+}
+
 //----------------------------------------------------------------------
 void FEventTest::fmouseeventTest()
 {
@@ -339,6 +359,12 @@ void FEventTest::fwheeleventTest()
   CPPUNIT_ASSERT ( event2.getY() == 1 );
   CPPUNIT_ASSERT ( event2.getTermX() == 54 );
   CPPUNIT_ASSERT ( event2.getTermY() == 18 );
+  CPPUNIT_ASSERT ( event2.getDelta() == 1 );
+
+  finalcut::FWheelEvent event3 (finalcut::Event::MouseWheel, {3, 1}, {54, 18}, finalcut::MouseWheel::Left, 5);
+  CPPUNIT_ASSERT ( event3.getType() == finalcut::Event::MouseWheel );
+  CPPUNIT_ASSERT ( event3.getWheel() == finalcut::MouseWheel::Left );
+  CPPUNIT_ASSERT ( event3.getDelta() == 5 );
 }
 
 //----------------------------------------------------------------------
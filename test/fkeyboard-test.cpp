@@ -300,6 +300,8 @@ class FKeyboardTest : public CPPUNIT_NS::TestFixture
     void escapeKeyTest();
     void characterwiseInputTest();
     void severalKeysTest();
+    void bulkInputTest();
+    void bracketedPasteTest();
     void functionKeyTest();
     void metaKeyTest();
     void sequencesTest();
@@ -319,6 +321,8 @@ class FKeyboardTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (escapeKeyTest);
     CPPUNIT_TEST (characterwiseInputTest);
     CPPUNIT_TEST (severalKeysTest);
+    CPPUNIT_TEST (bulkInputTest);
+    CPPUNIT_TEST (bracketedPasteTest);
     CPPUNIT_TEST (functionKeyTest);
     CPPUNIT_TEST (metaKeyTest);
     CPPUNIT_TEST (sequencesTest);
@@ -537,6 +541,73 @@ void FKeyboardTest::severalKeysTest()
   clear();
 }
 
+//----------------------------------------------------------------------
+void FKeyboardTest::bulkInputTest()
+{
+  // Higher timeout for systems with high load
+  keyboard->setKeypressTimeout(250000);  // 250 ms
+  std::cout << std::endl;
+
+  // Input of more characters than the key queue can hold
+  input(std::string(200, 'x') + "\033[11~");
+  int count{0};
+
+  while ( number_of_keys < 201 && count < 20 )
+  {
+    processInput();
+    count++;
+  }
+
+  std::cout << " - Key: " << keyboard->getKeyName(key_pressed) << std::endl;
+  CPPUNIT_ASSERT ( number_of_keys == 201 );
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::F1 );
+  CPPUNIT_ASSERT ( key_released == finalcut::FKey::F1 );
+  CPPUNIT_ASSERT ( ! keyboard->hasUnprocessedInput() );
+  clear();
+}
+
+//----------------------------------------------------------------------
+void FKeyboardTest::bracketedPasteTest()
+{
+  // Higher timeout for systems with high load
+  keyboard->setKeypressTimeout(250000);  // 250 ms
+  std::cout << std::endl;
+
+  // Pasted text arrives as one key
+  input("\033[200~Paste text\033[201~");
+  processInput();
+  std::cout << " - Key: " << keyboard->getKeyName(key_pressed) << std::endl;
+  CPPUNIT_ASSERT ( number_of_keys == 1 );
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Bracketed_paste );
+  CPPUNIT_ASSERT ( keyboard->getPasteText() == "Paste text" );
+  clear();
+
+  // Escape sequences inside the pasted text are not interpreted
+  input("\033[200~\033[11~\tA\033[201~\033[12~");
+  processInput();
+  CPPUNIT_ASSERT ( number_of_keys == 2 );
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::F2 );
+  CPPUNIT_ASSERT ( keyboard->getPasteText() == "\033[11~\tA" );
+  clear();
+
+  // A paste that is larger than the key buffer
+  const std::string large_text(3000, 'x');
+  input("\033[200~" + large_text + "\033[201~");
+  int count{0};
+
+  while ( number_of_keys < 1 && count < 20 )
+  {
+    processInput();
+    count++;
+  }
+
+  CPPUNIT_ASSERT ( number_of_keys == 1 );
+  CPPUNIT_ASSERT ( key_pressed == finalcut::FKey::Bracketed_paste );
+  CPPUNIT_ASSERT ( keyboard->getPasteText().getLength() == 3000 );
+  CPPUNIT_ASSERT ( ! keyboard->hasUnprocessedInput() );
+  clear();
+}
+
 //----------------------------------------------------------------------
 void FKeyboardTest::functionKeyTest()
 {
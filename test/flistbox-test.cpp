@@ -0,0 +1,326 @@
+/***********************************************************************
+* flistbox-test.cpp - FListBox unit tests                              *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2023 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <string>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+namespace test
+{
+
+//----------------------------------------------------------------------
+inline auto getRowText (std::size_t index) -> finalcut::FString
+{
+  return finalcut::FString{"Row " + std::to_string(index)};
+}
+
+}  // namespace test
+
+
+//----------------------------------------------------------------------
+// class FListBoxTest
+//----------------------------------------------------------------------
+
+class FListBoxTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FListBoxTest() = default;
+
+  protected:
+    void classNameTest();
+    void noArgumentTest();
+    void virtualRowsTest();
+    void virtualItemTest();
+    void virtualSelectionTest();
+    void virtualModeChangeTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FListBoxTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (noArgumentTest);
+    CPPUNIT_TEST (virtualRowsTest);
+    CPPUNIT_TEST (virtualItemTest);
+    CPPUNIT_TEST (virtualSelectionTest);
+    CPPUNIT_TEST (virtualModeChangeTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+//----------------------------------------------------------------------
+void FListBoxTest::classNameTest()
+{
+  finalcut::FWidget root{};
+  const finalcut::FListBox listbox{&root};
+  const finalcut::FString& classname = listbox.getClassName();
+  CPPUNIT_ASSERT ( classname == "FListBox" );
+  const finalcut::FListBoxItem item{};
+  CPPUNIT_ASSERT ( item.getClassName() == "FListBoxItem" );
+}
+
+//----------------------------------------------------------------------
+void FListBoxTest::noArgumentTest()
+{
+  finalcut::FWidget root{};
+  const finalcut::FListBox listbox{&root};
+  CPPUNIT_ASSERT ( ! listbox.isVirtual() );
+  CPPUNIT_ASSERT ( listbox.getCount() == 0 );
+  CPPUNIT_ASSERT ( listbox.currentItem() == 0 );
+  CPPUNIT_ASSERT ( listbox.getData().empty() );
+}
+
+//----------------------------------------------------------------------
+void FListBoxTest::virtualRowsTest()
+{
+  finalcut::FWidget root{};
+  finalcut::FListBox listbox{&root};
+  listbox.setGeometry (finalcut::FPoint{1, 1}, finalcut::FSize{20, 10});
+  std::size_t calls{0};
+  listbox.setVirtualRows ( 1'000'000
+                         , [&calls] (std::size_t index)
+                           {
+                             calls++;
+                             return test::getRowText(index);
+                           } );
+  CPPUNIT_ASSERT ( listbox.isVirtual() );
+  CPPUNIT_ASSERT ( listbox.getCount() == 1'000'000 );
+  CPPUNIT_ASSERT ( listbox.getData().empty() );  // No stored items
+  CPPUNIT_ASSERT ( listbox.currentItem() == 1 );
+  CPPUNIT_ASSERT ( calls == 0 );  // Rows are only fetched on demand
+
+  // The provider index is 0-based, the item number is 1-based
+  CPPUNIT_ASSERT ( listbox.getItem(1).getText() == "Row 0" );
+  CPPUNIT_ASSERT ( listbox.getItem(1'000'000).getText() == "Row 999999" );
+  CPPUNIT_ASSERT ( calls == 2 );
+
+  listbox.setCurrentItem(500'000);
+  CPPUNIT_ASSERT ( listbox.currentItem() == 500'000 );
+  listbox.setCurrentItem(2'000'000);
+  CPPUNIT_ASSERT ( listbox.currentItem() == 1'000'000 );
+
+  // Virtual rows have no brackets and cannot be removed
+  listbox.showInsideBrackets (3, finalcut::BracketType::Brackets);
+  CPPUNIT_ASSERT ( ! listbox.hasBrackets(3) );
+  listbox.remove(3);
+  CPPUNIT_ASSERT ( listbox.getCount() == 1'000'000 );
+
+  // The model shrinks
+  listbox.setVirtualRowCount(100);
+  CPPUNIT_ASSERT ( listbox.getCount() == 100 );
+  CPPUNIT_ASSERT ( listbox.currentItem() == 100 );
+
+  // The model grows
+  listbox.setVirtualRowCount(200);
+  CPPUNIT_ASSERT ( listbox.getCount() == 200 );
+  CPPUNIT_ASSERT ( listbox.currentItem() == 100 );
+  CPPUNIT_ASSERT ( listbox.getItem(200).getText() == "Row 199" );
+
+  // Empty model
+  listbox.setVirtualRowCount(0);
+  CPPUNIT_ASSERT ( listbox.getCount() == 0 );
+  CPPUNIT_ASSERT ( listbox.currentItem() == 0 );
+  listbox.setVirtualRowCount(5);
+  CPPUNIT_ASSERT ( listbox.currentItem() == 1 );
+}
+
+//----------------------------------------------------------------------
+void FListBoxTest::virtualItemTest()
+{
+  finalcut::FWidget root{};
+  finalcut::FListBox listbox{&root};
+  listbox.setVirtualRows (10, test::getRowText);
+
+  // Item copies are independent of each other
+  const auto item1 = listbox.getItemCopy(1);
+  const auto item2 = listbox.getItemCopy(2);
+  CPPUNIT_ASSERT ( item1.getText() == "Row 0" );
+  CPPUNIT_ASSERT ( item2.getText() == "Row 1" );
+  CPPUNIT_ASSERT ( item1.getText() != item2.getText() );
+
+  // getItem() shares one buffer for all virtual rows,
+  // the reference is only valid until the next call
+  const auto& ref = listbox.getItem(3);
+  CPPUNIT_ASSERT ( ref.getText() == "Row 2" );
+  listbox.getItem(4);
+  CPPUNIT_ASSERT ( ref.getText() == "Row 3" );
+
+  // Changes to the buffer are not stored
+  listbox.getItem(5).setText("changed");
+  CPPUNIT_ASSERT ( listbox.getItem(5).getText() == "Row 4" );
+  CPPUNIT_ASSERT ( listbox.getItemCopy(5).getText() == "Row 4" );
+
+  // The copy contains the selection state
+  listbox.selectItem(6);
+  CPPUNIT_ASSERT ( listbox.getItemCopy(6).isSelected() );
+  CPPUNIT_ASSERT ( listbox.getItem(6).isSelected() );
+  CPPUNIT_ASSERT ( ! listbox.getItemCopy(7).isSelected() );
+
+  // getItemCopy() also works with stored items
+  finalcut::FListBox listbox2{&root};
+  listbox2.insert (finalcut::FString{"first"});
+  listbox2.insert (finalcut::FString{"second"});
+  auto copy = listbox2.getItemCopy(2);
+  copy.setText("copy");
+  CPPUNIT_ASSERT ( listbox2.getItem(2).getText() == "second" );
+  listbox2.getItem(2).setText("changed");
+  CPPUNIT_ASSERT ( listbox2.getItemCopy(2).getText() == "changed" );
+}
+
+//----------------------------------------------------------------------
+void FListBoxTest::virtualSelectionTest()
+{
+  finalcut::FWidget root{};
+  finalcut::FListBox listbox{&root};
+  listbox.setMultiSelection();
+  listbox.setVirtualRows (100, test::getRowText);
+  CPPUNIT_ASSERT ( ! listbox.isSelected(1) );
+
+  // Single rows
+  listbox.selectItem(10);
+  listbox.selectItem(20);
+  CPPUNIT_ASSERT ( ! listbox.isSelected(9) );
+  CPPUNIT_ASSERT ( listbox.isSelected(10) );
+  CPPUNIT_ASSERT ( ! listbox.isSelected(11) );
+  CPPUNIT_ASSERT ( listbox.isSelected(20) );
+
+  // Extend a range at both ends
+  listbox.selectItem(11);
+  listbox.selectItem(9);
+  listbox.selectItem(10);  // Already selected
+  CPPUNIT_ASSERT ( ! listbox.isSelected(8) );
+  CPPUNIT_ASSERT ( listbox.isSelected(9) );
+  CPPUNIT_ASSERT ( listbox.isSelected(10) );
+  CPPUNIT_ASSERT ( listbox.isSelected(11) );
+  CPPUNIT_ASSERT ( ! listbox.isSelected(12) );
+
+  // Join two ranges
+  for (std::size_t i{12}; i < 20; i++)
+    listbox.selectItem(i);
+
+  for (std::size_t i{9}; i <= 20; i++)
+    CPPUNIT_ASSERT ( listbox.isSelected(i) );
+
+  CPPUNIT_ASSERT ( ! listbox.isSelected(21) );
+
+  // Split a range
+  listbox.unselectItem(15);
+  CPPUNIT_ASSERT ( listbox.isSelected(14) );
+  CPPUNIT_ASSERT ( ! listbox.isSelected(15) );
+  CPPUNIT_ASSERT ( listbox.isSelected(16) );
+
+  // Shrink a range at both ends
+  listbox.unselectItem(9);
+  listbox.unselectItem(20);
+  listbox.unselectItem(50);  // Not selected
+  CPPUNIT_ASSERT ( ! listbox.isSelected(9) );
+  CPPUNIT_ASSERT ( listbox.isSelected(10) );
+  CPPUNIT_ASSERT ( listbox.isSelected(19) );
+  CPPUNIT_ASSERT ( ! listbox.isSelected(20) );
+
+  // First and last row
+  listbox.selectItem(1);
+  listbox.selectItem(100);
+  CPPUNIT_ASSERT ( listbox.isSelected(1) );
+  CPPUNIT_ASSERT ( listbox.isSelected(100) );
+  listbox.unselectItem(1);
+  CPPUNIT_ASSERT ( ! listbox.isSelected(1) );
+  CPPUNIT_ASSERT ( listbox.isSelected(10) );
+
+  // Rows behind a smaller row count lose their selection
+  listbox.setVirtualRowCount(17);
+  CPPUNIT_ASSERT ( listbox.isSelected(14) );
+  CPPUNIT_ASSERT ( listbox.isSelected(16) );
+  CPPUNIT_ASSERT ( listbox.isSelected(17) );
+  listbox.setVirtualRowCount(100);
+  CPPUNIT_ASSERT ( listbox.isSelected(17) );
+  CPPUNIT_ASSERT ( ! listbox.isSelected(18) );
+  CPPUNIT_ASSERT ( ! listbox.isSelected(19) );
+  CPPUNIT_ASSERT ( ! listbox.isSelected(100) );
+
+  listbox.setVirtualRowCount(12);
+  listbox.setVirtualRowCount(100);
+  CPPUNIT_ASSERT ( listbox.isSelected(10) );
+  CPPUNIT_ASSERT ( listbox.isSelected(12) );
+  CPPUNIT_ASSERT ( ! listbox.isSelected(13) );
+  CPPUNIT_ASSERT ( ! listbox.isSelected(14) );
+
+  // New rows clear the selection
+  listbox.setVirtualRows (100, test::getRowText);
+
+  for (std::size_t i{1}; i <= 100; i++)
+    CPPUNIT_ASSERT ( ! listbox.isSelected(i) );
+}
+
+//----------------------------------------------------------------------
+void FListBoxTest::virtualModeChangeTest()
+{
+  finalcut::FWidget root{};
+  finalcut::FListBox listbox{&root};
+  listbox.insert (finalcut::FString{"stored"});
+  CPPUNIT_ASSERT ( ! listbox.isVirtual() );
+  CPPUNIT_ASSERT ( listbox.getCount() == 1 );
+
+  // Virtual rows replace the stored items
+  listbox.setVirtualRows (50, test::getRowText);
+  CPPUNIT_ASSERT ( listbox.isVirtual() );
+  CPPUNIT_ASSERT ( listbox.getCount() == 50 );
+  CPPUNIT_ASSERT ( listbox.getData().empty() );
+  CPPUNIT_ASSERT ( listbox.getItem(1).getText() == "Row 0" );
+
+  // setVirtualRowCount() has no effect without virtual mode
+  finalcut::FListBox listbox2{&root};
+  listbox2.setVirtualRowCount(10);
+  CPPUNIT_ASSERT ( ! listbox2.isVirtual() );
+  CPPUNIT_ASSERT ( listbox2.getCount() == 0 );
+
+  // clear() leaves the virtual mode
+  listbox.selectItem(2);
+  listbox.clear();
+  CPPUNIT_ASSERT ( ! listbox.isVirtual() );
+  CPPUNIT_ASSERT ( listbox.getCount() == 0 );
+
+  // insert() leaves the virtual mode
+  listbox.setVirtualRows (50, test::getRowText);
+  CPPUNIT_ASSERT ( listbox.isVirtual() );
+  listbox.insert (finalcut::FString{"item"});
+  CPPUNIT_ASSERT ( ! listbox.isVirtual() );
+  CPPUNIT_ASSERT ( listbox.getCount() == 1 );
+  CPPUNIT_ASSERT ( listbox.getItem(1).getText() == "item" );
+  CPPUNIT_ASSERT ( ! listbox.isSelected(1) );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FListBoxTest);
+
+// The general unit test main part
+#include <main-test.inc>
@@ -0,0 +1,726 @@
+/***********************************************************************
+* flistview-test.cpp - FListView unit tests                            *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2023 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+namespace test
+{
+
+//----------------------------------------------------------------------
+inline void pressKey (finalcut::FListView& listview, finalcut::FKey key)
+{
+  finalcut::FKeyEvent ev{finalcut::Event::KeyPress, key};
+  listview.onKeyPress(&ev);
+}
+
+//----------------------------------------------------------------------
+inline auto jumpToClickPos (finalcut::FListView& listview, int y) -> int
+{
+  // Clicks with the middle mouse button on the vertical scrollbar
+  // and returns the new first visible line
+
+  for (auto&& child : listview.getChildren())
+  {
+    if ( ! child->isInstanceOf("FScrollbar") )
+      continue;
+
+    auto scrollbar = static_cast<finalcut::FScrollbar*>(child);
+
+    if ( scrollbar->getHeight() < 2 )  // Horizontal scrollbar
+      continue;
+
+    finalcut::FMouseEvent ev { finalcut::Event::MouseDown
+                             , finalcut::FPoint{1, y}
+                             , finalcut::MouseButton::Middle };
+    scrollbar->onMouseDown(&ev);
+    return scrollbar->getValue();
+  }
+
+  return -1;
+}
+
+//----------------------------------------------------------------------
+inline auto getCurrentText (finalcut::FListView& listview) -> finalcut::FString
+{
+  const auto item = listview.getCurrentItem();
+  return item ? item->getText(1) : finalcut::FString{};
+}
+
+//----------------------------------------------------------------------
+inline auto getChildTexts (const finalcut::FListViewItem* item) -> finalcut::FStringList
+{
+  finalcut::FStringList texts{};
+
+  for (auto&& child : item->getChildren())
+    texts.push_back(static_cast<finalcut::FListViewItem*>(child)->getText(1));
+
+  return texts;
+}
+
+//----------------------------------------------------------------------
+std::size_t compare_calls{0};
+
+inline auto countingCompare ( const finalcut::FObject* lhs
+                            , const finalcut::FObject* rhs ) -> bool
+{
+  // Compares the item names and counts the calls
+
+  compare_calls++;
+  const auto l_item = static_cast<const finalcut::FListViewItem*>(lhs);
+  const auto r_item = static_cast<const finalcut::FListViewItem*>(rhs);
+  return l_item->getText(1) < r_item->getText(1);
+}
+
+//----------------------------------------------------------------------
+// class TimerDispatcher
+//----------------------------------------------------------------------
+
+class TimerDispatcher : public finalcut::FObject
+{
+  public:
+    // Sends the timer events of all expired timers
+    // until the predicate is true or 5 seconds have passed
+    template <typename PredicateT>
+    auto processUntil (PredicateT predicate) -> bool
+    {
+      for (int i{0}; i < 500; i++)
+      {
+        processTimerEvent();
+
+        if ( predicate() )
+          return true;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+
+      return false;
+    }
+
+  private:
+    void performTimerAction ( finalcut::FObject* receiver
+                            , finalcut::FEvent* ev ) override
+    {
+      receiver->event(ev);
+    }
+};
+
+}  // namespace test
+
+
+//----------------------------------------------------------------------
+// class FListViewTest
+//----------------------------------------------------------------------
+
+class FListViewTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FListViewTest() = default;
+
+  protected:
+    void classNameTest();
+    void noArgumentTest();
+    void lineSeekTest();
+    void treeLineSeekTest();
+    void batchUpdateTest();
+    void syncLoadTest();
+    void asyncLoadTest();
+    void asyncLoaderExceptionTest();
+    void lazyItemDeleteTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FListViewTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (noArgumentTest);
+    CPPUNIT_TEST (lineSeekTest);
+    CPPUNIT_TEST (treeLineSeekTest);
+    CPPUNIT_TEST (batchUpdateTest);
+    CPPUNIT_TEST (syncLoadTest);
+    CPPUNIT_TEST (asyncLoadTest);
+    CPPUNIT_TEST (asyncLoaderExceptionTest);
+    CPPUNIT_TEST (lazyItemDeleteTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+//----------------------------------------------------------------------
+void FListViewTest::classNameTest()
+{
+  finalcut::FWidget root{};
+  const finalcut::FListView listview{&root};
+  const finalcut::FString& classname = listview.getClassName();
+  CPPUNIT_ASSERT ( classname == "FListView" );
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::noArgumentTest()
+{
+  finalcut::FWidget root{};
+  finalcut::FListView listview{&root};
+  CPPUNIT_ASSERT ( listview.getCount() == 0 );
+  CPPUNIT_ASSERT ( listview.getColumnCount() == 0 );
+  CPPUNIT_ASSERT ( listview.getData().empty() );
+  CPPUNIT_ASSERT ( ! listview.isUpdating() );
+
+  // Seeking in an empty list
+  test::pressKey (listview, finalcut::FKey::End);
+  test::pressKey (listview, finalcut::FKey::Home);
+  test::pressKey (listview, finalcut::FKey::Page_down);
+  CPPUNIT_ASSERT ( listview.getCount() == 0 );
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::lineSeekTest()
+{
+  finalcut::FWidget root{};
+  finalcut::FListView listview{&root};
+  listview.setGeometry (finalcut::FPoint{1, 1}, finalcut::FSize{30, 12});
+  listview.addColumn ("Line");
+
+  for (int i{0}; i < 1000; i++)
+    listview.insert ({ finalcut::FString(std::to_wstring(i)) });
+
+  CPPUNIT_ASSERT ( listview.getCount() == 1000 );
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "0" );
+
+  // Last line
+  test::pressKey (listview, finalcut::FKey::End);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "999" );
+
+  // First line
+  test::pressKey (listview, finalcut::FKey::Home);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "0" );
+
+  // Middle lines
+  for (const auto y : {3, 6, 8, 4})
+  {
+    const int line = test::jumpToClickPos (listview, y);
+    CPPUNIT_ASSERT ( line > 0 && line < 990 );
+    CPPUNIT_ASSERT ( test::getCurrentText(listview)
+                     == finalcut::FString(std::to_wstring(line)) );
+  }
+
+  test::pressKey (listview, finalcut::FKey::Home);
+  const int middle = test::jumpToClickPos (listview, 6);
+  const int pagesize = int(listview.getClientHeight()) - 1;
+  test::pressKey (listview, finalcut::FKey::Page_down);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview)
+                   == finalcut::FString(std::to_wstring(middle + pagesize)) );
+  test::pressKey (listview, finalcut::FKey::Page_up);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview)
+                   == finalcut::FString(std::to_wstring(middle)) );
+
+  // Seeking past the end stops at the last line
+  test::pressKey (listview, finalcut::FKey::End);
+  test::pressKey (listview, finalcut::FKey::Page_down);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "999" );
+  test::pressKey (listview, finalcut::FKey::Down);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "999" );
+
+  // Seeking before the beginning stops at the first line
+  test::pressKey (listview, finalcut::FKey::Home);
+  test::pressKey (listview, finalcut::FKey::Page_up);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "0" );
+  test::pressKey (listview, finalcut::FKey::Up);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "0" );
+
+  // The line offsets are rebuilt after a removal
+  listview.remove (listview.getCurrentItem());
+  CPPUNIT_ASSERT ( listview.getCount() == 999 );
+  test::pressKey (listview, finalcut::FKey::End);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "999" );
+  test::pressKey (listview, finalcut::FKey::Home);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "1" );
+  const int line = test::jumpToClickPos (listview, 6);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview)
+                   == finalcut::FString(std::to_wstring(line + 1)) );
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::treeLineSeekTest()
+{
+  finalcut::FWidget root{};
+  finalcut::FListView listview{&root};
+  listview.setGeometry (finalcut::FPoint{1, 1}, finalcut::FSize{30, 12});
+  listview.addColumn ("Name");
+  listview.setTreeView();
+  std::vector<finalcut::FListViewItem*> parents{};
+
+  // 100 parents with 5 children each
+  for (int i{0}; i < 100; i++)
+  {
+    const auto name = "P" + std::to_string(i);
+    auto parent = listview.insert ({ finalcut::FString{name} });
+    parents.push_back(static_cast<finalcut::FListViewItem*>(*parent));
+
+    for (int j{0}; j < 5; j++)
+      listview.insert ({ finalcut::FString{name + "." + std::to_string(j)} }, parent);
+  }
+
+  CPPUNIT_ASSERT ( listview.getCount() == 100 );
+
+  // Expand every even parent
+  std::vector<std::string> lines{};
+
+  for (int i{0}; i < 100; i++)
+  {
+    lines.push_back("P" + std::to_string(i));
+
+    if ( i % 2 != 0 )
+      continue;
+
+    parents[std::size_t(i)]->expand();
+
+    for (int j{0}; j < 5; j++)
+      lines.push_back("P" + std::to_string(i) + "." + std::to_string(j));
+  }
+
+  CPPUNIT_ASSERT ( listview.getCount() == lines.size() );
+  CPPUNIT_ASSERT ( listview.getCount() == 350 );
+
+  test::pressKey (listview, finalcut::FKey::End);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "P99" );
+  test::pressKey (listview, finalcut::FKey::Home);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "P0" );
+
+  // Seek to lines on both tree levels
+  const auto check_middle_lines = [&listview, &lines] ()
+  {
+    for (const auto y : {3, 5, 7, 9, 4})
+    {
+      const int line = test::jumpToClickPos (listview, y);
+      CPPUNIT_ASSERT ( line > 0 && line < int(lines.size()) );
+      CPPUNIT_ASSERT ( test::getCurrentText(listview) == lines[std::size_t(line)] );
+    }
+  };
+
+  check_middle_lines();
+
+  // Past the end
+  test::pressKey (listview, finalcut::FKey::End);
+  test::pressKey (listview, finalcut::FKey::Page_down);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "P99" );
+
+  // Collapsing a parent removes its lines from the seek
+  parents[0]->collapse();
+  lines.erase (lines.begin() + 1, lines.begin() + 6);
+  CPPUNIT_ASSERT ( listview.getCount() == 345 );
+  test::pressKey (listview, finalcut::FKey::Home);
+  check_middle_lines();
+  test::pressKey (listview, finalcut::FKey::End);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "P99" );
+
+  // Expanding the last parent adds lines at the end
+  parents[99]->expand();
+
+  for (int j{0}; j < 5; j++)
+    lines.push_back("P99." + std::to_string(j));
+
+  CPPUNIT_ASSERT ( listview.getCount() == 350 );
+  test::pressKey (listview, finalcut::FKey::End);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "P99.4" );
+  test::pressKey (listview, finalcut::FKey::Home);
+  check_middle_lines();
+
+  // Sorting reorders parents with a different number of lines
+  std::vector<std::string> names{};
+
+  for (int i{0}; i < 100; i++)
+    names.push_back("P" + std::to_string(i));
+
+  std::sort (names.rbegin(), names.rend());
+  lines.clear();
+
+  for (const auto& name : names)
+  {
+    const auto i = std::stoi(name.substr(1));
+    lines.push_back(name);
+
+    if ( i == 0 || (i % 2 != 0 && i != 99) )
+      continue;
+
+    for (int j{4}; j >= 0; j--)
+      lines.push_back(name + "." + std::to_string(j));
+  }
+
+  listview.setColumnSort (1, finalcut::SortOrder::Descending);
+  listview.sort();
+  CPPUNIT_ASSERT ( listview.getCount() == lines.size() );
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "P99" );
+  check_middle_lines();
+  test::pressKey (listview, finalcut::FKey::End);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "P0" );
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::batchUpdateTest()
+{
+  finalcut::FWidget root{};
+  finalcut::FListView listview{&root};
+  listview.setGeometry (finalcut::FPoint{1, 1}, finalcut::FSize{30, 12});
+  listview.addColumn ("Name");
+  int changed{0};
+
+  listview.addCallback
+  (
+    "changed",
+    [&changed] () { changed++; }
+  );
+
+  auto& compares = test::compare_calls;
+  compares = 0;
+  listview.setUserAscendingCompare (test::countingCompare);
+  listview.setColumnSortType (1, finalcut::SortType::UserDefined);
+  listview.setColumnSort (1, finalcut::SortOrder::Ascending);
+
+  auto insert = [&listview] (int first, int count)
+  {
+    // Inserts the names in a scrambled order
+    for (int i{first}; i < first + count; i++)
+    {
+      auto name = std::to_string(i * 37 % 200);
+      name.insert (0, 3 - name.length(), '0');
+      listview.insert ({ finalcut::FString{name} });
+    }
+  };
+
+  // Nested updates
+  listview.beginUpdate();
+  CPPUNIT_ASSERT ( listview.isUpdating() );
+  insert (0, 100);
+  listview.beginUpdate();
+  insert (100, 100);
+  listview.endUpdate();
+  CPPUNIT_ASSERT ( listview.isUpdating() );
+  CPPUNIT_ASSERT ( changed == 0 );
+  CPPUNIT_ASSERT ( compares == 0 );
+
+  // The outermost endUpdate() sorts and notifies only once
+  listview.endUpdate();
+  CPPUNIT_ASSERT ( ! listview.isUpdating() );
+  CPPUNIT_ASSERT ( changed == 1 );
+  CPPUNIT_ASSERT ( compares > 0 );
+  // One sort of 200 items needs less than 2 * n * log2(n) comparisons,
+  // a sort after each insert at least n * (n - 1) / 2 comparisons
+  CPPUNIT_ASSERT ( compares < 2 * 200 * 8 );
+  CPPUNIT_ASSERT ( listview.getCount() == 200 );
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "000" );
+  test::pressKey (listview, finalcut::FKey::End);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "199" );
+
+  // An unmatched endUpdate() is ignored
+  listview.endUpdate();
+  CPPUNIT_ASSERT ( ! listview.isUpdating() );
+  CPPUNIT_ASSERT ( changed == 1 );
+
+  // An update without inserts does not notify
+  listview.beginUpdate();
+  listview.endUpdate();
+  CPPUNIT_ASSERT ( changed == 1 );
+
+  // Without update each insert sorts and notifies
+  compares = 0;
+  listview.insert ({ finalcut::FString{"200"} });
+  CPPUNIT_ASSERT ( ! listview.isUpdating() );
+  CPPUNIT_ASSERT ( changed == 2 );
+  CPPUNIT_ASSERT ( compares > 0 );
+  CPPUNIT_ASSERT ( listview.getCount() == 201 );
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::syncLoadTest()
+{
+  finalcut::FWidget root{};
+  finalcut::FListView listview{&root};
+  listview.setGeometry (finalcut::FPoint{1, 1}, finalcut::FSize{30, 12});
+  listview.addColumn ("Name");
+  listview.setTreeView();
+  int calls{0};
+
+  listview.setChildLoader ( [&calls] (const finalcut::FStringList& columns)
+                            {
+                              calls++;
+                              const auto& name = columns[0];
+                              return finalcut::FListView::ChildRows
+                              {
+                                { {name + ".0"}, true },
+                                { {name + ".1"}, false }
+                              };
+                            } );
+
+  auto iter = listview.insert ({ finalcut::FString{"A"} });
+  auto item = static_cast<finalcut::FListViewItem*>(*iter);
+  item->setLazy();
+  CPPUNIT_ASSERT ( item->isLazy() );
+  CPPUNIT_ASSERT ( ! item->hasChildren() );
+  CPPUNIT_ASSERT ( listview.getCount() == 1 );
+  CPPUNIT_ASSERT ( calls == 0 );
+
+  // The children are loaded on the first expand
+  item->expand();
+  CPPUNIT_ASSERT ( calls == 1 );
+  CPPUNIT_ASSERT ( item->isExpand() );
+  CPPUNIT_ASSERT ( test::getChildTexts(item) == finalcut::FStringList({"A.0", "A.1"}) );
+  CPPUNIT_ASSERT ( listview.getCount() == 3 );
+
+  // ...and only once
+  item->collapse();
+  CPPUNIT_ASSERT ( listview.getCount() == 1 );
+  item->expand();
+  CPPUNIT_ASSERT ( calls == 1 );
+  CPPUNIT_ASSERT ( listview.getCount() == 3 );
+
+  // A lazy child loads its own children
+  auto child = static_cast<finalcut::FListViewItem*>(item->getChildren().front());
+  CPPUNIT_ASSERT ( child->isLazy() );
+  child->expand();
+  CPPUNIT_ASSERT ( calls == 2 );
+  CPPUNIT_ASSERT ( test::getChildTexts(child)
+                   == finalcut::FStringList({"A.0.0", "A.0.1"}) );
+  CPPUNIT_ASSERT ( listview.getCount() == 5 );
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::asyncLoadTest()
+{
+  finalcut::FWidget root{};
+  finalcut::FListView listview{&root};
+  listview.setGeometry (finalcut::FPoint{1, 1}, finalcut::FSize{30, 12});
+  listview.addColumn ("Name");
+  listview.setTreeView();
+  CPPUNIT_ASSERT ( listview.getLoadingText() == "Loading..." );
+  listview.setLoadingText ("Please wait");
+  CPPUNIT_ASSERT ( listview.getLoadingText() == "Please wait" );
+  std::atomic<bool> release{false};
+
+  listview.setChildLoader ( [&release] (const finalcut::FStringList& columns)
+                            {
+                              // Blocks the worker thread until the
+                              // placeholder has been checked
+                              while ( ! release )
+                                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+                              return finalcut::FListView::ChildRows
+                              {
+                                { {columns[0] + ".0"}, false },
+                                { {columns[0] + ".1"}, false },
+                                { {columns[0] + ".2"}, false }
+                              };
+                            }
+                          , finalcut::FListView::LoadMode::Async );
+
+  listview.insert ({ finalcut::FString{"A"} });
+  auto iter = listview.insert ({ finalcut::FString{"B"} });
+  auto item = static_cast<finalcut::FListViewItem*>(*iter);
+  item->setLazy();
+  item->expand();
+
+  // Only the placeholder is shown while the loader is running
+  CPPUNIT_ASSERT ( item->isExpand() );
+  CPPUNIT_ASSERT ( test::getChildTexts(item)
+                   == finalcut::FStringList({"Please wait"}) );
+  CPPUNIT_ASSERT ( listview.getCount() == 3 );
+
+  // Select the placeholder line
+  test::pressKey (listview, finalcut::FKey::End);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "Please wait" );
+
+  release = true;
+  test::TimerDispatcher dispatcher{};
+  const bool loaded = dispatcher.processUntil ( [&item] ()
+                                                {
+                                                  return item->numOfChildren() == 3;
+                                                } );
+
+  // The placeholder is replaced by the loaded children
+  CPPUNIT_ASSERT ( loaded );
+  CPPUNIT_ASSERT ( test::getChildTexts(item)
+                   == finalcut::FStringList({"B.0", "B.1", "B.2"}) );
+  CPPUNIT_ASSERT ( listview.getCount() == 5 );
+
+  // The selection moves from the removed placeholder to its parent
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "B" );
+  test::pressKey (listview, finalcut::FKey::End);
+  CPPUNIT_ASSERT ( test::getCurrentText(listview) == "B.2" );
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::asyncLoaderExceptionTest()
+{
+  finalcut::FWidget root{};
+  finalcut::FListView listview{&root};
+  listview.setGeometry (finalcut::FPoint{1, 1}, finalcut::FSize{30, 12});
+  listview.addColumn ("Name");
+  listview.setTreeView();
+
+  listview.setChildLoader ( [] (const finalcut::FStringList& columns)
+                              -> finalcut::FListView::ChildRows
+                            {
+                              if ( columns[0] == "std" )
+                                throw std::runtime_error{"test"};
+
+                              throw 1;  // Not derived from std::exception
+                            }
+                          , finalcut::FListView::LoadMode::Async );
+
+  std::vector<finalcut::FListViewItem*> items{};
+
+  for (const auto& name : {"std", "int"})
+  {
+    auto iter = listview.insert ({ finalcut::FString{name} });
+    items.push_back(static_cast<finalcut::FListViewItem*>(*iter));
+  }
+
+  for (auto&& item : items)
+  {
+    item->setLazy();
+    item->expand();
+    CPPUNIT_ASSERT ( item->numOfChildren() == 1 );
+  }
+
+  CPPUNIT_ASSERT ( listview.getCount() == 4 );
+
+  // A failed load leaves the item without children
+  std::ostringstream log_buffer{};
+  const auto& log = finalcut::FApplication::getLog();
+  log->setOutputStream(log_buffer);
+  test::TimerDispatcher dispatcher{};
+  const bool loaded = dispatcher.processUntil ( [&items] ()
+                                                {
+                                                  return ! items[0]->hasChildren()
+                                                      && ! items[1]->hasChildren();
+                                                } );
+  std::clog.flush();
+  log->setOutputStream(std::cerr);
+  CPPUNIT_ASSERT ( loaded );
+  CPPUNIT_ASSERT ( ! items[0]->isExpand() );
+  CPPUNIT_ASSERT ( ! items[1]->isExpand() );
+  CPPUNIT_ASSERT ( listview.getCount() == 2 );
+
+  // The errors are logged by the UI thread
+  const auto log_text = log_buffer.str();
+  CPPUNIT_ASSERT ( log_text.find("[ERROR] Exception in the child loader: test")
+                   != std::string::npos );
+  CPPUNIT_ASSERT ( log_text.find("[ERROR] Unknown exception in the child loader")
+                   != std::string::npos );
+}
+
+//----------------------------------------------------------------------
+void FListViewTest::lazyItemDeleteTest()
+{
+  finalcut::FWidget root{};
+  finalcut::FListView listview{&root};
+  listview.setGeometry (finalcut::FPoint{1, 1}, finalcut::FSize{30, 12});
+  listview.addColumn ("Name");
+  listview.setTreeView();
+  std::atomic<bool> release{false};
+
+  listview.setChildLoader ( [&release] (const finalcut::FStringList& columns)
+                            {
+                              while ( ! release )
+                                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+                              return finalcut::FListView::ChildRows
+                              {
+                                { {columns[0] + ".0"}, false }
+                              };
+                            }
+                          , finalcut::FListView::LoadMode::Async );
+
+  std::vector<finalcut::FListViewItem*> items{};
+
+  for (const auto& name : {"A", "B", "C", "D"})
+  {
+    auto iter = listview.insert ({ finalcut::FString{name} });
+    items.push_back(static_cast<finalcut::FListViewItem*>(*iter));
+    items.back()->setLazy();
+  }
+
+  items[0]->expand();
+  items[1]->expand();
+  CPPUNIT_ASSERT ( listview.getCount() == 6 );
+
+  // Deleting an item while its loader is running
+  delete items[0];
+  CPPUNIT_ASSERT ( listview.getCount() == 4 );
+  release = true;
+  test::TimerDispatcher dispatcher{};
+  bool loaded = dispatcher.processUntil ( [&items] ()
+                                          {
+                                            return test::getChildTexts(items[1])
+                                                == finalcut::FStringList({"B.0"});
+                                          } );
+  CPPUNIT_ASSERT ( loaded );
+  CPPUNIT_ASSERT ( listview.getCount() == 4 );
+
+  // Deleting a populated item whose lazy flag was reset
+  listview.setLazyItemLimit(1);
+  items[1]->setLazy(false);
+  delete items[1];
+  CPPUNIT_ASSERT ( listview.getCount() == 2 );
+  items[2]->expand();
+  loaded = dispatcher.processUntil ( [&items] ()
+                                     {
+                                       return test::getChildTexts(items[2])
+                                           == finalcut::FStringList({"C.0"});
+                                     } );
+  CPPUNIT_ASSERT ( loaded );
+  CPPUNIT_ASSERT ( listview.getCount() == 3 );
+
+  // Only the remaining lazy items count towards the limit
+  items[2]->collapse();
+  items[3]->expand();
+  loaded = dispatcher.processUntil ( [&items] ()
+                                     {
+                                       return test::getChildTexts(items[3])
+                                           == finalcut::FStringList({"D.0"});
+                                     } );
+  CPPUNIT_ASSERT ( loaded );
+  CPPUNIT_ASSERT ( ! items[2]->hasChildren() );
+  CPPUNIT_ASSERT ( listview.getCount() == 3 );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FListViewTest);
+
+// The general unit test main part
+#include <main-test.inc>
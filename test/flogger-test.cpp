@@ -21,8 +21,11 @@
 ***********************************************************************/
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <cppunit/BriefTestProgressListener.h>
 #include <cppunit/CompilerOutputter.h>
@@ -94,6 +97,24 @@ class myLogger : public finalcut::FLog
     std::ostream output{std::cerr.rdbuf()};
 };
 
+//----------------------------------------------------------------------
+// class gatedBuffer
+//----------------------------------------------------------------------
+
+class gatedBuffer : public std::stringbuf
+{
+  public:
+    // Holding the gate mutex stalls the writing thread
+    std::mutex gate{};
+
+  protected:
+    auto xsputn (const char* s, std::streamsize n) -> std::streamsize override
+    {
+      std::lock_guard<std::mutex> lock_guard(gate);
+      return std::stringbuf::xsputn(s, n);
+    }
+};
+
 //----------------------------------------------------------------------
 // class FLoggerTest
 //----------------------------------------------------------------------
@@ -109,6 +130,9 @@ class FLoggerTest : public CPPUNIT_NS::TestFixture
     void lineEndingTest();
     void timestampTest();
     void fileTest();
+    void asyncTest();
+    void asyncThreadTest();
+    void asyncOverflowTest();
     void applicationObjectTest();
 
   private:
@@ -121,6 +145,9 @@ class FLoggerTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (lineEndingTest);
     CPPUNIT_TEST (timestampTest);
     CPPUNIT_TEST (fileTest);
+    CPPUNIT_TEST (asyncTest);
+    CPPUNIT_TEST (asyncThreadTest);
+    CPPUNIT_TEST (asyncOverflowTest);
     CPPUNIT_TEST (applicationObjectTest);
 
     // End of test suite definition
@@ -324,6 +351,148 @@ void FLoggerTest::fileTest()
   }
 }
 
+//----------------------------------------------------------------------
+void FLoggerTest::asyncTest()
+{
+  finalcut::FLogger log{};
+  std::ostringstream buf{};
+  log.setOutputStream(buf);
+  CPPUNIT_ASSERT ( ! log.isAsync() );
+
+  log.enableAsync();
+  CPPUNIT_ASSERT ( log.isAsync() );
+  CPPUNIT_ASSERT ( log.getDroppedRecords() == 0 );
+
+  log.info("Hello,\nWorld!");
+  log.warn("Hello, World!");
+  log << finalcut::FLog::LogLevel::Error << "Hello, World!" << std::flush;
+  log.debug("Hello, World!");
+  log.flush();
+  CPPUNIT_ASSERT ( buf.str() == "[INFO] Hello,\r\n[INFO] World!\r\n"
+                                "[WARNING] Hello, World!\r\n"
+                                "[ERROR] Hello, World!\r\n"
+                                "[DEBUG] Hello, World!\r\n" );
+  buf.str("");  // Clear buffer
+
+  log.setLineEnding(finalcut::FLog::LineEnding::LF);
+  log.enableTimestamp();
+  log.info("Timestamp");
+  log.flush();
+  std::size_t length = buf.str().length();
+  CPPUNIT_ASSERT ( buf.str().substr(length - 17) == "[INFO] Timestamp\n" );
+  CPPUNIT_ASSERT ( length > 40 );
+  buf.str("");  // Clear buffer
+
+  // Pending records are written when leaving the asynchronous mode
+  log.disableTimestamp();
+  log.info("Last record");
+  log.disableAsync();
+  CPPUNIT_ASSERT ( ! log.isAsync() );
+  CPPUNIT_ASSERT ( buf.str() == "[INFO] Last record\n" );
+  buf.str("");  // Clear buffer
+
+  log.info("Synchronous");
+  CPPUNIT_ASSERT ( buf.str() == "[INFO] Synchronous\n" );
+}
+
+//----------------------------------------------------------------------
+void FLoggerTest::asyncThreadTest()
+{
+  constexpr int thread_count = 4;
+  constexpr int records = 1000;
+  finalcut::FLogger log{};
+  std::ostringstream buf{};
+  log.setOutputStream(buf);
+  log.setLineEnding(finalcut::FLog::LineEnding::LF);
+  // A small ring buffer lets the producers wait for the writer
+  log.enableAsync (16, finalcut::FLogger::OverflowPolicy::Block);
+  std::vector<std::thread> producers{};
+
+  for (int t{0}; t < thread_count; t++)
+  {
+    producers.emplace_back ( [&log, t] ()
+                             {
+                               for (int n{0}; n < records; n++)
+                                 log.info ( std::to_string(t) + ":"
+                                          + std::to_string(n) );
+                             } );
+  }
+
+  for (auto& thread : producers)
+    thread.join();
+
+  log.flush();
+  CPPUNIT_ASSERT ( log.getDroppedRecords() == 0 );
+
+  // Each producer's records arrive in order
+  std::vector<int> next(thread_count, 0);
+  std::istringstream input{buf.str()};
+  std::string line{};
+  int line_count{0};
+
+  while ( std::getline(input, line) )
+  {
+    CPPUNIT_ASSERT ( line.substr(0, 7) == "[INFO] " );
+    const auto colon = line.find(':');
+    const auto t = std::stoi(line.substr(7, colon - 7));
+    const auto n = std::stoi(line.substr(colon + 1));
+    CPPUNIT_ASSERT ( n == next[std::size_t(t)] );
+    next[std::size_t(t)]++;
+    line_count++;
+  }
+
+  CPPUNIT_ASSERT ( line_count == thread_count * records );
+}
+
+//----------------------------------------------------------------------
+void FLoggerTest::asyncOverflowTest()
+{
+  gatedBuffer buf{};
+  finalcut::FLogger log{};
+  log.setOutputStream(std::ostream{&buf});
+  log.setLineEnding(finalcut::FLog::LineEnding::LF);
+  log.enableAsync (4, finalcut::FLogger::OverflowPolicy::Drop);
+
+  {
+    // With a stalled writer thread, the ring buffer and one
+    // batch in progress take at most 2 × 4 records
+    std::lock_guard<std::mutex> lock_guard(buf.gate);
+
+    for (int n{0}; n < 100; n++)
+      log.debug("Record " + std::to_string(n));
+
+    CPPUNIT_ASSERT ( log.getDroppedRecords() >= 92 );
+  }
+
+  log.flush();
+  const auto dropped = log.getDroppedRecords();
+  std::istringstream input{buf.str()};
+  std::string line{};
+  const std::string warning{"[WARNING] "};
+  const std::string notice{" log records dropped"};
+  uInt64 line_count{0};
+  uInt64 reported_drops{0};
+
+  while ( std::getline(input, line) )
+  {
+    // The drops are reported with the next batch, so depending
+    // on the thread timing they can spread over several notices
+    if ( line.size() > warning.size() + notice.size()
+      && line.compare(0, warning.size(), warning) == 0
+      && line.compare(line.size() - notice.size(), notice.size(), notice) == 0 )
+    {
+      const auto count = line.substr ( warning.size()
+                                     , line.size() - warning.size() - notice.size() );
+      reported_drops += std::stoull(count);
+    }
+    else
+      line_count++;
+  }
+
+  CPPUNIT_ASSERT ( reported_drops == dropped );
+  CPPUNIT_ASSERT ( line_count + dropped == 100 );
+}
+
 //----------------------------------------------------------------------
 void FLoggerTest::applicationObjectTest()
 {
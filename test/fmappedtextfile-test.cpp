@@ -0,0 +1,301 @@
+/***********************************************************************
+* fmappedtextfile-test.cpp - FMappedTextFile unit tests                *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2023 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+//----------------------------------------------------------------------
+// class FMappedTextFileTest
+//----------------------------------------------------------------------
+
+class FMappedTextFileTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FMappedTextFileTest() = default;
+
+    void setUp() override;
+    void tearDown() override;
+
+  protected:
+    void classNameTest();
+    void noArgumentTest();
+    void openTest();
+    void lineTest();
+    void utf8Test();
+    void incrementalIndexTest();
+    void growingFileTest();
+    void truncatedFileTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FMappedTextFileTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (noArgumentTest);
+    CPPUNIT_TEST (openTest);
+    CPPUNIT_TEST (lineTest);
+    CPPUNIT_TEST (utf8Test);
+    CPPUNIT_TEST (incrementalIndexTest);
+    CPPUNIT_TEST (growingFileTest);
+    CPPUNIT_TEST (truncatedFileTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+
+    // Methods
+    void writeFile (const std::string&, bool = false) const;
+
+    // Data member
+    std::string file_name{};
+};
+
+//----------------------------------------------------------------------
+void FMappedTextFileTest::setUp()
+{
+  char name[] = "/tmp/fmappedtextfile-test.XXXXXX";
+  const int fd = mkstemp(name);
+  CPPUNIT_ASSERT ( fd >= 0 );
+  close(fd);
+  file_name = name;
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFileTest::tearDown()
+{
+  std::remove(file_name.c_str());
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFileTest::classNameTest()
+{
+  const finalcut::FMappedTextFile file;
+  const finalcut::FString& classname = file.getClassName();
+  CPPUNIT_ASSERT ( classname == "FMappedTextFile" );
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFileTest::noArgumentTest()
+{
+  const finalcut::FMappedTextFile file{};
+  CPPUNIT_ASSERT ( ! file.isOpen() );
+  CPPUNIT_ASSERT ( file.isIndexComplete() );
+  CPPUNIT_ASSERT ( file.getFileName().empty() );
+  CPPUNIT_ASSERT ( file.getFileSize() == 0 );
+  CPPUNIT_ASSERT ( file.getIndexedSize() == 0 );
+  CPPUNIT_ASSERT ( file.getLineCount() == 0 );
+  CPPUNIT_ASSERT ( file.getMaxLineLength() == 0 );
+  CPPUNIT_ASSERT ( file.getLine(0).isEmpty() );
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFileTest::openTest()
+{
+  finalcut::FMappedTextFile file{};
+  CPPUNIT_ASSERT ( ! file.open("/nonexistent/file.txt") );
+  CPPUNIT_ASSERT ( ! file.isOpen() );
+  CPPUNIT_ASSERT ( ! file.open("/tmp") );  // Not a regular file
+  CPPUNIT_ASSERT ( ! file.isOpen() );
+
+  // Empty file
+  CPPUNIT_ASSERT ( file.open(file_name) );
+  CPPUNIT_ASSERT ( file.isOpen() );
+  CPPUNIT_ASSERT ( file.getFileName() == file_name );
+  CPPUNIT_ASSERT ( file.buildIndex(1024) );
+  CPPUNIT_ASSERT ( file.getLineCount() == 0 );
+
+  file.close();
+  CPPUNIT_ASSERT ( ! file.isOpen() );
+  CPPUNIT_ASSERT ( file.getFileName().empty() );
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFileTest::lineTest()
+{
+  writeFile ("first\nsecond line\r\n\nlast");
+  finalcut::FMappedTextFile file{};
+  CPPUNIT_ASSERT ( file.open(file_name) );
+  CPPUNIT_ASSERT ( file.getFileSize() == 24 );
+  CPPUNIT_ASSERT ( ! file.isIndexComplete() );
+  CPPUNIT_ASSERT ( file.getLineCount() == 0 );
+
+  CPPUNIT_ASSERT ( file.buildIndex(1024) );
+  CPPUNIT_ASSERT ( file.isIndexComplete() );
+  CPPUNIT_ASSERT ( file.getIndexedSize() == 24 );
+  CPPUNIT_ASSERT ( file.getLineCount() == 4 );
+  CPPUNIT_ASSERT ( file.getMaxLineLength() == 12 );
+  CPPUNIT_ASSERT ( file.getLine(0) == "first" );
+  CPPUNIT_ASSERT ( file.getLine(1) == "second line" );
+  CPPUNIT_ASSERT ( file.getLine(2).isEmpty() );
+  CPPUNIT_ASSERT ( file.getLine(3) == "last" );
+  CPPUNIT_ASSERT ( file.getLine(4).isEmpty() );
+
+  // Limited line length
+  CPPUNIT_ASSERT ( file.getLine(1, 6) == "second" );
+  CPPUNIT_ASSERT ( file.getLine(3, 0).isEmpty() );
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFileTest::utf8Test()
+{
+  writeFile ("Gr\xc3\xbc\xc3\x9f" "e\n"      // Grüße
+             "\xe2\x82\xac 10\n"             // € 10
+             "\xf0\x9f\x98\x80\n"            // 😀
+             "a\xff" "b\n"                   // Invalid byte
+             "\xc3\n"                        // Truncated sequence
+             "\xc0\xaf\n");                  // Overlong encoding
+  finalcut::FMappedTextFile file{};
+  CPPUNIT_ASSERT ( file.open(file_name) );
+  CPPUNIT_ASSERT ( file.buildIndex(1024) );
+  CPPUNIT_ASSERT ( file.getLineCount() == 6 );
+  CPPUNIT_ASSERT ( file.getLine(0) == L"Grüße" );
+  CPPUNIT_ASSERT ( file.getLine(1) == L"€ 10" );
+  CPPUNIT_ASSERT ( file.getLine(2).getLength() == 1 );
+  CPPUNIT_ASSERT ( file.getLine(2)[0] == wchar_t(0x1f600) );
+  CPPUNIT_ASSERT ( file.getLine(3) == L"a�b" );
+  CPPUNIT_ASSERT ( file.getLine(4) == L"�" );
+  CPPUNIT_ASSERT ( file.getLine(5) == L"�" );
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFileTest::incrementalIndexTest()
+{
+  std::string text{};
+
+  for (int i{0}; i < 1000; i++)
+    text += "Line " + std::to_string(i) + "\n";
+
+  writeFile (text);
+  finalcut::FMappedTextFile file{};
+  CPPUNIT_ASSERT ( file.open(file_name) );
+  std::size_t steps{0};
+
+  while ( ! file.buildIndex(100) )
+  {
+    CPPUNIT_ASSERT ( file.getIndexedSize() == (steps + 1) * 100 );
+    steps++;
+  }
+
+  CPPUNIT_ASSERT ( steps == text.length() / 100 );
+  CPPUNIT_ASSERT ( file.getLineCount() == 1000 );
+  CPPUNIT_ASSERT ( file.getMaxLineLength() == 8 );
+
+  for (std::size_t i{0}; i < 1000; i++)
+    CPPUNIT_ASSERT ( file.getLine(i) == "Line " + std::to_string(i) );
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFileTest::growingFileTest()
+{
+  writeFile ("one\ntw");
+  finalcut::FMappedTextFile file{};
+  CPPUNIT_ASSERT ( file.open(file_name) );
+  CPPUNIT_ASSERT ( file.buildIndex(1024) );
+  CPPUNIT_ASSERT ( file.getLineCount() == 2 );
+  CPPUNIT_ASSERT ( file.getLine(1) == "tw" );
+  CPPUNIT_ASSERT ( ! file.refresh() );
+
+  // The file grows
+  writeFile ("o\nthree\n", true);
+  CPPUNIT_ASSERT ( file.refresh() );
+  CPPUNIT_ASSERT ( file.getFileSize() == 14 );
+  CPPUNIT_ASSERT ( ! file.isIndexComplete() );
+  CPPUNIT_ASSERT ( file.getLineCount() == 1 );
+  CPPUNIT_ASSERT ( file.buildIndex(1024) );
+  CPPUNIT_ASSERT ( file.getLineCount() == 3 );
+  CPPUNIT_ASSERT ( file.getLine(1) == "two" );
+  CPPUNIT_ASSERT ( file.getLine(2) == "three" );
+  CPPUNIT_ASSERT ( file.getMaxLineLength() == 5 );
+
+  // The file is truncated
+  writeFile ("new\n");
+  CPPUNIT_ASSERT ( file.refresh() );
+  CPPUNIT_ASSERT ( file.getLineCount() == 0 );
+  CPPUNIT_ASSERT ( file.buildIndex(1024) );
+  CPPUNIT_ASSERT ( file.getLineCount() == 1 );
+  CPPUNIT_ASSERT ( file.getLine(0) == "new" );
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFileTest::truncatedFileTest()
+{
+  // Truncation without a refresh() must not access
+  // the mapped pages behind the new end of the file
+  std::string text{};
+
+  for (int i{0}; i < 10000; i++)
+    text += "Line " + std::to_string(i) + "\n";
+
+  writeFile (text);
+  finalcut::FMappedTextFile file{};
+  CPPUNIT_ASSERT ( file.open(file_name) );
+  CPPUNIT_ASSERT ( ! file.buildIndex(50000) );
+  CPPUNIT_ASSERT ( file.getLine(1000) == "Line 1000" );
+
+  writeFile ("Line 0\nLine 1\n");
+  CPPUNIT_ASSERT ( file.getLineCount() > 1000 );  // Not yet refreshed
+  CPPUNIT_ASSERT ( file.getLine(1000).isEmpty() );
+  CPPUNIT_ASSERT ( file.getLine(1, 3) == "Lin" );
+
+  // Indexing restarts with the truncated file
+  CPPUNIT_ASSERT ( file.buildIndex(50000) );
+  CPPUNIT_ASSERT ( file.getFileSize() == 14 );
+  CPPUNIT_ASSERT ( file.getLineCount() == 2 );
+  CPPUNIT_ASSERT ( file.getLine(1) == "Line 1" );
+  CPPUNIT_ASSERT ( file.getLine(1000).isEmpty() );
+
+  // Truncated to an empty file after the index is complete
+  writeFile ("");
+  CPPUNIT_ASSERT ( file.getLine(0).isEmpty() );
+  CPPUNIT_ASSERT ( file.refresh() );
+  CPPUNIT_ASSERT ( file.getLineCount() == 0 );
+  CPPUNIT_ASSERT ( file.buildIndex(1024) );
+}
+
+//----------------------------------------------------------------------
+void FMappedTextFileTest::writeFile ( const std::string& text
+                                    , bool append ) const
+{
+  const auto mode = ( append ) ? std::ios::app : std::ios::trunc;
+  std::ofstream file{file_name, std::ios::binary | mode};
+  file << text;
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FMappedTextFileTest);
+
+// The general unit test main part
+#include <main-test.inc>
@@ -113,6 +113,8 @@ class FMouseTest : public CPPUNIT_NS::TestFixture
     void sgrMouseTest();
     void urxvtMouseTest();
     void mouseControlTest();
+    void mouseCoalescingTest();
+    void mouseInputBurstTest();
 
   private:
     auto insertData (std::initializer_list<char>) -> finalcut::FKeyboard::keybuffer;
@@ -132,6 +134,8 @@ class FMouseTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (sgrMouseTest);
     CPPUNIT_TEST (urxvtMouseTest);
     CPPUNIT_TEST (mouseControlTest);
+    CPPUNIT_TEST (mouseCoalescingTest);
+    CPPUNIT_TEST (mouseInputBurstTest);
 
     // End of test suite definition
     CPPUNIT_TEST_SUITE_END();
@@ -1653,6 +1657,169 @@ void FMouseTest::mouseControlTest()
   mouse_control.disable();
 }
 
+//----------------------------------------------------------------------
+void FMouseTest::mouseCoalescingTest()
+{
+  char* pram_0 = finalcut::C_STR("./a.out");
+  char** parms = &pram_0;
+  finalcut::FApplication app(1, parms);
+  CPPUNIT_ASSERT ( ! finalcut::FApplication::isQuit() );  // Need in processQueuedInput()
+
+  finalcut::FMouseControl mouse_control;
+  std::vector<finalcut::FMouseData> events{};
+  auto cmd = [&events] (const finalcut::FMouseData& md)
+             {
+               events.push_back(md);
+             };
+  finalcut::FMouseCommand mouse_cmd (cmd);
+  mouse_control.setEventCommand (mouse_cmd);
+  mouse_control.setStdinNo(fileno(stdin));
+  mouse_control.setMaxWidth(100);
+  mouse_control.setMaxHeight(40);
+  mouse_control.useXtermMouse(true);
+  mouse_control.enable();
+
+  // Drag with the left mouse button on an SGR mouse
+  auto rawdata1 = insertData ({ 0x1b, '[', '<', '0', ';', '1', ';', '2', 'M'
+                              , 0x1b, '[', '<', '3', '2', ';', '2', ';', '3', 'M'
+                              , 0x1b, '[', '<', '3', '2', ';', '3', ';', '4', 'M'
+                              , 0x1b, '[', '<', '3', '2', ';', '4', ';', '5', 'M'
+                              , 0x1b, '[', '<', '3', '2', ';', '5', ';', '6', 'M'
+                              , 0x1b, '[', '<', '0', ';', '5', ';', '6', 'm' });
+  auto tv = finalcut::FObjectTimer::getCurrentTime();
+
+  for (auto i{0}; i < 6; i++)
+  {
+    mouse_control.setRawData (finalcut::FMouse::MouseType::Sgr, rawdata1);
+    mouse_control.processEvent (tv);
+  }
+
+  // The moves are merged into one event with the last position
+  mouse_control.processQueuedInput();
+  CPPUNIT_ASSERT ( events.size() == 3 );
+  CPPUNIT_ASSERT ( events[0].isLeftButtonPressed() );
+  CPPUNIT_ASSERT ( ! events[0].isMoved() );
+  CPPUNIT_ASSERT ( events[0].getPos() == finalcut::FPoint(1, 2) );
+  CPPUNIT_ASSERT ( events[1].isLeftButtonPressed() );
+  CPPUNIT_ASSERT ( events[1].isMoved() );
+  CPPUNIT_ASSERT ( events[1].getPos() == finalcut::FPoint(5, 6) );
+  CPPUNIT_ASSERT ( events[2].isLeftButtonReleased() );
+  CPPUNIT_ASSERT ( events[2].getPos() == finalcut::FPoint(5, 6) );
+  CPPUNIT_ASSERT ( ! mouse_control.hasDataInQueue() );
+
+  // Mouse wheel on an SGR mouse
+  auto rawdata2 = insertData ({ 0x1b, '[', '<', '6', '4', ';', '9', ';', '9', 'M'
+                              , 0x1b, '[', '<', '6', '4', ';', '9', ';', '9', 'M'
+                              , 0x1b, '[', '<', '6', '4', ';', '9', ';', '9', 'M'
+                              , 0x1b, '[', '<', '6', '5', ';', '9', ';', '9', 'M'
+                              , 0x1b, '[', '<', '6', '5', ';', '9', ';', '9', 'M'
+                              , 0x1b, '[', '<', '6', '4', ';', '8', ';', '9', 'M' });
+  events.clear();
+
+  for (auto i{0}; i < 6; i++)
+  {
+    mouse_control.setRawData (finalcut::FMouse::MouseType::Sgr, rawdata2);
+    mouse_control.processEvent (tv);
+  }
+
+  // Wheel steps in the same direction at the same position add up
+  mouse_control.processQueuedInput();
+  CPPUNIT_ASSERT ( events.size() == 3 );
+  CPPUNIT_ASSERT ( events[0].isWheelUp() );
+  CPPUNIT_ASSERT ( events[0].getWheelDelta() == 3 );
+  CPPUNIT_ASSERT ( events[1].isWheelDown() );
+  CPPUNIT_ASSERT ( events[1].getWheelDelta() == 2 );
+  CPPUNIT_ASSERT ( events[2].isWheelUp() );
+  CPPUNIT_ASSERT ( events[2].getWheelDelta() == 1 );
+  CPPUNIT_ASSERT ( events[2].getPos() == finalcut::FPoint(8, 9) );
+
+  // Events that have already been processed are not changed
+  events.clear();
+  auto rawdata3 = insertData ({ 0x1b, '[', '<', '6', '4', ';', '8', ';', '9', 'M' });
+  mouse_control.setRawData (finalcut::FMouse::MouseType::Sgr, rawdata3);
+  mouse_control.processEvent (tv);
+  mouse_control.processQueuedInput();
+  CPPUNIT_ASSERT ( events.size() == 1 );
+  CPPUNIT_ASSERT ( events[0].getWheelDelta() == 1 );
+
+  mouse_control.disable();
+}
+
+//----------------------------------------------------------------------
+void FMouseTest::mouseInputBurstTest()
+{
+  // Synthetic input of a fast drag and a fast wheel spin
+  // that are received within one frame
+
+  char* pram_0 = finalcut::C_STR("./a.out");
+  char** parms = &pram_0;
+  finalcut::FApplication app(1, parms);
+  CPPUNIT_ASSERT ( ! finalcut::FApplication::isQuit() );  // Need in processQueuedInput()
+
+  finalcut::FMouseControl mouse_control;
+  std::vector<finalcut::FMouseData> events{};
+  auto cmd = [&events] (const finalcut::FMouseData& md)
+             {
+               events.push_back(md);
+             };
+  finalcut::FMouseCommand mouse_cmd (cmd);
+  mouse_control.setEventCommand (mouse_cmd);
+  mouse_control.setStdinNo(fileno(stdin));
+  mouse_control.setMaxWidth(100);
+  mouse_control.setMaxHeight(40);
+  mouse_control.useXtermMouse(true);
+  mouse_control.enable();
+  auto tv = finalcut::FObjectTimer::getCurrentTime();
+
+  auto send = [&mouse_control, &tv] (const std::string& report)
+              {
+                finalcut::FKeyboard::keybuffer buffer;
+
+                for (const char& ch : report)
+                  buffer.push(ch);
+
+                mouse_control.setRawData (finalcut::FMouse::MouseType::Sgr, buffer);
+                mouse_control.processEvent (tv);
+              };
+
+  // 1000 mouse moves are more than the mouse queue can hold
+  constexpr int moves = 1000;
+  send ("\033[<0;1;1M");
+
+  for (auto i{1}; i <= moves; i++)
+  {
+    const auto x = std::to_string(i % 100 + 1);
+    const auto y = std::to_string(i % 40 + 1);
+    send ("\033[<32;" + x + ";" + y + "M");
+  }
+
+  send ("\033[<0;1;1m");
+  mouse_control.processQueuedInput();
+
+  // Only the last position of the drag is dispatched
+  CPPUNIT_ASSERT ( events.size() == 3 );
+  CPPUNIT_ASSERT ( events[0].isLeftButtonPressed() );
+  CPPUNIT_ASSERT ( events[1].isMoved() );
+  CPPUNIT_ASSERT ( events[1].getPos() == finalcut::FPoint(moves % 100 + 1, moves % 40 + 1) );
+  CPPUNIT_ASSERT ( events[2].isLeftButtonReleased() );
+  CPPUNIT_ASSERT ( ! mouse_control.hasDataInQueue() );
+
+  // 1000 wheel steps become one event with the full step count
+  constexpr int steps = 1000;
+  events.clear();
+
+  for (auto i{0}; i < steps; i++)
+    send ("\033[<65;20;10M");
+
+  mouse_control.processQueuedInput();
+  CPPUNIT_ASSERT ( events.size() == 1 );
+  CPPUNIT_ASSERT ( events[0].isWheelDown() );
+  CPPUNIT_ASSERT ( events[0].getWheelDelta() == steps );
+  CPPUNIT_ASSERT ( events[0].getPos() == finalcut::FPoint(20, 10) );
+
+  mouse_control.disable();
+}
+
 //----------------------------------------------------------------------
 auto FMouseTest::insertData (std::initializer_list<char> list) -> finalcut::FKeyboard::keybuffer
 {
@@ -66,6 +66,7 @@ class FOptiAttrTest : public CPPUNIT_NS::TestFixture
     void vga2ansiTest();
     void sgrOptimizerTest();
     void fakeReverseTest();
+    void transitionCacheTest();
     void ansiTest();
     void vt100Test();
     void xtermTest();
@@ -89,6 +90,7 @@ class FOptiAttrTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (vga2ansiTest);
     CPPUNIT_TEST (sgrOptimizerTest);
     CPPUNIT_TEST (fakeReverseTest);
+    CPPUNIT_TEST (transitionCacheTest);
     CPPUNIT_TEST (ansiTest);
     CPPUNIT_TEST (vt100Test);
     CPPUNIT_TEST (xtermTest);
@@ -429,6 +431,91 @@ void FOptiAttrTest::fakeReverseTest()
   CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
 }
 
+//----------------------------------------------------------------------
+void FOptiAttrTest::transitionCacheTest()
+{
+  finalcut::FStartOptions::getInstance().sgr_optimizer = false;
+  finalcut::FOptiAttr oa;
+  oa.setDefaultColorSupport();  // ANSI default color
+  oa.setMaxColor (8);
+  oa.setNoColorVideo (0);
+  oa.set_enter_bold_mode (CSI "1m");
+  oa.set_exit_bold_mode (CSI "22m");
+  oa.set_exit_attribute_mode (CSI "0m");
+  oa.set_a_foreground_color (CSI "3%p1%dm");
+  oa.set_a_background_color (CSI "4%p1%dm");
+  oa.set_orig_pair (CSI "39;49m");
+  oa.initialize();
+
+  // Gray text on blue background
+  finalcut::FChar from{};
+  finalcut::FChar to{};
+  to.fg_color = finalcut::FColor::LightGray;
+  to.bg_color = finalcut::FColor::Blue;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
+                        , CSI "37m" CSI "44m" );
+  CPPUNIT_ASSERT ( from == to );
+
+  // The same transition again comes from the cache
+  from = finalcut::FChar{};
+  from.attr.bit.printed = true;
+  to.attr.bit.no_changes = true;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
+                        , CSI "37m" CSI "44m" );
+  CPPUNIT_ASSERT ( from.fg_color == finalcut::FColor::LightGray );
+  CPPUNIT_ASSERT ( from.bg_color == finalcut::FColor::Blue );
+  CPPUNIT_ASSERT ( from.attr.bit.printed );     // Not part of the key
+  CPPUNIT_ASSERT ( ! from.attr.bit.no_changes );
+  CPPUNIT_ASSERT ( to.attr.bit.no_changes );
+  CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
+
+  // Bold on and off
+  to.attr.bit.bold = true;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to), CSI "1m" );
+  CPPUNIT_ASSERT ( from.attr.bit.bold );
+  to.attr.bit.bold = false;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
+                        , CSI "0m" CSI "37m" CSI "44m" );
+  CPPUNIT_ASSERT ( ! from.attr.bit.bold );
+  to.attr.bit.bold = true;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to), CSI "1m" );
+  CPPUNIT_ASSERT ( from.attr.bit.bold );
+  to.attr.bit.bold = false;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
+                        , CSI "0m" CSI "37m" CSI "44m" );
+  CPPUNIT_ASSERT ( ! from.attr.bit.bold );
+
+  // A changed SGR optimizer option invalidates the cache
+  from = finalcut::FChar{};
+  finalcut::FStartOptions::getInstance().sgr_optimizer = true;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to), CSI "37;44m" );
+  CPPUNIT_ASSERT ( from.fg_color == finalcut::FColor::LightGray );
+  CPPUNIT_ASSERT ( from.bg_color == finalcut::FColor::Blue );
+  finalcut::FStartOptions::getInstance().sgr_optimizer = false;
+
+  // A changed capability invalidates the cache after initialize()
+  from = finalcut::FChar{};
+  oa.set_a_foreground_color (CSI "38;5;%p1%dm");
+  oa.initialize();
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
+                        , CSI "38;5;7m" CSI "44m" );
+  CPPUNIT_ASSERT ( from.fg_color == finalcut::FColor::LightGray );
+
+  // A changed color setting invalidates the cache
+  from = finalcut::FChar{};
+  from.fg_color = finalcut::FColor::Red;
+  from.bg_color = finalcut::FColor::Blue;
+  to = finalcut::FChar{};
+  to.fg_color = finalcut::FColor::Default;
+  to.bg_color = finalcut::FColor::Blue;
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to), CSI "39m" );
+  from.fg_color = finalcut::FColor::Red;
+  from.bg_color = finalcut::FColor::Blue;
+  oa.unsetDefaultColorSupport();
+  CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
+                        , CSI "39;49m" CSI "44m" );
+}
+
 //----------------------------------------------------------------------
 void FOptiAttrTest::ansiTest()
 {
@@ -1114,7 +1201,7 @@ void FOptiAttrTest::vt100Test()
   CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
                         , CSI "0m\017$<2>" );
   CPPUNIT_ASSERT ( from == to );
-  CPPUNIT_ASSERT ( to.encoded_char[0] == ' ' );
+  CPPUNIT_ASSERT ( oa.isSimulatedInvisible(to) );
   CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
 
   // Invisible off (with default colors)
@@ -2057,7 +2144,7 @@ void FOptiAttrTest::rxvtTest()
   CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
                         , CSI "0m\017" );
   CPPUNIT_ASSERT ( from == to );
-  CPPUNIT_ASSERT ( to.encoded_char[0] == ' ' );
+  CPPUNIT_ASSERT ( oa.isSimulatedInvisible(to) );
   CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
 
   // Invisible off (with default colors)
@@ -2527,7 +2614,7 @@ void FOptiAttrTest::linuxTest()
   CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
                         , CSI "0m\017" );
   CPPUNIT_ASSERT ( from == to );
-  CPPUNIT_ASSERT ( to.encoded_char[0] == ' ' );
+  CPPUNIT_ASSERT ( oa.isSimulatedInvisible(to) );
   CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
 
   // Invisible off (with default colors)
@@ -3002,7 +3089,7 @@ void FOptiAttrTest::puttyTest()
   CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
                         , CSI "0m\017" );
   CPPUNIT_ASSERT ( from == to );
-  CPPUNIT_ASSERT ( to.encoded_char[0] == ' ' );
+  CPPUNIT_ASSERT ( oa.isSimulatedInvisible(to) );
   CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
 
   // Invisible off (with default colors)
@@ -3473,7 +3560,7 @@ void FOptiAttrTest::teratermTest()
   CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to)
                         , CSI "0m\017$<2>" );
   CPPUNIT_ASSERT ( from == to );
-  CPPUNIT_ASSERT ( to.encoded_char[0] == ' ' );
+  CPPUNIT_ASSERT ( oa.isSimulatedInvisible(to) );
   CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
 
   // Invisible off (with default colors)
@@ -3927,7 +4014,7 @@ void FOptiAttrTest::ibmColorTest()
   CPPUNIT_ASSERT ( from != to );
   CPPUNIT_ASSERT_STRING ( oa.changeAttribute(from, to), "" );
   CPPUNIT_ASSERT ( from == to );
-  CPPUNIT_ASSERT ( to.encoded_char[0] == ' ' );
+  CPPUNIT_ASSERT ( oa.isSimulatedInvisible(to) );
   CPPUNIT_ASSERT ( oa.changeAttribute(from, to).empty() );
 
   // Invisible off (with default colors)
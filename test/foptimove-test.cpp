@@ -130,6 +130,7 @@ class FOptiMoveTest : public CPPUNIT_NS::TestFixture
     void noArgumentTest();
     void homeTest();
     void fromLeftToRightTest();
+    void emptyAddressTest();
     void ansiTest();
     void vt100Test();
     void xtermTest();
@@ -151,6 +152,7 @@ class FOptiMoveTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (noArgumentTest);
     CPPUNIT_TEST (homeTest);
     CPPUNIT_TEST (fromLeftToRightTest);
+    CPPUNIT_TEST (emptyAddressTest);
     CPPUNIT_TEST (ansiTest);
     CPPUNIT_TEST (vt100Test);
     CPPUNIT_TEST (xtermTest);
@@ -260,6 +262,29 @@ void FOptiMoveTest::fromLeftToRightTest()
   CPPUNIT_ASSERT_STRING (om.moveCursor (3, 2, 79, 2), "\r\b" ESC "D");
 }
 
+//----------------------------------------------------------------------
+void FOptiMoveTest::emptyAddressTest()
+{
+  // A cursor address that results in an empty string
+  // is replaced by a relative movement
+  finalcut::FOptiMove om;
+  om.setTermSize (80, 24);
+  om.set_cursor_home (CSI "H");
+  om.set_carriage_return ("\r");
+  om.set_cursor_address ("");
+  om.set_parm_up_cursor (CSI "%p1%dA");
+  om.set_parm_down_cursor (CSI "%p1%dB");
+  om.set_parm_right_cursor (CSI "%p1%dC");
+  om.set_parm_left_cursor (CSI "%p1%dD");
+
+  // Unknown cursor position
+  CPPUNIT_ASSERT_STRING (om.moveCursor (-1, -1, 40, 20), CSI "H" CSI "20B" CSI "40C");
+  // Wide move
+  CPPUNIT_ASSERT_STRING (om.moveCursor (10, 2, 40, 20), CSI "18B" CSI "30C");
+  // Short move
+  CPPUNIT_ASSERT_STRING (om.moveCursor (10, 2, 12, 2), CSI "2C");
+}
+
 //----------------------------------------------------------------------
 void FOptiMoveTest::ansiTest()
 {
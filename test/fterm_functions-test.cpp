@@ -994,6 +994,26 @@ void FTermFunctionsTest::FullWidthHalfWidthTest()
   CPPUNIT_ASSERT ( finalcut::getColumnWidth(L"1234567 one ＣＵＴ more") == 23 );
   CPPUNIT_ASSERT ( finalcut::getColumnWidth(L"o\U0000031b\U00000323=\U00001ee3") == 3 );
   CPPUNIT_ASSERT ( finalcut::getColumnWidth(L"STARGΛ̊TE") == 8 );
+  CPPUNIT_ASSERT ( finalcut::getColumnWidth(finalcut::FString(1000, L'x')) == 1000 );
+  CPPUNIT_ASSERT ( finalcut::getColumnWidth(finalcut::FString(999, L'x') + L"你") == 1001 );
+
+  // Unicode width table
+  CPPUNIT_ASSERT ( finalcut::getUnicodeWidth(L'\0') == 0 );
+  CPPUNIT_ASSERT ( finalcut::getUnicodeWidth(L'\t') == 0 );
+  CPPUNIT_ASSERT ( finalcut::getUnicodeWidth(L'A') == 1 );
+  CPPUNIT_ASSERT ( finalcut::getUnicodeWidth(L'\U000000ad') == 1 );  // Soft hyphen
+  CPPUNIT_ASSERT ( finalcut::getUnicodeWidth(L'\U000000e9') == 1 );
+  CPPUNIT_ASSERT ( finalcut::getUnicodeWidth(L'\U00000300') == 0 );  // Combining grave accent
+  CPPUNIT_ASSERT ( finalcut::getUnicodeWidth(L'\U00001160') == 0 );  // Hangul jungseong filler
+  CPPUNIT_ASSERT ( finalcut::getUnicodeWidth(L'\U0000200b') == 0 );  // Zero width space
+  CPPUNIT_ASSERT ( finalcut::getUnicodeWidth(L'\U00002500') == 1 );  // Box drawing
+  CPPUNIT_ASSERT ( finalcut::getUnicodeWidth(L'\U00004e00') == 2 );  // CJK ideograph
+  CPPUNIT_ASSERT ( finalcut::getUnicodeWidth(L'\U0000ac00') == 2 );  // Hangul syllable
+  CPPUNIT_ASSERT ( finalcut::getUnicodeWidth(L'\U0000ff10') == 2 );  // Fullwidth digit zero
+  CPPUNIT_ASSERT ( finalcut::getUnicodeWidth(L'\U0001f600') == 2 );  // Emoji
+  CPPUNIT_ASSERT ( finalcut::getUnicodeWidth(L'\U0002a6df') == 2 );  // CJK extension B
+  CPPUNIT_ASSERT ( finalcut::getUnicodeWidth(L'\U000e0001') == 0 );  // Language tag
+  CPPUNIT_ASSERT ( finalcut::getUnicodeWidth(wchar_t(0x110000)) == 0 );
 
   // Column width (FString) with end position
   CPPUNIT_ASSERT ( finalcut::getColumnWidth(L"\v\t 100", 0) == 0 );
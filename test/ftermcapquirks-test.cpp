@@ -105,6 +105,11 @@ static tcap_map tcap[] =
   { nullptr, "Ss" },  // set cursor style
   { nullptr, "sf" },  // scroll_forward
   { nullptr, "sr" },  // scroll_reverse
+  { nullptr, "cs" },  // change_scroll_region
+  { nullptr, "al" },  // insert_line
+  { nullptr, "dl" },  // delete_line
+  { nullptr, "AL" },  // parm_insert_line
+  { nullptr, "DL" },  // parm_delete_line
   { nullptr, "ti" },  // enter_ca_mode
   { nullptr, "te" },  // exit_ca_mode
   { nullptr, "eA" },  // enable_acs
@@ -31,6 +31,11 @@
 #include <sys/wait.h>
 #include <sys/mman.h>
 
+#include <array>
+#include <chrono>
+#include <string>
+#include <thread>
+
 #include <conemu.h>
 #include <final/final.h>
 
@@ -71,6 +76,8 @@ class FTermDetectionTest : public CPPUNIT_NS::TestFixture
     void mltermTest();
     void kittyTest();
     void ttytypeTest();
+    void detectionCacheTest();
+    void detectionCacheWithoutSecDATest();
 
   private:
     // Adds code needed to register the test suite
@@ -102,6 +109,8 @@ class FTermDetectionTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (mltermTest);
     CPPUNIT_TEST (kittyTest);
     CPPUNIT_TEST (ttytypeTest);
+    CPPUNIT_TEST (detectionCacheTest);
+    CPPUNIT_TEST (detectionCacheWithoutSecDATest);
 
     // End of test suite definition
     CPPUNIT_TEST_SUITE_END();
@@ -2090,6 +2099,174 @@ void FTermDetectionTest::ttytypeTest()
   rmdir("new-root-dir");
 }
 
+//----------------------------------------------------------------------
+void FTermDetectionTest::detectionCacheTest()
+{
+  // Startup-time benchmark over a simulated remote connection
+
+  std::array<char, 32> cache_home{"/tmp/finalcut-cache-XXXXXX"};
+
+  if ( ! mkdtemp(cache_home.data()) )
+    return;
+
+  const std::string cache_file = std::string(cache_home.data())
+                               + "/finalcut/terminal-detection";
+  auto& data = finalcut::FTermData::getInstance();
+  data.setTermType("xterm");
+  setConEmuLatency(50);  // 50 ms round-trip time
+
+  pid_t pid = forkConEmu();
+
+  if ( isConEmuChildProcess(pid) )
+  {
+    // (gdb) set follow-fork-mode child
+    setenv ("XDG_CACHE_HOME", cache_home.data(), 1);
+    unsetenv ("TERMCAP");
+    unsetenv ("COLORTERM");
+    unsetenv ("COLORFGBG");
+    unsetenv ("VTE_VERSION");
+    unsetenv ("XTERM_VERSION");
+    unsetenv ("ROXTERM_ID");
+    unsetenv ("KONSOLE_DBUS_SESSION");
+    unsetenv ("KONSOLE_DCOP");
+    unsetenv ("TMUX");
+    unsetenv ("KITTY_WINDOW_ID");
+
+    auto startup = [&data] (finalcut::FString& termtype)
+    {
+      // Returns the detection time in milliseconds
+      setenv ("TERM", "xterm", 1);
+      data.unsetTermType(finalcut::FTermType::putty);
+      finalcut::FTermDetection detect;
+      detect.setDetectionCache();
+      const auto start = std::chrono::steady_clock::now();
+      detect.detect();
+      const auto end = std::chrono::steady_clock::now();
+      CPPUNIT_ASSERT ( detect.hasDetectionCache() );
+      CPPUNIT_ASSERT ( data.isTermType(finalcut::FTermType::putty) );
+      termtype = detect.getTermType();
+      using std::chrono::milliseconds;
+      return std::chrono::duration_cast<milliseconds>(end - start).count();
+    };
+
+    // First start with all terminal queries
+    finalcut::FString first_termtype{};
+    const auto first_time = startup(first_termtype);
+    CPPUNIT_ASSERT ( access(cache_file.c_str(), R_OK) == 0 );
+
+    // Discard late replies
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    tcflush (0, TCIFLUSH);
+
+    // Second start with only the SEC_DA query for validation
+    finalcut::FString second_termtype{};
+    const auto second_time = startup(second_termtype);
+    CPPUNIT_ASSERT ( first_termtype == "putty" );
+    CPPUNIT_ASSERT ( second_termtype == first_termtype );
+    CPPUNIT_ASSERT ( second_time < first_time );
+
+    printConEmuDebug();
+    closeConEmuStdStreams();
+    unsetenv ("TERM");
+    unsetenv ("XDG_CACHE_HOME");
+    exit(EXIT_SUCCESS);
+  }
+  else  // Parent
+  {
+    // Start the terminal emulation
+    startConEmuTerminal (ConEmu::console::putty);
+    int wstatus;
+
+    if ( waitpid(pid, &wstatus, WUNTRACED) != pid )
+      std::cerr << "waitpid error" << std::endl;
+
+    if ( WIFEXITED(wstatus) )
+      CPPUNIT_ASSERT ( WEXITSTATUS(wstatus) == 0 );
+  }
+
+  setConEmuLatency(0);
+  unlink(cache_file.c_str());
+  rmdir((std::string(cache_home.data()) + "/finalcut").c_str());
+  rmdir(cache_home.data());
+}
+
+//----------------------------------------------------------------------
+void FTermDetectionTest::detectionCacheWithoutSecDATest()
+{
+  // A terminal without SEC_DA reply is only asked once
+
+  std::array<char, 32> cache_home{"/tmp/finalcut-cache-XXXXXX"};
+
+  if ( ! mkdtemp(cache_home.data()) )
+    return;
+
+  auto& data = finalcut::FTermData::getInstance();
+  data.setTermType("st-256color");
+
+  pid_t pid = forkConEmu();
+
+  if ( isConEmuChildProcess(pid) )
+  {
+    // (gdb) set follow-fork-mode child
+    setenv ("XDG_CACHE_HOME", cache_home.data(), 1);
+    unsetenv ("TERMCAP");
+    unsetenv ("COLORTERM");
+    unsetenv ("COLORFGBG");
+    unsetenv ("VTE_VERSION");
+    unsetenv ("XTERM_VERSION");
+    unsetenv ("ROXTERM_ID");
+    unsetenv ("KONSOLE_DBUS_SESSION");
+    unsetenv ("KONSOLE_DCOP");
+    unsetenv ("TMUX");
+    unsetenv ("KITTY_WINDOW_ID");
+
+    auto startup = [] (bool cache)
+    {
+      // Returns the detection time in milliseconds
+      setenv ("TERM", "st-256color", 1);
+      finalcut::FTermDetection detect;
+      detect.setDetectionCache(cache);
+      const auto start = std::chrono::steady_clock::now();
+      detect.detect();
+      const auto end = std::chrono::steady_clock::now();
+      CPPUNIT_ASSERT ( detect.getSecDAString() == "" );
+      using std::chrono::milliseconds;
+      return std::chrono::duration_cast<milliseconds>(end - start).count();
+    };
+
+    const auto time_without_cache = startup(false);
+    const auto time_with_cache = startup(true);
+
+    // A second SEC_DA timeout would take 600 ms
+    CPPUNIT_ASSERT ( time_with_cache < time_without_cache + 300 );
+
+    printConEmuDebug();
+    closeConEmuStdStreams();
+    unsetenv ("TERM");
+    unsetenv ("XDG_CACHE_HOME");
+    exit(EXIT_SUCCESS);
+  }
+  else  // Parent
+  {
+    // Start the terminal emulation
+    startConEmuTerminal (ConEmu::console::stterm);
+    int wstatus;
+
+    if ( waitpid(pid, &wstatus, WUNTRACED) != pid )
+      std::cerr << "waitpid error" << std::endl;
+
+    if ( WIFEXITED(wstatus) )
+      CPPUNIT_ASSERT ( WEXITSTATUS(wstatus) == 0 );
+  }
+
+  // No cache file is written without SEC_DA
+  CPPUNIT_ASSERT ( access ( (std::string(cache_home.data())
+                             + "/finalcut/terminal-detection").c_str()
+                          , F_OK ) != 0 );
+  rmdir((std::string(cache_home.data()) + "/finalcut").c_str());
+  rmdir(cache_home.data());
+}
+
 
 // Put the test suite in the registry
 CPPUNIT_TEST_SUITE_REGISTRATION (FTermDetectionTest);
@@ -83,6 +83,10 @@ class FSystemTest : public finalcut::FSystem
                        , const struct itimerspec*
                        , struct itimerspec* ) -> int override;
     auto timer_delete (timer_t) -> int override;
+    auto timerfd_create (int, int) -> int override;
+    auto timerfd_settime ( int, int
+                         , const struct itimerspec*
+                         , struct itimerspec* ) -> int override;
     auto kqueue() -> int override;
     auto kevent ( int, const struct kevent*
                 , int, struct kevent*
@@ -307,6 +311,20 @@ auto FSystemTest::timer_delete (timer_t) -> int
   return 0;
 }
 
+//----------------------------------------------------------------------
+auto FSystemTest::timerfd_create (int, int) -> int
+{
+  return 0;
+}
+
+//----------------------------------------------------------------------
+auto FSystemTest::timerfd_settime ( int, int
+                                  , const struct itimerspec*
+                                  , struct itimerspec* ) -> int
+{
+  return 0;
+}
+
 //----------------------------------------------------------------------
 auto FSystemTest::kqueue() -> int
 {
@@ -0,0 +1,217 @@
+/***********************************************************************
+* ftermoutput-test.cpp - FTermOutput unit tests                        *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2023 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <string>
+#include <vector>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+#ifdef TCAP
+  #undef TCAP
+#endif
+#define TCAP(...)  finalcut::FTermcap::strings[int(finalcut::Termcap::__VA_ARGS__)].string
+
+namespace test
+{
+
+using Sequences = std::vector<std::string>;
+
+//----------------------------------------------------------------------
+inline auto shiftLines (uInt top, uInt bottom, int count)
+    -> Sequences
+{
+  // Line shift on a terminal with 24 lines
+
+  const finalcut::FVTerm::FLineShift shift{top, bottom, count, 0};
+  return finalcut::FTermOutput::getLineShiftSequences(shift, 23);
+}
+
+//----------------------------------------------------------------------
+inline void setLineCapabilities()
+{
+  // xterm-like line capabilities without a scroll region
+
+  TCAP(t_cursor_address) = CSI "%i%p1%d;%p2%dH";
+  TCAP(t_change_scroll_region) = nullptr;
+  TCAP(t_scroll_forward) = nullptr;
+  TCAP(t_scroll_reverse) = nullptr;
+  TCAP(t_delete_line) = CSI "M";
+  TCAP(t_parm_delete_line) = CSI "%p1%dM";
+  TCAP(t_insert_line) = CSI "L";
+  TCAP(t_parm_insert_line) = CSI "%p1%dL";
+}
+
+//----------------------------------------------------------------------
+inline void resetLineCapabilities()
+{
+  TCAP(t_cursor_address) = nullptr;
+  TCAP(t_change_scroll_region) = nullptr;
+  TCAP(t_scroll_forward) = nullptr;
+  TCAP(t_scroll_reverse) = nullptr;
+  TCAP(t_delete_line) = nullptr;
+  TCAP(t_parm_delete_line) = nullptr;
+  TCAP(t_insert_line) = nullptr;
+  TCAP(t_parm_insert_line) = nullptr;
+}
+
+}  // namespace test
+
+
+//----------------------------------------------------------------------
+// class FTermOutputTest
+//----------------------------------------------------------------------
+
+class FTermOutputTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FTermOutputTest() = default;
+
+  protected:
+    void scrollRegionTest();
+    void insertDeleteLineTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FTermOutputTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (scrollRegionTest);
+    CPPUNIT_TEST (insertDeleteLineTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+//----------------------------------------------------------------------
+void FTermOutputTest::scrollRegionTest()
+{
+  // Cursor addressing without the cursor movement optimization
+  finalcut::FTermData::getInstance().supportCursorOptimisation(false);
+  test::setLineCapabilities();
+  TCAP(t_change_scroll_region) = CSI "%i%p1%d;%p2%dr";
+  TCAP(t_scroll_forward) = "\n";
+  TCAP(t_scroll_reverse) = "\033M";
+
+  // Scroll up: index at the bottom of the region
+  test::Sequences seq = test::shiftLines(2, 10, 3);
+  CPPUNIT_ASSERT ( seq.size() == 4 );
+  CPPUNIT_ASSERT ( seq[0] == CSI "3;11r" );
+  CPPUNIT_ASSERT ( seq[1] == CSI "11;1H" );
+  CPPUNIT_ASSERT ( seq[2] == "\n\n\n" );
+  CPPUNIT_ASSERT ( seq[3] == CSI "1;24r" );
+
+  // Scroll down: reverse index at the top of the region
+  seq = test::shiftLines(2, 10, -2);
+  CPPUNIT_ASSERT ( seq.size() == 4 );
+  CPPUNIT_ASSERT ( seq[0] == CSI "3;11r" );
+  CPPUNIT_ASSERT ( seq[1] == CSI "3;1H" );
+  CPPUNIT_ASSERT ( seq[2] == "\033M\033M" );
+  CPPUNIT_ASSERT ( seq[3] == CSI "1;24r" );
+
+  // Region up to the last line
+  seq = test::shiftLines(0, 23, 1);
+  CPPUNIT_ASSERT ( seq.size() == 4 );
+  CPPUNIT_ASSERT ( seq[0] == CSI "1;24r" );
+  CPPUNIT_ASSERT ( seq[1] == CSI "24;1H" );
+  CPPUNIT_ASSERT ( seq[2] == "\n" );
+  CPPUNIT_ASSERT ( seq[3] == CSI "1;24r" );
+
+  // Without reverse index the lines are deleted and inserted
+  TCAP(t_scroll_reverse) = nullptr;
+  seq = test::shiftLines(2, 10, 3);
+  CPPUNIT_ASSERT ( seq.size() == 4 );
+  CPPUNIT_ASSERT ( seq[0] == CSI "3;1H" );
+  CPPUNIT_ASSERT ( seq[1] == CSI "3M" );
+
+  test::resetLineCapabilities();
+  finalcut::FTermData::getInstance().supportCursorOptimisation(true);
+}
+
+//----------------------------------------------------------------------
+void FTermOutputTest::insertDeleteLineTest()
+{
+  finalcut::FTermData::getInstance().supportCursorOptimisation(false);
+  test::setLineCapabilities();
+
+  // Scroll up: delete at the top, insert at the bottom
+  test::Sequences seq = test::shiftLines(2, 10, 3);
+  CPPUNIT_ASSERT ( seq.size() == 4 );
+  CPPUNIT_ASSERT ( seq[0] == CSI "3;1H" );
+  CPPUNIT_ASSERT ( seq[1] == CSI "3M" );
+  CPPUNIT_ASSERT ( seq[2] == CSI "9;1H" );
+  CPPUNIT_ASSERT ( seq[3] == CSI "3L" );
+
+  // Scroll up to the last line: nothing to insert
+  seq = test::shiftLines(5, 23, 1);
+  CPPUNIT_ASSERT ( seq.size() == 2 );
+  CPPUNIT_ASSERT ( seq[0] == CSI "6;1H" );
+  CPPUNIT_ASSERT ( seq[1] == CSI "M" );
+
+  // Scroll down: delete at the bottom first, then insert at the top
+  seq = test::shiftLines(2, 10, -2);
+  CPPUNIT_ASSERT ( seq.size() == 4 );
+  CPPUNIT_ASSERT ( seq[0] == CSI "10;1H" );
+  CPPUNIT_ASSERT ( seq[1] == CSI "2M" );
+  CPPUNIT_ASSERT ( seq[2] == CSI "3;1H" );
+  CPPUNIT_ASSERT ( seq[3] == CSI "2L" );
+
+  // Scroll down to the last line: the lines leave the screen
+  seq = test::shiftLines(0, 23, -4);
+  CPPUNIT_ASSERT ( seq.size() == 2 );
+  CPPUNIT_ASSERT ( seq[0] == CSI "1;1H" );
+  CPPUNIT_ASSERT ( seq[1] == CSI "4L" );
+
+  // Without parameterized capabilities the single ones are repeated
+  TCAP(t_parm_delete_line) = nullptr;
+  TCAP(t_parm_insert_line) = nullptr;
+  seq = test::shiftLines(2, 10, 2);
+  CPPUNIT_ASSERT ( seq.size() == 4 );
+  CPPUNIT_ASSERT ( seq[1] == CSI "M" CSI "M" );
+  CPPUNIT_ASSERT ( seq[3] == CSI "L" CSI "L" );
+
+  // Without single capabilities the parameterized ones are used
+  TCAP(t_parm_delete_line) = CSI "%p1%dM";
+  TCAP(t_parm_insert_line) = CSI "%p1%dL";
+  TCAP(t_delete_line) = nullptr;
+  TCAP(t_insert_line) = nullptr;
+  seq = test::shiftLines(2, 10, 1);
+  CPPUNIT_ASSERT ( seq.size() == 4 );
+  CPPUNIT_ASSERT ( seq[1] == CSI "1M" );
+  CPPUNIT_ASSERT ( seq[3] == CSI "1L" );
+
+  test::resetLineCapabilities();
+  finalcut::FTermData::getInstance().supportCursorOptimisation(true);
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FTermOutputTest);
+
+// The general unit test main part
+#include <main-test.inc>
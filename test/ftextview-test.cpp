@@ -0,0 +1,312 @@
+/***********************************************************************
+* ftextview-test.cpp - FTextView unit tests                            *
+*                                                                      *
+* This file is part of the FINAL CUT widget toolkit                    *
+*                                                                      *
+* Copyright 2023 Markus Gans                                           *
+*                                                                      *
+* FINAL CUT is free software; you can redistribute it and/or modify    *
+* it under the terms of the GNU Lesser General Public License as       *
+* published by the Free Software Foundation; either version 3 of       *
+* the License, or (at your option) any later version.                  *
+*                                                                      *
+* FINAL CUT is distributed in the hope that it will be useful, but     *
+* WITHOUT ANY WARRANTY; without even the implied warranty of           *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the        *
+* GNU Lesser General Public License for more details.                  *
+*                                                                      *
+* You should have received a copy of the GNU Lesser General Public     *
+* License along with this program.  If not, see                        *
+* <http://www.gnu.org/licenses/>.                                      *
+***********************************************************************/
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/CompilerOutputter.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/TestResultCollector.h>
+#include <cppunit/TestRunner.h>
+
+#include <final/final.h>
+
+namespace test
+{
+
+using FTextViewList = finalcut::FTextView::FTextViewList;
+using FTextViewLine = finalcut::FTextView::FTextViewLine;
+
+//----------------------------------------------------------------------
+inline auto makeLine (std::size_t n) -> FTextViewLine
+{
+  return FTextViewLine{finalcut::FString(std::to_wstring(n))};
+}
+
+//----------------------------------------------------------------------
+inline void appendLines (FTextViewList& list, std::size_t first, std::size_t count)
+{
+  // Appends the lines "first" to "first + count - 1"
+  // with the line number as column width
+
+  for (auto n{first}; n < first + count; n++)
+    list.insert (list.size(), makeLine(n), n);
+}
+
+//----------------------------------------------------------------------
+inline auto isSequence ( const FTextViewList& list
+                       , std::size_t first
+                       , std::size_t count ) -> bool
+{
+  // Checks index and iterator access to the lines
+  // "first" to "first + count - 1"
+
+  if ( list.size() != count )
+    return false;
+
+  for (std::size_t i{0}; i < count; i++)
+    if ( list[i].text != finalcut::FString(std::to_wstring(first + i)) )
+      return false;
+
+  auto n = first;
+
+  for (const auto& line : list)
+  {
+    if ( line.text != finalcut::FString(std::to_wstring(n)) )
+      return false;
+
+    n++;
+  }
+
+  return n == first + count;
+}
+
+}  // namespace test
+
+
+//----------------------------------------------------------------------
+// class FTextViewTest
+//----------------------------------------------------------------------
+
+class FTextViewTest : public CPPUNIT_NS::TestFixture
+{
+  public:
+    FTextViewTest() = default;
+
+  protected:
+    void classNameTest();
+    void noArgumentTest();
+    void listAppendTest();
+    void listInsertTest();
+    void listEraseTest();
+    void lineLimitTest();
+
+  private:
+    // Adds code needed to register the test suite
+    CPPUNIT_TEST_SUITE (FTextViewTest);
+
+    // Add a methods to the test suite
+    CPPUNIT_TEST (classNameTest);
+    CPPUNIT_TEST (noArgumentTest);
+    CPPUNIT_TEST (listAppendTest);
+    CPPUNIT_TEST (listInsertTest);
+    CPPUNIT_TEST (listEraseTest);
+    CPPUNIT_TEST (lineLimitTest);
+
+    // End of test suite definition
+    CPPUNIT_TEST_SUITE_END();
+};
+
+//----------------------------------------------------------------------
+void FTextViewTest::classNameTest()
+{
+  finalcut::FWidget root{};
+  const finalcut::FTextView textview{&root};
+  const finalcut::FString& classname = textview.getClassName();
+  CPPUNIT_ASSERT ( classname == "FTextView" );
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::noArgumentTest()
+{
+  const test::FTextViewList list{};
+  CPPUNIT_ASSERT ( list.empty() );
+  CPPUNIT_ASSERT ( list.size() == 0 );
+  CPPUNIT_ASSERT ( list.getMaxWidth() == 0 );
+  CPPUNIT_ASSERT ( list.begin() == list.end() );
+  CPPUNIT_ASSERT_THROW ( list.at(0), std::out_of_range );
+
+  finalcut::FWidget root{};
+  const finalcut::FTextView textview{&root};
+  CPPUNIT_ASSERT ( textview.getRows() == 0 );
+  CPPUNIT_ASSERT ( textview.getColumns() == 0 );
+  CPPUNIT_ASSERT ( textview.getLineLimit() == 0 );
+  CPPUNIT_ASSERT ( textview.getLines().empty() );
+  CPPUNIT_ASSERT ( textview.getText().isEmpty() );
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::listAppendTest()
+{
+  // 2000 lines fill several chunks of 512 lines
+  test::FTextViewList list{};
+  test::appendLines (list, 0, 2000);
+  CPPUNIT_ASSERT ( ! list.empty() );
+  CPPUNIT_ASSERT ( test::isSequence(list, 0, 2000) );
+  CPPUNIT_ASSERT ( list.getMaxWidth() == 1999 );
+
+  // Lines at the chunk borders
+  CPPUNIT_ASSERT ( list[511].text == "511" );
+  CPPUNIT_ASSERT ( list[512].text == "512" );
+  CPPUNIT_ASSERT ( list[1023].text == "1023" );
+  CPPUNIT_ASSERT ( list[1024].text == "1024" );
+  CPPUNIT_ASSERT ( list.at(1999).text == "1999" );
+  CPPUNIT_ASSERT_THROW ( list.at(2000), std::out_of_range );
+
+  // Write access
+  list[1000].text = "changed";
+  CPPUNIT_ASSERT ( list.at(1000).text == "changed" );
+
+  list.clear();
+  CPPUNIT_ASSERT ( list.empty() );
+  CPPUNIT_ASSERT ( list.getMaxWidth() == 0 );
+  CPPUNIT_ASSERT ( list.begin() == list.end() );
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::listInsertTest()
+{
+  test::FTextViewList list{};
+  test::appendLines (list, 1, 512);  // One full chunk
+
+  // Inserting into the full chunk splits it
+  list.insert (0, test::makeLine(0), 0);
+  CPPUNIT_ASSERT ( test::isSequence(list, 0, 513) );
+
+  // Insert in the middle of every chunk
+  test::FTextViewList list2{};
+
+  for (std::size_t n{0}; n < 1500; n += 2)
+    list2.insert (list2.size(), test::makeLine(n), 1);
+
+  for (std::size_t n{1}; n < 1500; n += 2)
+    list2.insert (n, test::makeLine(n), 1);
+
+  CPPUNIT_ASSERT ( test::isSequence(list2, 0, 1500) );
+
+  // A position behind the end appends the line
+  list2.insert (99999, test::makeLine(1500), 2);
+  CPPUNIT_ASSERT ( test::isSequence(list2, 0, 1501) );
+  CPPUNIT_ASSERT ( list2.getMaxWidth() == 2 );
+
+  // Insert at the beginning of a later chunk
+  test::FTextViewList list3{};
+  test::appendLines (list3, 0, 1024);
+  list3.erase (512, 513);
+  list3.insert (512, test::makeLine(512), 512);
+  CPPUNIT_ASSERT ( test::isSequence(list3, 0, 1024) );
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::listEraseTest()
+{
+  test::FTextViewList list{};
+  test::appendLines (list, 0, 2000);
+
+  // Empty and inverted ranges
+  list.erase (10, 10);
+  list.erase (20, 10);
+  CPPUNIT_ASSERT ( list.size() == 2000 );
+
+  // Range over three chunks
+  list.erase (500, 1100);
+  CPPUNIT_ASSERT ( list.size() == 1400 );
+  CPPUNIT_ASSERT ( list[499].text == "499" );
+  CPPUNIT_ASSERT ( list[500].text == "1100" );
+  CPPUNIT_ASSERT ( list[1399].text == "1999" );
+
+  // Remove the first lines (the last line is still the widest)
+  list.erase (0, 500);
+  CPPUNIT_ASSERT ( test::isSequence(list, 1100, 900) );
+  CPPUNIT_ASSERT ( list.getMaxWidth() == 1999 );
+
+  // Remove the last lines (the maximum width decreases)
+  list.erase (800, 900);
+  CPPUNIT_ASSERT ( test::isSequence(list, 1100, 800) );
+  CPPUNIT_ASSERT ( list.getMaxWidth() == 1899 );
+
+  // The end is limited to the number of lines
+  list.erase (700, 5000);
+  CPPUNIT_ASSERT ( test::isSequence(list, 1100, 700) );
+
+  // New lines after erasing
+  test::appendLines (list, 1800, 10);
+  CPPUNIT_ASSERT ( test::isSequence(list, 1100, 710) );
+
+  list.erase (0, list.size());
+  CPPUNIT_ASSERT ( list.empty() );
+  CPPUNIT_ASSERT ( list.getMaxWidth() == 0 );
+  CPPUNIT_ASSERT ( list.begin() == list.end() );
+
+  test::appendLines (list, 0, 3);
+  CPPUNIT_ASSERT ( test::isSequence(list, 0, 3) );
+}
+
+//----------------------------------------------------------------------
+void FTextViewTest::lineLimitTest()
+{
+  finalcut::FWidget root{};
+  finalcut::FTextView textview{&root};
+  textview.setLineLimit(100);
+  CPPUNIT_ASSERT ( textview.getLineLimit() == 100 );
+
+  for (int n{0}; n < 250; n++)
+    textview.append (finalcut::FString(std::to_wstring(n)));
+
+  // Only the newest 100 lines remain
+  CPPUNIT_ASSERT ( textview.getRows() == 100 );
+  CPPUNIT_ASSERT ( textview.getLines()[0].text == "150" );
+  CPPUNIT_ASSERT ( textview.getLines()[99].text == "249" );
+  CPPUNIT_ASSERT ( textview.getColumns() == 3 );
+
+  // A batch larger than the limit
+  finalcut::FStringList batch{};
+
+  for (int n{0}; n < 600; n++)
+    batch.emplace_back(std::to_wstring(100'000 + n));
+
+  textview.append (std::move(batch));
+  CPPUNIT_ASSERT ( textview.getRows() == 100 );
+  CPPUNIT_ASSERT ( textview.getLines()[0].text == "100500" );
+  CPPUNIT_ASSERT ( textview.getLines()[99].text == "100599" );
+  CPPUNIT_ASSERT ( textview.getColumns() == 6 );
+
+  // Lowering the limit removes the oldest lines
+  textview.setLineLimit(10);
+  CPPUNIT_ASSERT ( textview.getRows() == 10 );
+  CPPUNIT_ASSERT ( textview.getLines()[0].text == "100590" );
+
+  // Inserted lines count towards the limit
+  textview.insert (finalcut::FString{"top"}, 0);
+  CPPUNIT_ASSERT ( textview.getRows() == 10 );
+  CPPUNIT_ASSERT ( textview.getLines()[0].text == "100590" );
+
+  // Without limit the lines are kept
+  textview.setLineLimit(0);
+  textview.append (finalcut::FString{"end"});
+  CPPUNIT_ASSERT ( textview.getRows() == 11 );
+  CPPUNIT_ASSERT ( textview.getLines()[10].text == "end" );
+
+  textview.clear();
+  CPPUNIT_ASSERT ( textview.getRows() == 0 );
+  CPPUNIT_ASSERT ( textview.getColumns() == 0 );
+}
+
+// Put the test suite in the registry
+CPPUNIT_TEST_SUITE_REGISTRATION (FTextViewTest);
+
+// The general unit test main part
+#include <main-test.inc>
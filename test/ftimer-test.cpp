@@ -22,6 +22,7 @@
 
 #include <chrono>
 #include <thread>
+#include <vector>
 
 #include <cppunit/BriefTestProgressListener.h>
 #include <cppunit/CompilerOutputter.h>
@@ -114,6 +115,7 @@ class FTimerTest : public CPPUNIT_NS::TestFixture
     void classNameTest();
     void timeTest();
     void timerTest();
+    void timerOrderTest();
     void performTimerActionTest();
 
   private:
@@ -124,6 +126,7 @@ class FTimerTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (classNameTest);
     CPPUNIT_TEST (timeTest);
     CPPUNIT_TEST (timerTest);
+    CPPUNIT_TEST (timerOrderTest);
     CPPUNIT_TEST (performTimerActionTest);
 
     // End of test suite definition
@@ -276,6 +279,61 @@ void FTimerTest::timerTest()
   CPPUNIT_ASSERT ( ! t1.delTimer(-1) );
 }
 
+//----------------------------------------------------------------------
+void FTimerTest::timerOrderTest()
+{
+  test::FTimer_protected t1;
+  CPPUNIT_ASSERT ( t1.getTimerList()->empty() );
+  CPPUNIT_ASSERT ( finalcut::FObjectTimer::getNextTimeout() == TimeValue::max() );
+
+  const auto start = finalcut::FObjectTimer::getCurrentTime();
+  const int id1 = t1.addTimer(5000);
+  const int id2 = t1.addTimer(300);
+  const int id3 = t1.addTimer(1000);
+  const int id4 = t1.addTimer(200);
+  CPPUNIT_ASSERT ( t1.getTimerList()->size() == 4 );
+
+  // The next timeout is always the earliest timer
+  auto next = finalcut::FObjectTimer::getNextTimeout();
+  CPPUNIT_ASSERT ( start + std::chrono::milliseconds(200) <= next );
+  CPPUNIT_ASSERT ( next < start + std::chrono::milliseconds(300) );
+
+  CPPUNIT_ASSERT ( t1.delTimer(id4) );
+  next = finalcut::FObjectTimer::getNextTimeout();
+  CPPUNIT_ASSERT ( start + std::chrono::milliseconds(300) <= next );
+  CPPUNIT_ASSERT ( next < start + std::chrono::milliseconds(1000) );
+
+  CPPUNIT_ASSERT ( t1.delTimer(id2) );
+  CPPUNIT_ASSERT ( ! t1.delTimer(id2) );
+  next = finalcut::FObjectTimer::getNextTimeout();
+  CPPUNIT_ASSERT ( start + std::chrono::milliseconds(1000) <= next );
+  CPPUNIT_ASSERT ( next < start + std::chrono::milliseconds(5000) );
+
+  CPPUNIT_ASSERT ( t1.delTimer(id3) );
+  CPPUNIT_ASSERT ( t1.delTimer(id1) );
+  CPPUNIT_ASSERT ( t1.getTimerList()->empty() );
+  CPPUNIT_ASSERT ( finalcut::FObjectTimer::getNextTimeout() == TimeValue::max() );
+
+  // Many timers with cancellation in arbitrary order
+  std::vector<int> ids{};
+
+  for (auto i = 0; i < 1000; i++)
+    ids.push_back(t1.addTimer(1000 + (i * 7919) % 59000));
+
+  CPPUNIT_ASSERT ( t1.getTimerList()->size() == 1000 );
+  next = finalcut::FObjectTimer::getNextTimeout();
+  CPPUNIT_ASSERT ( next < start + std::chrono::milliseconds(2000) );
+
+  for (std::size_t i = 0; i < ids.size(); i += 2)
+    CPPUNIT_ASSERT ( t1.delTimer(ids[i]) );
+
+  CPPUNIT_ASSERT ( t1.getTimerList()->size() == 500 );
+  CPPUNIT_ASSERT ( finalcut::FObjectTimer::getNextTimeout() >= next );
+  CPPUNIT_ASSERT ( t1.processEvent() == 0 );  // Nothing expired yet
+  CPPUNIT_ASSERT ( t1.delOwnTimers() );
+  CPPUNIT_ASSERT ( t1.getTimerList()->empty() );
+}
+
 //----------------------------------------------------------------------
 void FTimerTest::performTimerActionTest()
 {
@@ -94,6 +94,7 @@ class FTermOutputTest : public finalcut::FOutput
     auto isNewFont() const -> bool override;
     auto isEncodable (const wchar_t&) const -> bool override;
     auto isFlushTimeout() const -> bool override;
+    auto hasPendingOutput() const -> bool override;
     auto hasTerminalResized() const -> bool override;
     auto allowsTerminalSizeManipulation() const -> bool override;
     auto canChangeColorPalette() const -> bool override;
@@ -232,6 +233,12 @@ inline auto FTermOutputTest::isFlushTimeout() const -> bool
   return true;
 }
 
+//----------------------------------------------------------------------
+inline auto FTermOutputTest::hasPendingOutput() const -> bool
+{
+  return false;
+}
+
 //----------------------------------------------------------------------
 inline auto FTermOutputTest::hasTerminalResized() const -> bool
 {
@@ -784,7 +791,9 @@ class FVTermTest : public CPPUNIT_NS::TestFixture
     void FVTermChildAreaPrintTest();
     void FVTermScrollTest();
     void FVTermOverlappingWindowsTest();
+    void FVTermOcclusionMapTest();
     void FVTermReduceUpdatesTest();
+    void FVTermLineShiftTest();
     void getFVTermAreaTest();
 
   private:
@@ -800,7 +809,9 @@ class FVTermTest : public CPPUNIT_NS::TestFixture
     CPPUNIT_TEST (FVTermChildAreaPrintTest);
     CPPUNIT_TEST (FVTermScrollTest);
     CPPUNIT_TEST (FVTermOverlappingWindowsTest);
+    CPPUNIT_TEST (FVTermOcclusionMapTest);
     CPPUNIT_TEST (FVTermReduceUpdatesTest);
+    CPPUNIT_TEST (FVTermLineShiftTest);
     CPPUNIT_TEST (getFVTermAreaTest);
 
     // End of test suite definition
@@ -854,7 +865,6 @@ void FVTermTest::OwnFunctionsTest()
 {
   finalcut::FChar shadow_char;
   shadow_char.ch           = { L'\0', L'\0', L'\0', L'\0', L'\0' };
-  shadow_char.encoded_char = { L'\0', L'\0', L'\0', L'\0', L'\0' };
   shadow_char.fg_color     = finalcut::FColor::Default;
   shadow_char.bg_color     = finalcut::FColor::Default;
   shadow_char.attr.byte[0] = 0;
@@ -866,7 +876,6 @@ void FVTermTest::OwnFunctionsTest()
   // FChar struct
   finalcut::FChar test_char =
   {
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Default,
     finalcut::FColor::Default,
@@ -995,7 +1004,6 @@ void FVTermTest::FVTermBasesTest()
 
   finalcut::FChar default_char;
   default_char.ch           = { L' ', L'\0', L'\0', L'\0', L'\0' };
-  default_char.encoded_char = { L'\0', L'\0', L'\0', L'\0', L'\0' };
   default_char.fg_color     = finalcut::FColor::Default;
   default_char.bg_color     = finalcut::FColor::Default;
   default_char.attr.byte[0] = 0;
@@ -1153,7 +1161,6 @@ void FVTermTest::FVTermBasesTest()
   finalcut::FChar bg_char =
   {
     { L'▒', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Default,
     finalcut::FColor::Default,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -1174,7 +1181,6 @@ void FVTermTest::FVTermBasesTest()
   auto width = std::size_t(vwin->size.width);
   finalcut::FChar shadow_char =
   {
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Default,
     finalcut::FColor::Default,
@@ -1497,7 +1503,6 @@ void FVTermTest::FVTermPrintTest()
     finalcut::FChar default_char =
     {
       { L' ', L'\0', L'\0', L'\0', L'\0' },
-      { L'\0', L'\0', L'\0', L'\0', L'\0' },
       finalcut::FColor::Default,
       finalcut::FColor::Default,
       { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -1674,7 +1679,6 @@ void FVTermTest::FVTermPrintTest()
     // std::vector<FChar>
     finalcut::FChar fchar =
     {
-      { L'\0', L'\0', L'\0', L'\0', L'\0' },
       { L'\0', L'\0', L'\0', L'\0', L'\0' },
       finalcut::FColor::Red,
       finalcut::FColor::White,
@@ -2045,13 +2049,21 @@ void FVTermTest::FVTermChildAreaPrintTest()
                    << finalcut::FPoint(36, 10) << L"=        ="
                    << finalcut::FPoint(36, 11) << L"==========";
   CPPUNIT_ASSERT ( vwin->has_changes );
+  CPPUNIT_ASSERT ( vwin->hasChangedLines() );
+  CPPUNIT_ASSERT ( vwin->changed_lines.ymin == 2 );
+  CPPUNIT_ASSERT ( vwin->changed_lines.ymax == 9 );
   test::printArea (vwin);
 
   p_fvterm.p_addLayer(vwin);
+  CPPUNIT_ASSERT ( vwin->hasChangedLines() );  // Hidden areas keep their changes
   vwin->visible = true;  // show()
   vterm->has_changes = false;
+  vterm->resetChangedLines();
   p_fvterm.p_addLayer(vwin);
   CPPUNIT_ASSERT ( vterm->has_changes );
+  CPPUNIT_ASSERT ( ! vwin->hasChangedLines() );
+  CPPUNIT_ASSERT ( vterm->changed_lines.ymin == 3 );
+  CPPUNIT_ASSERT ( vterm->changed_lines.ymax == 10 );
 
   for (auto i{0}; i < 3; i++)
   {
@@ -2077,7 +2089,6 @@ void FVTermTest::FVTermChildAreaPrintTest()
   finalcut::FChar space_char_1 =
   {
     { L' ', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Default,
     finalcut::FColor::Default,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -2086,7 +2097,6 @@ void FVTermTest::FVTermChildAreaPrintTest()
   finalcut::FChar space_char_2 =
   {
     { L' ', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Red,
     finalcut::FColor::White,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -2095,7 +2105,6 @@ void FVTermTest::FVTermChildAreaPrintTest()
   finalcut::FChar equal_sign_char =
   {
     { L'=', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Red,
     finalcut::FColor::White,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -2120,6 +2129,21 @@ void FVTermTest::FVTermChildAreaPrintTest()
   CPPUNIT_ASSERT ( test::isAreaEqual(test_vterm_area, vterm) );
   test::printArea (vterm);
 
+  // A change written directly into area->changes without a
+  // damaged line range is found by a scan of all lines
+  vwin->getFChar(5, 11).ch[0] = L'#';
+  vwin->changes[11].xmin = 5;
+  vwin->changes[11].xmax = 5;
+  vwin->has_changes = true;
+  CPPUNIT_ASSERT ( ! vwin->hasChangedLines() );
+  vterm->resetChangedLines();
+  p_fvterm.p_addLayer(vwin);
+  CPPUNIT_ASSERT ( vterm->getFChar(39, 12).ch[0] == L'#' );
+  CPPUNIT_ASSERT ( vterm->changed_lines.ymin == 12 );
+  CPPUNIT_ASSERT ( vterm->changed_lines.ymax == 12 );
+  CPPUNIT_ASSERT ( vterm->changes[12].xmin == 39 );
+  CPPUNIT_ASSERT ( vterm->changes[12].xmax == 39 );
+
   p_fvterm.delPreprocessingHandler(&p_fvterm);
   p_fvterm.p_setChildPrintArea (nullptr);
 }
@@ -2150,7 +2174,6 @@ void FVTermTest::FVTermScrollTest()
   finalcut::FChar one_char =
   {
     { L'1', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Default,
     finalcut::FColor::Default,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -2178,6 +2201,8 @@ void FVTermTest::FVTermScrollTest()
   test::printArea (vwin);
 
   p_fvterm.p_scrollAreaForward (vwin);
+  CPPUNIT_ASSERT ( vwin->line_offset[0] == 5 );  // Rotated line order
+  CPPUNIT_ASSERT ( vwin->line_offset[4] == 0 );
   test::printOnArea (test_vwin_area, { {5, two_char},
                                        {5, three_char},
                                        {5, four_char},
@@ -2362,6 +2387,53 @@ void FVTermTest::FVTermScrollTest()
                                       { 2, { {80, space_char} } } } );
   CPPUNIT_ASSERT ( test::isAreaEqual(test_vdesktop, vdesktop) );
   test::printArea (vdesktop);
+
+  // Scrolling an area with a right shadow
+
+  auto shadow_geometry = finalcut::FRect( finalcut::FPoint{0, 0}, finalcut::FSize{3, 3} );
+  auto shadow_area_ptr = p_fvterm.p_createArea (shadow_geometry, finalcut::FSize{1, 1});
+  auto shadow_area = shadow_area_ptr.get();
+  finalcut::FChar transparent_char = space_char;
+  transparent_char.attr.bit.transparent = true;
+  finalcut::FChar overlay_char = space_char;
+  overlay_char.attr.bit.color_overlay = true;
+  shadow_area->getFChar(3, 0) = transparent_char;
+  shadow_area->changes[0].trans_count = 1;
+
+  for (auto y{0}; y < 3; y++)
+  {
+    std::fill ( &shadow_area->getFChar(0, y)
+              , &shadow_area->getFChar(0, y) + 3
+              , y == 2 ? transparent_char : one_char );
+
+    if ( y > 0 )
+    {
+      shadow_area->getFChar(3, y) = overlay_char;
+      shadow_area->changes[unsigned(y)].trans_count = 1;
+    }
+  }
+
+  shadow_area->changes[2].trans_count += 3;  // Transparent line
+  p_fvterm.p_scrollAreaForward (shadow_area);
+  CPPUNIT_ASSERT ( shadow_area->getFChar(0, 1).attr.bit.transparent );
+  CPPUNIT_ASSERT ( shadow_area->getFChar(0, 2).attr.bit.transparent );
+  CPPUNIT_ASSERT ( shadow_area->getFChar(3, 0).attr.bit.transparent );
+  CPPUNIT_ASSERT ( shadow_area->getFChar(3, 1).attr.bit.color_overlay );
+  CPPUNIT_ASSERT ( shadow_area->getFChar(3, 2).attr.bit.color_overlay );
+  CPPUNIT_ASSERT ( shadow_area->changes[0].trans_count == 1 );
+  CPPUNIT_ASSERT ( shadow_area->changes[1].trans_count == 4 );
+  CPPUNIT_ASSERT ( shadow_area->changes[2].trans_count == 4 );
+
+  p_fvterm.p_scrollAreaReverse (shadow_area);
+  CPPUNIT_ASSERT ( ! shadow_area->getFChar(0, 0).attr.bit.transparent );
+  CPPUNIT_ASSERT ( shadow_area->getFChar(0, 1) == one_char );
+  CPPUNIT_ASSERT ( shadow_area->getFChar(0, 2).attr.bit.transparent );
+  CPPUNIT_ASSERT ( shadow_area->getFChar(3, 0).attr.bit.transparent );
+  CPPUNIT_ASSERT ( shadow_area->getFChar(3, 1).attr.bit.color_overlay );
+  CPPUNIT_ASSERT ( shadow_area->getFChar(3, 2).attr.bit.color_overlay );
+  CPPUNIT_ASSERT ( shadow_area->changes[0].trans_count == 1 );
+  CPPUNIT_ASSERT ( shadow_area->changes[1].trans_count == 1 );
+  CPPUNIT_ASSERT ( shadow_area->changes[2].trans_count == 4 );
 }
 
 //----------------------------------------------------------------------
@@ -2478,7 +2550,6 @@ void FVTermTest::FVTermOverlappingWindowsTest()
   finalcut::FChar bg_char =
   {
     { L'.', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::DarkGray,
     finalcut::FColor::LightBlue,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -2492,7 +2563,6 @@ void FVTermTest::FVTermOverlappingWindowsTest()
   finalcut::FChar vwin_1_char =  // with color overlay
   {
     { L'.', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Black,
     finalcut::FColor::White,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -2501,7 +2571,6 @@ void FVTermTest::FVTermOverlappingWindowsTest()
   finalcut::FChar vwin_2_char =  // with inherit background
   {
     { L'▒', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Black,
     finalcut::FColor::LightBlue,
     { { 0x00, 0x80, 0x08, 0x00} }  // byte 0..3
@@ -2510,7 +2579,6 @@ void FVTermTest::FVTermOverlappingWindowsTest()
   finalcut::FChar vwin_3_char =  // with transparency
   {
     { L'.', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::DarkGray,
     finalcut::FColor::LightBlue,
     { { 0x00, 0x00, 0x09, 0x00} }  // byte 0..3
@@ -2519,7 +2587,6 @@ void FVTermTest::FVTermOverlappingWindowsTest()
   finalcut::FChar vwin_4_char =
   {
     { L'█', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Black,
     finalcut::FColor::White,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -2692,6 +2759,153 @@ void FVTermTest::FVTermOverlappingWindowsTest()
   CPPUNIT_ASSERT ( test::isAreaEqual(test_area, vterm) );
 }
 
+//----------------------------------------------------------------------
+void FVTermTest::FVTermOcclusionMapTest()
+{
+  // Window 1 and window 2 (both with a transparent shadow) overlap.
+  // The hidden window 3 lies above window 2.
+  //
+  //           x=10                             x=43
+  //      y=5  1111111111111111111111111111111111..
+  //           1111111111111111111111111111111111..
+  //           1111111111111111111111111111111111..
+  //      y=8  1111111111222222222222222222221111..
+  //           1111111111223333332222222222221111..
+  //           1111111111223333332222222222221111..
+  //           ..........223333332222222222......
+  //                     22222222222222222222..
+  //      y=13           22222222222222222222..
+  //                     ......................
+  //                   x=20                x=39
+
+  FVTerm_protected p_fvterm_1(finalcut::outputClass<FTermOutputTest>{});
+  FVTerm_protected p_fvterm_2(finalcut::outputClass<FTermOutputTest>{});
+  FVTerm_protected p_fvterm_3(finalcut::outputClass<FTermOutputTest>{});
+
+  // unique virtual terminal
+  auto&& vterm = p_fvterm_1.p_getVirtualTerminal();
+
+  // Create the virtual windows for the p_fvterm_1..3 objects
+  const finalcut::FSize shadow{2, 1};
+  finalcut::FRect geometry_1 {finalcut::FPoint{10, 5}, finalcut::FSize{34, 6}};
+  finalcut::FRect geometry_2 {finalcut::FPoint{20, 8}, finalcut::FSize{20, 6}};
+  finalcut::FRect geometry_3 {finalcut::FPoint{22, 9}, finalcut::FSize{6, 3}};
+  auto vwin_1_ptr = p_fvterm_1.p_createArea (geometry_1, shadow);
+  auto vwin_2_ptr = p_fvterm_2.p_createArea (geometry_2, shadow);
+  auto vwin_3_ptr = p_fvterm_3.p_createArea (geometry_3);
+  auto vwin_1 = vwin_1_ptr.get();
+  auto vwin_2 = vwin_2_ptr.get();
+  auto vwin_3 = vwin_3_ptr.get();
+  p_fvterm_1.setVWin(std::move(vwin_1_ptr));
+  p_fvterm_2.setVWin(std::move(vwin_2_ptr));
+  p_fvterm_3.setVWin(std::move(vwin_3_ptr));
+
+  CPPUNIT_ASSERT ( p_fvterm_1.getWindowList()->empty() );
+  auto&& window_list = finalcut::FVTerm::getWindowList();
+  window_list->push_back(&p_fvterm_1);
+  window_list->push_back(&p_fvterm_2);
+  window_list->push_back(&p_fvterm_3);
+  p_fvterm_1.p_determineWindowLayers();
+  CPPUNIT_ASSERT ( vwin_1->layer == 1 );
+  CPPUNIT_ASSERT ( vwin_2->layer == 2 );
+  CPPUNIT_ASSERT ( vwin_3->layer == 3 );
+  vwin_1->visible = true;
+  vwin_2->visible = true;
+  vwin_3->visible = false;
+
+  // Fill the windows (clearArea makes the shadow transparent)
+  p_fvterm_1.p_clearArea (vwin_1, L'1');
+  p_fvterm_2.p_clearArea (vwin_2, L'2');
+  p_fvterm_3.p_clearArea (vwin_3, L'3');
+  p_fvterm_1.p_addLayer (vwin_1);
+  p_fvterm_2.p_addLayer (vwin_2);
+  p_fvterm_3.p_addLayer (vwin_3);
+  CPPUNIT_ASSERT ( vterm->getFChar(15, 9).ch[0] == L'1' );
+  CPPUNIT_ASSERT ( vterm->getFChar(25, 9).ch[0] == L'2' );
+  CPPUNIT_ASSERT ( vterm->getFChar(41, 9).ch[0] == L'1' );
+  CPPUNIT_ASSERT ( vterm->getFChar(30, 13).ch[0] == L'2' );
+
+  // Overlapping windows: only the uncovered characters of
+  // a lower window reach the virtual terminal
+  p_fvterm_1.print() << finalcut::FPoint{11, 10} << std::string(34, 'a');
+  CPPUNIT_ASSERT ( vwin_1->has_changes );
+  p_fvterm_1.p_addLayer (vwin_1);
+  CPPUNIT_ASSERT ( vterm->getFChar(15, 9).ch[0] == L'a' );
+  CPPUNIT_ASSERT ( vterm->getFChar(19, 9).ch[0] == L'a' );
+  CPPUNIT_ASSERT ( vterm->getFChar(20, 9).ch[0] == L'2' );  // Window 2
+  CPPUNIT_ASSERT ( vterm->getFChar(23, 9).ch[0] == L'2' );  // Hidden window 3
+  CPPUNIT_ASSERT ( vterm->getFChar(39, 9).ch[0] == L'2' );  // Window 2
+  CPPUNIT_ASSERT ( vterm->getFChar(40, 9).ch[0] == L'a' );  // Transparent shadow
+  CPPUNIT_ASSERT ( vterm->getFChar(41, 9).ch[0] == L'a' );  // Transparent shadow
+  CPPUNIT_ASSERT ( vterm->getFChar(43, 9).ch[0] == L'a' );
+
+  // Raise window 1 above window 2
+  std::swap(window_list->at(0), window_list->at(1));
+  p_fvterm_1.p_determineWindowLayers();
+  CPPUNIT_ASSERT ( vwin_1->layer == 2 );
+  CPPUNIT_ASSERT ( vwin_2->layer == 1 );
+  p_fvterm_1.print() << finalcut::FPoint{11, 10} << std::string(34, 'b');
+  p_fvterm_1.p_addLayer (vwin_1);
+  CPPUNIT_ASSERT ( vterm->getFChar(15, 9).ch[0] == L'b' );
+  CPPUNIT_ASSERT ( vterm->getFChar(25, 9).ch[0] == L'b' );
+  CPPUNIT_ASSERT ( vterm->getFChar(40, 9).ch[0] == L'b' );
+
+  // Changes of window 2 are now covered by window 1,
+  // but not by the transparent bottom shadow of window 1
+  p_fvterm_2.print() << finalcut::FPoint{21, 10} << std::string(20, 'c')
+                     << finalcut::FPoint{21, 12} << std::string(20, 'c');
+  p_fvterm_2.p_addLayer (vwin_2);
+  CPPUNIT_ASSERT ( vterm->getFChar(25, 9).ch[0] == L'b' );
+  CPPUNIT_ASSERT ( vterm->getFChar(39, 9).ch[0] == L'b' );
+  CPPUNIT_ASSERT ( vterm->getFChar(20, 11).ch[0] == L'c' );
+  CPPUNIT_ASSERT ( vterm->getFChar(39, 11).ch[0] == L'c' );
+
+  // Moving window 1 invalidates the occlusion map
+  finalcut::FRect geometry_1_moved {finalcut::FPoint{30, 12}, finalcut::FSize{34, 6}};
+  p_fvterm_1.p_resizeArea (geometry_1_moved, shadow, vwin_1);
+  CPPUNIT_ASSERT ( vwin_1->position.x == 30 );
+  CPPUNIT_ASSERT ( vwin_1->position.y == 12 );
+  p_fvterm_1.p_clearArea (vwin_1, L'1');
+  p_fvterm_1.p_addLayer (vwin_1);
+  CPPUNIT_ASSERT ( vterm->getFChar(30, 12).ch[0] == L'1' );
+  p_fvterm_2.print() << finalcut::FPoint{21, 10} << std::string(20, 'd')
+                     << finalcut::FPoint{21, 14} << std::string(20, 'd');
+  p_fvterm_2.p_addLayer (vwin_2);
+  CPPUNIT_ASSERT ( vterm->getFChar(20, 9).ch[0] == L'd' );  // Uncovered
+  CPPUNIT_ASSERT ( vterm->getFChar(39, 9).ch[0] == L'd' );  // Uncovered
+  CPPUNIT_ASSERT ( vterm->getFChar(29, 13).ch[0] == L'd' );
+  CPPUNIT_ASSERT ( vterm->getFChar(30, 13).ch[0] == L'1' );  // Covered
+  CPPUNIT_ASSERT ( vterm->getFChar(39, 13).ch[0] == L'1' );  // Covered
+
+  // The hidden window 3 covers nothing
+  CPPUNIT_ASSERT ( vterm->getFChar(22, 9).ch[0] == L'd' );
+  CPPUNIT_ASSERT ( vterm->getFChar(27, 9).ch[0] == L'd' );
+
+  // Resizing window 2 also invalidates the occlusion map.
+  // The shrunken window no longer covers window 3 (shown now).
+  vwin_3->visible = true;
+  finalcut::FRect geometry_2_resized {finalcut::FPoint{20, 8}, finalcut::FSize{2, 6}};
+  p_fvterm_2.p_resizeArea (geometry_2_resized, shadow, vwin_2);
+  CPPUNIT_ASSERT ( vwin_2->size.width == 2 );
+  p_fvterm_3.print() << finalcut::FPoint{23, 10} << std::string(6, 'e');
+  p_fvterm_3.p_addLayer (vwin_3);
+  CPPUNIT_ASSERT ( vterm->getFChar(22, 9).ch[0] == L'e' );
+  CPPUNIT_ASSERT ( vterm->getFChar(27, 9).ch[0] == L'e' );
+
+  // A shown window covers the lower windows
+  p_fvterm_2.print() << finalcut::FPoint{21, 10} << std::string(2, 'f');
+  p_fvterm_2.p_addLayer (vwin_2);
+  CPPUNIT_ASSERT ( vterm->getFChar(20, 9).ch[0] == L'f' );
+  CPPUNIT_ASSERT ( vterm->getFChar(21, 9).ch[0] == L'f' );
+  p_fvterm_2.p_resizeArea (geometry_2, shadow, vwin_2);
+  p_fvterm_2.print() << finalcut::FPoint{21, 10} << std::string(20, 'g');
+  p_fvterm_2.p_addLayer (vwin_2);
+  CPPUNIT_ASSERT ( vterm->getFChar(21, 9).ch[0] == L'g' );
+  CPPUNIT_ASSERT ( vterm->getFChar(22, 9).ch[0] == L'e' );  // Window 3
+  CPPUNIT_ASSERT ( vterm->getFChar(27, 9).ch[0] == L'e' );  // Window 3
+  CPPUNIT_ASSERT ( vterm->getFChar(28, 9).ch[0] == L'g' );
+}
+
 //----------------------------------------------------------------------
 void FVTermTest::FVTermReduceUpdatesTest()
 {
@@ -2867,8 +3081,8 @@ void FVTermTest::FVTermReduceUpdatesTest()
 
   for (auto i{0}; i < 6; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 14 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 13 );
+    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 80 );
+    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 0 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 
@@ -2898,12 +3112,96 @@ void FVTermTest::FVTermReduceUpdatesTest()
 
   for (auto i{12}; i < vterm->size.height; i++)
   {
-    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 14 );
-    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 13 );
+    CPPUNIT_ASSERT ( vterm->changes[i].xmin == 80 );
+    CPPUNIT_ASSERT ( vterm->changes[i].xmax == 0 );
     CPPUNIT_ASSERT ( vterm->changes[i].trans_count == 0 );
   }
 }
 
+//----------------------------------------------------------------------
+void FVTermTest::FVTermLineShiftTest()
+{
+  FVTerm_protected p_fvterm(finalcut::outputClass<FTermOutputTest>{});
+  auto&& vterm = p_fvterm.p_getVirtualTerminal();
+  auto&& vdesktop = p_fvterm.p_getVirtualDesktop();
+  CPPUNIT_ASSERT ( vterm->size.width == 80 );
+  CPPUNIT_ASSERT ( vterm->size.height == 24 );
+
+  finalcut::FChar line_char =
+  {
+    { L'A', L'\0', L'\0', L'\0', L'\0' },
+    finalcut::FColor::Default,
+    finalcut::FColor::Default,
+    { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
+  };
+
+  // Every line gets its own letter
+  for (auto y{0}; y < vdesktop->size.height; y++)
+  {
+    line_char.ch[0] = wchar_t(L'A' + y);
+
+    for (auto x{0}; x < vdesktop->size.width; x++)
+      vdesktop->getFChar(x, y) = line_char;
+  }
+
+  // The scrolling saves the terminal content in vterm_old
+  // (lines 'B' to 'X' and a blank last line)
+  FTermOutputTest::setNoForce(true);
+  p_fvterm.p_scrollAreaForward (vdesktop);
+  FTermOutputTest::setNoForce(false);
+
+  auto shift = finalcut::FVTerm::findTerminalLineShift(0, 23);
+  CPPUNIT_ASSERT ( shift.count == 0 );
+  CPPUNIT_ASSERT ( shift.saved_output == 0 );
+
+  // Lines 5 to 13 move up one line, line 14 gets a new content
+  for (auto y{5}; y < 14; y++)
+  {
+    for (auto x{0}; x < vterm->size.width; x++)
+      vterm->getFChar(x, y) = vterm->getFChar(x, y + 1);
+  }
+
+  line_char.ch[0] = L'#';
+
+  for (auto x{0}; x < vterm->size.width; x++)
+    vterm->getFChar(x, 14) = line_char;
+
+  // Too few lines to scroll
+  shift = finalcut::FVTerm::findTerminalLineShift(5, 6);
+  CPPUNIT_ASSERT ( shift.count == 0 );
+
+  shift = finalcut::FVTerm::findTerminalLineShift(0, 23);
+  CPPUNIT_ASSERT ( shift.count == 1 );
+  CPPUNIT_ASSERT ( shift.top == 5 );
+  CPPUNIT_ASSERT ( shift.bottom == 14 );
+  CPPUNIT_ASSERT ( shift.saved_output == 9 * 22 );  // Cursor move, colors, repetition
+
+  // The terminal has scrolled the lines, they are printed again
+  // only where they differ from the saved terminal content
+  finalcut::FVTerm::shiftTerminalLines(shift);
+
+  for (auto y{5}; y <= 14; y++)
+  {
+    CPPUNIT_ASSERT ( vterm->changes[unsigned(y)].xmin == 0 );
+    CPPUNIT_ASSERT ( vterm->changes[unsigned(y)].xmax == 79 );
+  }
+
+  CPPUNIT_ASSERT ( finalcut::FVTerm::findTerminalLineShift(0, 23).count == 0 );
+
+  // Scrolling down
+  for (auto y{13}; y > 5; y--)
+  {
+    for (auto x{0}; x < vterm->size.width; x++)
+      vterm->getFChar(x, y) = vterm->getFChar(x, y - 1);
+  }
+
+  shift = finalcut::FVTerm::findTerminalLineShift(0, 23);
+  CPPUNIT_ASSERT ( shift.count == -1 );
+  CPPUNIT_ASSERT ( shift.top == 5 );
+  CPPUNIT_ASSERT ( shift.bottom == 13 );
+  CPPUNIT_ASSERT ( shift.saved_output == 7 * 22 );  // Line 5 is printed again
+}
+
 //----------------------------------------------------------------------
 void FVTermTest::getFVTermAreaTest()
 {
@@ -2971,7 +3269,6 @@ void FVTermTest::getFVTermAreaTest()
   finalcut::FChar bg_char =
   {
     { L' ', L'\0', L'\0', L'\0', L'\0' },
-    { L'\0', L'\0', L'\0', L'\0', L'\0' },
     finalcut::FColor::Default,
     finalcut::FColor::Default,
     { { 0x00, 0x00, 0x08, 0x00} }  // byte 0..3
@@ -57,6 +57,7 @@ using enable_if_FChar_t =
 //----------------------------------------------------------------------
 void showFCharData (const finalcut::FChar&);
 auto getAreaSize (finalcut::FVTerm::FTermArea*) -> std::size_t;
+auto getAreaChar (finalcut::FVTerm::FTermArea*, std::size_t) -> finalcut::FChar&;
 auto isAreaEqual (finalcut::FVTerm::FTermArea*, finalcut::FVTerm::FTermArea*) -> bool;
 auto isFCharEqual (const finalcut::FChar&, const finalcut::FChar&) -> bool;
 template < typename FCharT
@@ -81,12 +82,6 @@ void showFCharData (const finalcut::FChar& fchar)
                           uInt32(fchar.ch[2]) << L", " <<
                           uInt32(fchar.ch[3]) << L", " <<
                           uInt32(fchar.ch[4]) << L"}\n";
-  std::wcout << L"               encoded_char: '" <<  fchar.encoded_char.data();
-  std::wcout << L"' {" << uInt32(fchar.encoded_char[0]) << L", " <<
-                          uInt32(fchar.encoded_char[1]) << L", " <<
-                          uInt32(fchar.encoded_char[2]) << L", " <<
-                          uInt32(fchar.encoded_char[3]) << L", " <<
-                          uInt32(fchar.encoded_char[4]) << L"}\n";
   std::wcout << L"                   fg_color: " << int(fchar.fg_color) << L'\n';
   std::wcout << L"                   bg_color: " << int(fchar.bg_color) << L'\n';
   std::wcout << L"                    attr[0]: " << int(fchar.attr.byte[0]) << L'\n';
@@ -127,6 +122,15 @@ auto getAreaSize (finalcut::FVTerm::FTermArea* area) -> std::size_t
   return full_width * full_height;
 }
 
+//----------------------------------------------------------------------
+auto getAreaChar ( finalcut::FVTerm::FTermArea* area
+                 , std::size_t index ) -> finalcut::FChar&
+{
+  // Returns the character at the given index in line order
+  const auto full_width = std::size_t(area->size.width) + std::size_t(area->shadow.width);
+  return area->getFChar(int(index % full_width), int(index / full_width));
+}
+
 //----------------------------------------------------------------------
 auto isAreaEqual ( finalcut::FVTerm::FTermArea* area1
                  , finalcut::FVTerm::FTermArea* area2 ) -> bool
@@ -146,11 +150,14 @@ auto isAreaEqual ( finalcut::FVTerm::FTermArea* area1
 
   for (std::size_t i{0U}; i < size1; i++)
   {
-    if ( ! isFCharEqual (area1->data[i], area2->data[i]) )
+    const auto& ch1 = getAreaChar(area1, i);
+    const auto& ch2 = getAreaChar(area2, i);
+
+    if ( ! isFCharEqual (ch1, ch2) )
     {
       std::wcout << L"differ: char " << i << L" '"
-                 << area1->data[i].ch[0] << L"' != '"
-                 << area2->data[i].ch[0] << L"'\n";
+                 << ch1.ch[0] << L"' != '"
+                 << ch2.ch[0] << L"'\n";
       return false;
     }
   }
@@ -167,7 +174,6 @@ auto isFCharEqual ( const finalcut::FChar& lhs
   attr.bit.printed = true;
 
   return finalcut::isFUnicodeEqual(lhs.ch, rhs.ch)
-      && finalcut::isFUnicodeEqual(lhs.encoded_char, rhs.encoded_char)
       && lhs.fg_color     == rhs.fg_color
       && lhs.bg_color     == rhs.bg_color
       && lhs.attr.byte[0] == rhs.attr.byte[0]
@@ -203,7 +209,7 @@ void printOnArea ( finalcut::FVTerm::FTermArea* area
     area->cursor.y = ay + 1;
   }
 
-  auto& ac = area->data[ay * line_length + ax];  // area character
+  auto& ac = getAreaChar(area, std::size_t(ay * line_length + ax));  // area character
   std::memcpy (&ac, &fchar, sizeof(ac));  // copy character to area
   area->cursor.x = ((ax + 1) % line_length) + 1;
   area->cursor.y = ((ax + 1) / line_length) + area->cursor.y;
@@ -262,7 +268,9 @@ void printArea ( finalcut::FVTerm::FTermArea* area )
 
   for (std::size_t i{0U}; i < size; i++)
   {
-    if ( area->data[i].attr.bit.fullwidth_padding )
+    const auto& fchar = getAreaChar(area, i);
+
+    if ( fchar.attr.bit.fullwidth_padding )
       continue;
 
     auto col = (i + 1) % width ;
@@ -271,7 +279,7 @@ void printArea ( finalcut::FVTerm::FTermArea* area )
     if ( col == 1 && line < std::size_t(height) )
       std::wcout << L"│";
 
-    auto ch = area->data[i].ch;
+    auto ch = fchar.ch;
 
     if ( ch[0] == L'\0' )
       ch[0] = L' ';
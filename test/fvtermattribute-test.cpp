@@ -80,7 +80,6 @@ void FVTermAttributeTest::noArgumentTest()
   CPPUNIT_ASSERT ( attribute.getTermBackgroundColor() == finalcut::FColor(0) );
   finalcut::FUnicode empty{{L'\0', L'\0', L'\0', L'\0', L'\0'}};
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor(0) );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor(0) );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] == uInt8(0) );
@@ -105,7 +104,6 @@ void FVTermAttributeTest::afterInitTest()
   CPPUNIT_ASSERT ( attribute.getTermBackgroundColor() == finalcut::FColor::Default );
   finalcut::FUnicode empty{{L'\0', L'\0', L'\0', L'\0', L'\0'}};
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] == uInt8(0) );
@@ -125,7 +123,6 @@ void FVTermAttributeTest::setAttributeTest()
   CPPUNIT_ASSERT ( attribute.getTermBackgroundColor() == finalcut::FColor::White );
   finalcut::FUnicode empty{{L'\0', L'\0', L'\0', L'\0', L'\0'}};
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Red );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::White );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] == uInt8(0) );
@@ -142,7 +139,6 @@ void FVTermAttributeTest::setAttributeTest()
   CPPUNIT_ASSERT ( attribute.getTermForegroundColor() == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getTermBackgroundColor() == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] == uInt8(0) );
@@ -163,7 +159,6 @@ void FVTermAttributeTest::setAttributeTest()
   attribute.setBold(true);
   CPPUNIT_ASSERT ( attribute.isBold() );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] != uInt8(0) );
@@ -183,7 +178,6 @@ void FVTermAttributeTest::setAttributeTest()
   attribute.setDim(true);
   CPPUNIT_ASSERT ( attribute.isDim() );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] != uInt8(0) );
@@ -203,7 +197,6 @@ void FVTermAttributeTest::setAttributeTest()
   attribute.setItalic(true);
   CPPUNIT_ASSERT ( attribute.isItalic() );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] != uInt8(0) );
@@ -223,7 +216,6 @@ void FVTermAttributeTest::setAttributeTest()
   attribute.setUnderline(true);
   CPPUNIT_ASSERT ( attribute.isUnderline() );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] != uInt8(0) );
@@ -243,7 +235,6 @@ void FVTermAttributeTest::setAttributeTest()
   attribute.setBlink(true);
   CPPUNIT_ASSERT ( attribute.isBlink() );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] != uInt8(0) );
@@ -263,7 +254,6 @@ void FVTermAttributeTest::setAttributeTest()
   attribute.setReverse(true);
   CPPUNIT_ASSERT ( attribute.isReverse() );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] != uInt8(0) );
@@ -283,7 +273,6 @@ void FVTermAttributeTest::setAttributeTest()
   attribute.setStandout(true);
   CPPUNIT_ASSERT ( attribute.isStandout() );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] != uInt8(0) );
@@ -303,7 +292,6 @@ void FVTermAttributeTest::setAttributeTest()
   attribute.setInvisible(true);
   CPPUNIT_ASSERT ( attribute.isInvisible() );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] != uInt8(0) );
@@ -323,7 +311,6 @@ void FVTermAttributeTest::setAttributeTest()
   attribute.setProtected(true);
   CPPUNIT_ASSERT ( attribute.isProtected() );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] == uInt8(0) );
@@ -343,7 +330,6 @@ void FVTermAttributeTest::setAttributeTest()
   attribute.setCrossedOut(true);
   CPPUNIT_ASSERT ( attribute.isCrossedOut() );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] == uInt8(0) );
@@ -363,7 +349,6 @@ void FVTermAttributeTest::setAttributeTest()
   attribute.setDoubleUnderline(true);
   CPPUNIT_ASSERT ( attribute.isDoubleUnderline() );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] == uInt8(0) );
@@ -383,7 +368,6 @@ void FVTermAttributeTest::setAttributeTest()
   attribute.setAltCharset(true);
   CPPUNIT_ASSERT ( attribute.isAltCharset() );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] == uInt8(0) );
@@ -403,7 +387,6 @@ void FVTermAttributeTest::setAttributeTest()
   attribute.setPCcharset(true);
   CPPUNIT_ASSERT ( attribute.isPCcharset() );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] == uInt8(0) );
@@ -423,7 +406,6 @@ void FVTermAttributeTest::setAttributeTest()
   attribute.setTransparent(true);
   CPPUNIT_ASSERT ( attribute.isTransparent() );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] == uInt8(0) );
@@ -443,7 +425,6 @@ void FVTermAttributeTest::setAttributeTest()
   attribute.setColorOverlay(true);
   CPPUNIT_ASSERT ( attribute.isColorOverlay() );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] == uInt8(0) );
@@ -463,7 +444,6 @@ void FVTermAttributeTest::setAttributeTest()
   attribute.setInheritBackground(true);
   CPPUNIT_ASSERT ( attribute.isInheritBackground() );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] == uInt8(0) );
@@ -489,7 +469,6 @@ void FVTermAttributeTest::printTest()
   CPPUNIT_ASSERT ( attribute.getTermBackgroundColor() == finalcut::FColor::Blue );
   finalcut::FUnicode empty{{L'\0', L'\0', L'\0', L'\0', L'\0'}};
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Yellow );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Blue );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] == uInt8(0) );
@@ -512,7 +491,6 @@ void FVTermAttributeTest::printTest()
   CPPUNIT_ASSERT ( attribute.getTermForegroundColor() == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getTermBackgroundColor() == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] != uInt8(0) );
@@ -527,7 +505,6 @@ void FVTermAttributeTest::printTest()
   CPPUNIT_ASSERT ( attribute.getTermForegroundColor() == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getTermBackgroundColor() == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] != uInt8(0) );
@@ -543,7 +520,6 @@ void FVTermAttributeTest::printTest()
   CPPUNIT_ASSERT ( attribute.getTermForegroundColor() == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getTermBackgroundColor() == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] == uInt8(0) );
@@ -562,7 +538,6 @@ void FVTermAttributeTest::printTest()
   CPPUNIT_ASSERT ( attribute.getTermForegroundColor() == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getTermBackgroundColor() == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] != uInt8(0) );
@@ -581,7 +556,6 @@ void FVTermAttributeTest::printTest()
   CPPUNIT_ASSERT ( attribute.getTermForegroundColor() == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getTermBackgroundColor() == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] != uInt8(0) );
@@ -599,7 +573,6 @@ void FVTermAttributeTest::printTest()
   CPPUNIT_ASSERT ( attribute.getTermForegroundColor() == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getTermBackgroundColor() == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().ch == empty );
-  CPPUNIT_ASSERT ( attribute.getAttribute().encoded_char == empty );
   CPPUNIT_ASSERT ( attribute.getAttribute().fg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().bg_color == finalcut::FColor::Default );
   CPPUNIT_ASSERT ( attribute.getAttribute().attr.byte[0] == uInt8(0) );
@@ -524,6 +524,18 @@ class FWidgetTest::FSystemTest : public finalcut::FSystem
       return 0;
     }
 
+    auto timerfd_create (int, int) -> int override
+    {
+      return 0;
+    }
+
+    auto timerfd_settime ( int, int
+                         , const struct itimerspec*
+                         , struct itimerspec* ) -> int override
+    {
+      return 0;
+    }
+
     auto kqueue() -> int override
     {
       return 0;